@@ -0,0 +1,262 @@
+#include "AudioResamplerBenchmark.h"
+#include "Audio/AudioResampler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr double kPi = 3.14159265358979323846;
+        constexpr int kAnalysisFrames = 16384;
+        constexpr int kSettleFrames = 64;           // filter start-up, skipped by the analysis
+        constexpr int kThroughputFrames = 480000;
+        constexpr int kBlockFrames = 512;           // what the mixer asks for per voice
+
+        struct Case
+        {
+            const char* name;
+            int sourceRate;
+            int outputRate;
+            float pitch;
+            float maxThdNoiseDb;
+            float minPassbandDb;
+            float maxAliasDb;
+        };
+
+        // Limits sit a little under what the Kaiser kernels reach, so a regression fails the run. Aliasing near output Nyquist is bounded by the kernel's transition band.
+        const Case kCases[] = {
+            { "unity_48k", 48000, 48000, 1.0f, -120.0f, -0.1f, 0.0f },
+            { "44k1_to_48k", 44100, 48000, 1.0f, -85.0f, -0.5f, 0.0f },
+            { "22k05_to_48k", 22050, 48000, 1.0f, -85.0f, -0.5f, 0.0f },
+            { "48k_to_44k1", 48000, 44100, 1.0f, -85.0f, -1.5f, -17.0f },
+            { "48k_to_22k05", 48000, 22050, 1.0f, -85.0f, -1.5f, -45.0f },
+            { "pitch_1_5", 48000, 48000, 1.5f, -85.0f, -2.5f, -25.0f },
+            { "pitch_3", 48000, 48000, 3.0f, -85.0f, -2.5f, -25.0f },
+            { "pitch_8", 48000, 48000, 8.0f, -85.0f, -3.5f, -18.0f }
+        };
+
+        // The step the resampler actually runs at, after 32.32 rounding
+        double QuantizedStep(double step)
+        {
+            return static_cast<double>(AudioResampler::StepToFixed(step)) / 4294967296.0;
+        }
+
+        // Resamples a unit sine of cyclesPerSourceFrame and returns the output
+        std::vector<float> ResampleTone(double cyclesPerSourceFrame, double step, int outputFrames)
+        {
+            // Padded past the longest kernel so the analysed tail never reads the zeros after the end
+            const int sourceFrames = static_cast<int>(std::ceil(outputFrames * step)) + AudioResampler::kTaps * AudioResampler::kMaxStretch;
+            std::vector<float> source(sourceFrames);
+            for (int i = 0; i < sourceFrames; ++i)
+            {
+                source[i] = static_cast<float>(std::sin(2.0 * kPi * cyclesPerSourceFrame * i));
+            }
+
+            std::vector<float> left(outputFrames);
+            std::vector<float> right(outputFrames);
+            const float* channels[1] = { source.data() };
+            ResamplerState state;
+            AudioResampler::Process(channels, 1, sourceFrames, false, step, state, left.data(), right.data(), outputFrames);
+            return left;
+        }
+
+        // Least-squares fit of a sine at cyclesPerFrame; returns its amplitude and the
+        // residual energy relative to it
+        void FitTone(const std::vector<float>& output, double cyclesPerFrame, double& amplitude, double& residualDb)
+        {
+            const double w = 2.0 * kPi * cyclesPerFrame;
+            double ss = 0.0, cc = 0.0, sc = 0.0, ys = 0.0, yc = 0.0;
+            for (int n = kSettleFrames; n < static_cast<int>(output.size()); ++n)
+            {
+                const double s = std::sin(w * n);
+                const double c = std::cos(w * n);
+                ss += s * s;
+                cc += c * c;
+                sc += s * c;
+                ys += output[n] * s;
+                yc += output[n] * c;
+            }
+
+            const double det = ss * cc - sc * sc;
+            const double a = (ys * cc - yc * sc) / det;
+            const double b = (yc * ss - ys * sc) / det;
+            amplitude = std::sqrt(a * a + b * b);
+
+            double toneEnergy = 0.0;
+            double residualEnergy = 0.0;
+            for (int n = kSettleFrames; n < static_cast<int>(output.size()); ++n)
+            {
+                const double fit = a * std::sin(w * n) + b * std::cos(w * n);
+                const double residual = output[n] - fit;
+                toneEnergy += fit * fit;
+                residualEnergy += residual * residual;
+            }
+            residualDb = 10.0 * std::log10((std::max)(residualEnergy, 1e-30) / (std::max)(toneEnergy, 1e-30));
+        }
+
+        double RmsDb(const std::vector<float>& output)
+        {
+            double energy = 0.0;
+            for (int n = kSettleFrames; n < static_cast<int>(output.size()); ++n)
+            {
+                energy += static_cast<double>(output[n]) * output[n];
+            }
+            // Relative to the unit sine that went in (RMS 1/sqrt(2))
+            const double rms = std::sqrt(energy / (output.size() - kSettleFrames));
+            return 20.0 * std::log10((std::max)(rms * std::sqrt(2.0), 1e-15));
+        }
+
+        float Median(std::vector<float> values)
+        {
+            if (values.empty()) return 0.0f;
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+    }
+
+    AudioResamplerBenchmark::AudioResamplerBenchmark()
+        : iterations(10)
+        , warmupIterations(2)
+    {
+    }
+
+    void AudioResamplerBenchmark::Configure(int measured, int warmup)
+    {
+        iterations = (std::max)(1, measured);
+        warmupIterations = (std::max)(0, warmup);
+    }
+
+    bool AudioResamplerBenchmark::Run()
+    {
+        results.clear();
+        bool allPassed = true;
+
+        // One second of looping stereo noise-free content for the throughput runs
+        std::vector<float> throughputLeft(48000);
+        std::vector<float> throughputRight(48000);
+        for (int i = 0; i < 48000; ++i)
+        {
+            throughputLeft[i] = static_cast<float>(std::sin(2.0 * kPi * 440.0 * i / 48000.0));
+            throughputRight[i] = static_cast<float>(std::sin(2.0 * kPi * 660.0 * i / 48000.0));
+        }
+        std::vector<float> blockLeft(kBlockFrames);
+        std::vector<float> blockRight(kBlockFrames);
+
+        for (const Case& testCase : kCases)
+        {
+            Result result;
+            result.name = testCase.name;
+            result.sourceRate = testCase.sourceRate;
+            result.outputRate = testCase.outputRate;
+            result.pitch = testCase.pitch;
+            result.step = QuantizedStep(static_cast<double>(testCase.sourceRate) / testCase.outputRate * testCase.pitch);
+
+            const double sourceNyquist = testCase.sourceRate * 0.5;
+            double amplitude = 0.0;
+            double residualDb = 0.0;
+
+            // THD+N of a 1 kHz tone
+            const double toneCycles = 1000.0 / testCase.sourceRate;
+            FitTone(ResampleTone(toneCycles, result.step, kAnalysisFrames), toneCycles * result.step, amplitude, residualDb);
+            result.thdNoiseDb = static_cast<float>(residualDb);
+
+            // Gain near the top of what the output can carry
+            const double passCycles = 0.75 * (std::min)(1.0, 1.0 / result.step) * sourceNyquist / testCase.sourceRate;
+            FitTone(ResampleTone(passCycles, result.step, kAnalysisFrames), passCycles * result.step, amplitude, residualDb);
+            result.passbandDb = static_cast<float>(20.0 * std::log10((std::max)(amplitude, 1e-15)));
+
+            // A tone between output and source Nyquist folds back unless the filter removes it
+            result.aliasDb = 0.0f;
+            if (result.step > 1.0)
+            {
+                const double aliasCycles = (std::min)(0.97, 1.2 / result.step) * sourceNyquist / testCase.sourceRate;
+                result.aliasDb = static_cast<float>(RmsDb(ResampleTone(aliasCycles, result.step, kAnalysisFrames)));
+            }
+
+            std::vector<float> times;
+            times.reserve(iterations);
+            const float* channels[2] = { throughputLeft.data(), throughputRight.data() };
+            for (int i = 0; i < warmupIterations + iterations; ++i)
+            {
+                ResamplerState state;
+                const auto start = std::chrono::high_resolution_clock::now();
+                for (int written = 0; written < kThroughputFrames; written += kBlockFrames)
+                {
+                    AudioResampler::Process(channels, 2, 48000, true, result.step, state,
+                        blockLeft.data(), blockRight.data(), kBlockFrames);
+                }
+                const auto end = std::chrono::high_resolution_clock::now();
+
+                if (i >= warmupIterations)
+                {
+                    times.push_back(std::chrono::duration<float, std::milli>(end - start).count());
+                }
+            }
+            const float ms = Median(times);
+            result.megaFramesPerSecond = ms > 0.0f ? kThroughputFrames / (ms * 1000.0f) : 0.0f;
+
+            result.passed = result.thdNoiseDb <= testCase.maxThdNoiseDb
+                && result.passbandDb >= testCase.minPassbandDb
+                && (result.step <= 1.0 || result.aliasDb <= testCase.maxAliasDb);
+            allPassed = allPassed && result.passed;
+            results.push_back(result);
+        }
+
+        return allPassed;
+    }
+
+    void AudioResamplerBenchmark::PrintTable() const
+    {
+        std::printf("\n%-14s %8s %10s %10s %10s %10s %6s\n", "case", "step", "thd+n dB", "pass dB", "alias dB", "Mframe/s", "");
+        for (const auto& result : results)
+        {
+            std::printf("%-14s %8.4f %10.1f %10.2f %10.1f %10.1f %6s\n", result.name.c_str(), result.step,
+                result.thdNoiseDb, result.passbandDb, result.aliasDb, result.megaFramesPerSecond,
+                result.passed ? "ok" : "FAIL");
+        }
+    }
+
+    bool AudioResamplerBenchmark::WriteResults(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(4);
+        out << "{\n";
+#ifdef _DEBUG
+        out << "  \"config\": \"Debug\",\n";
+#else
+        out << "  \"config\": \"Release\",\n";
+#endif
+        out << "  \"iterations\": " << iterations << ",\n";
+        out << "  \"cases\": [\n";
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& result = results[i];
+            out << "    { \"name\": \"" << result.name << "\""
+                << ", \"source_rate\": " << result.sourceRate
+                << ", \"output_rate\": " << result.outputRate
+                << ", \"pitch\": " << result.pitch
+                << ", \"step\": " << result.step
+                << ", \"thd_n_db\": " << result.thdNoiseDb
+                << ", \"passband_db\": " << result.passbandDb
+                << ", \"alias_db\": " << result.aliasDb
+                << ", \"mframes_per_s\": " << result.megaFramesPerSecond
+                << ", \"passed\": " << (result.passed ? "true" : "false") << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n";
+        out << "}\n";
+        return true;
+    }
+}
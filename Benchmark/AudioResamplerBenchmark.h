@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    // AudioResampler quality and speed per rate conversion: THD+N of a 1 kHz tone, gain of a
+    // tone near the top of the kept band, rejection of a tone that would alias when
+    // downsampling, and stereo throughput. Each case has limits; Run fails if one is missed.
+    class AudioResamplerBenchmark
+    {
+    public:
+        struct Result
+        {
+            std::string name;
+            int sourceRate;
+            int outputRate;
+            float pitch;
+            double step;            // source frames per output frame
+            float thdNoiseDb;       // residual after removing the fitted tone, relative to the tone
+            float passbandDb;       // gain at 75% of the band that survives the conversion
+            float aliasDb;          // gain of a tone above output Nyquist; 0 when not downsampling
+            float megaFramesPerSecond;
+            bool passed;
+        };
+
+    private:
+        int iterations;
+        int warmupIterations;
+        std::vector<Result> results;
+
+    public:
+        AudioResamplerBenchmark();
+
+        void Configure(int iterations, int warmup);
+        // False if any case missed its quality limits
+        bool Run();
+
+        const std::vector<Result>& GetResults() const { return results; }
+        void PrintTable() const;
+        bool WriteResults(const std::string& filePath) const;
+    };
+}
@@ -0,0 +1,367 @@
+#include "BenchmarkApp.h"
+#include "Core/Renderer.h"
+#include "Core/Scene.h"
+#include "Core/GameObject.h"
+#include "Core/Profiler.h"
+#include "Core/TextureManager.h"
+#include "Core/ObjectPools.h"
+#include "Core/EngineStats.h"
+#include "Managers/SceneManager.h"
+#include "Systems/RenderSystem.h"
+#include "Systems/PhysicsSystem.h"
+#include "Components/SpriteRenderer.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr uint32_t kRandomSeed = 0xA5E1;
+
+        // Golden messages can carry user-supplied paths
+        std::string EscapeJson(const std::string& value)
+        {
+            std::string escaped;
+            for (char c : value)
+            {
+                if (c == '"' || c == '\\') escaped += '\\';
+                escaped += c;
+            }
+            return escaped;
+        }
+    }
+
+    float BenchmarkApp::SceneResult::GetFramePercentile(float p) const
+    {
+        if (frameMs.empty()) return 0.0f;
+
+        std::vector<float> sorted = frameMs;
+        std::sort(sorted.begin(), sorted.end());
+        const int rank = static_cast<int>(std::ceil(p * sorted.size()));
+        return sorted[(std::min)((std::max)(rank, 1), static_cast<int>(sorted.size())) - 1];
+    }
+
+    float BenchmarkApp::SceneResult::GetFrameAverage() const
+    {
+        if (frameMs.empty()) return 0.0f;
+
+        double sum = 0.0;
+        for (float ms : frameMs) sum += ms;
+        return static_cast<float>(sum / frameMs.size());
+    }
+
+    BenchmarkApp::BenchmarkApp()
+        : frameCount(300)
+        , warmupFrames(30)
+        , fixedDeltaTime(1.0f / 60.0f)
+        , currentScene(nullptr)
+        , currentSceneInstance(nullptr)
+        , renderCapture(false)
+        , updateGolden(false)
+    {
+        SetHeadless(true);
+    }
+
+    void BenchmarkApp::Configure(int frames, int warmup, const std::vector<std::string>& scenes)
+    {
+        frameCount = (std::max)(1, frames);
+        warmupFrames = (std::max)(0, warmup);
+        sceneFilter = scenes;
+    }
+
+    void BenchmarkApp::SetGolden(const std::string& directory, bool update)
+    {
+        goldenDirectory = directory;
+        updateGolden = update;
+    }
+
+    void BenchmarkApp::OnInit()
+    {
+        GetRenderer()->SetVSync(false);
+
+        if (!TextureManager::GetInstance().Initialize(GetRenderer()->GetD2DContext()))
+        {
+            DEBUG_LOG("TextureManager initialization failed; scenes will run without sprites");
+            return;
+        }
+
+        auto& textures = TextureManager::GetInstance();
+        const Color colors[4] = { Color::White, Color::Red, Color::Green, Color::Blue };
+        const char* names[4] = { "bench_white", "bench_red", "bench_green", "bench_blue" };
+        for (int i = 0; i < 4; ++i)
+        {
+            if (auto texture = textures.CreateSolidColorTexture(names[i], 16, 16, colors[i]))
+            {
+                context.sprites.push_back(std::make_shared<Sprite>(texture, names[i]));
+            }
+        }
+    }
+
+    void BenchmarkApp::OnUpdate(float deltaTime)
+    {
+        if (currentScene && currentScene->tick)
+        {
+            currentScene->tick(currentSceneInstance, context);
+        }
+    }
+
+    bool BenchmarkApp::IsSelected(const BenchmarkScene& scene) const
+    {
+        if (sceneFilter.empty()) return true;
+        return std::find(sceneFilter.begin(), sceneFilter.end(), scene.name) != sceneFilter.end();
+    }
+
+    bool BenchmarkApp::RunAll()
+    {
+        results.clear();
+        for (const auto& scene : GetBenchmarkScenes())
+        {
+            if (!IsSelected(scene)) continue;
+
+            std::cout << "Running " << scene.name << " ..." << std::endl;
+            results.push_back(RunScene(scene));
+        }
+        return !results.empty();
+    }
+
+    BenchmarkApp::SceneResult BenchmarkApp::RunScene(const BenchmarkScene& scene)
+    {
+        SceneResult result;
+        result.name = scene.name;
+        result.description = scene.description;
+        result.frames = frameCount;
+
+        // Same seed per scene so runs are comparable
+        context.random.seed(kRandomSeed);
+        context.liveObjects.clear();
+        context.instantiated = 0;
+        context.destroyed = 0;
+        context.worldTravelled = 0.0f;
+        context.counters.clear();
+        context.checkFailure.clear();
+
+        SceneManager* scenes = GetSceneManager();
+        const int64_t setupStart = Profiler::Now();
+
+        Scene* instance = scenes->CreateScene(scene.name);
+        if (scene.build) scene.build(instance, context);
+        instance->Start();
+
+        result.setupMs = (Profiler::Now() - setupStart) * 1e-6;
+        currentScene = &scene;
+        currentSceneInstance = instance;
+
+        // Restarted per scene so every scene sees the same input from its first frame
+        if (!replayPath.empty() && !StartInputReplay(replayPath))
+        {
+            std::cout << "Failed to open input replay " << replayPath << "; running with no input" << std::endl;
+        }
+
+        for (int i = 0; i < warmupFrames; ++i)
+        {
+            StepFrame(fixedDeltaTime);
+        }
+
+        const uint16_t mainThread = Profiler::GetCurrentThreadIndex();
+        double drawnSprites = 0.0;
+        double culledSprites = 0.0;
+        double broadphasePairs = 0.0;
+        double contacts = 0.0;
+        double bytesAllocated = 0.0;
+        const int instantiatedBefore = context.instantiated;
+        const int destroyedBefore = context.destroyed;
+
+        result.frameMs.reserve(frameCount);
+        std::map<std::string, double> frameStages;
+
+        // Scenes are seeded and stepped with a fixed delta, so identical code draws identically
+        renderCapture.Clear();
+        GetRenderer()->SetCapture(&renderCapture);
+
+        for (int i = 0; i < frameCount; ++i)
+        {
+            StepFrame(fixedDeltaTime);
+
+            const ProfileFrame* frame = Profiler::GetInstance().GetLastFrame();
+            if (!frame) continue;
+
+            result.frameMs.push_back(static_cast<float>(frame->GetDurationMs()));
+
+            // A zone entered several times per frame counts once, summed
+            frameStages.clear();
+            for (const ProfileZone& zone : frame->zones)
+            {
+                if (zone.thread != mainThread) continue;
+                frameStages[zone.name] += (zone.end - zone.start) * 1e-6;
+            }
+            for (const auto& stage : frameStages)
+            {
+                StageTiming& timing = result.stages[stage.first];
+                timing.totalMs += stage.second;
+                timing.maxMs = (std::max)(timing.maxMs, stage.second);
+            }
+
+            drawnSprites += GetRenderSystem()->GetDrawnSpriteCount();
+            culledSprites += GetRenderSystem()->GetCulledSpriteCount();
+            broadphasePairs += GetPhysicsSystem()->GetBroadphasePairCount();
+            contacts += GetPhysicsSystem()->GetContactCount();
+            if (const StatsFrame* stats = EngineStats::GetInstance().GetLastFrame())
+            {
+                bytesAllocated += static_cast<double>(stats->Get(StatCounter::BytesAllocated));
+            }
+        }
+
+        GetRenderer()->SetCapture(nullptr);
+        result.renderHash = renderCapture.GetRunHash();
+        if (!goldenDirectory.empty())
+        {
+            CheckGolden(result);
+        }
+
+        result.counters["game_objects"] = instance->GetGameObjectCount();
+        result.counters["sprites_drawn"] = drawnSprites / frameCount;
+        result.counters["sprites_culled"] = culledSprites / frameCount;
+        result.counters["broadphase_pairs"] = broadphasePairs / frameCount;
+        result.counters["contacts"] = contacts / frameCount;
+        result.counters["heap_bytes_allocated"] = bytesAllocated / frameCount;
+        result.counters["instantiated_total"] = context.instantiated - instantiatedBefore;
+        result.counters["destroyed_total"] = context.destroyed - destroyedBefore;
+
+        size_t poolUsed = 0;
+        size_t poolCapacity = 0;
+        for (const PoolStats& pool : ObjectPools::GetStats())
+        {
+            poolUsed += pool.used;
+            poolCapacity += pool.capacity;
+        }
+        result.counters["pool_blocks_used"] = static_cast<double>(poolUsed);
+        result.counters["pool_blocks_capacity"] = static_cast<double>(poolCapacity);
+        for (const auto& counter : context.counters)
+        {
+            result.counters[counter.first] = counter.second;
+        }
+        result.checkFailure = context.checkFailure;
+
+        StopInputReplay();
+        currentScene = nullptr;
+        currentSceneInstance = nullptr;
+        context.liveObjects.clear();
+
+        // Streams its objects out of the scene, so it has to close first
+        context.worldPartition.reset();
+        if (!context.worldDirectory.empty())
+        {
+            std::error_code error;
+            std::filesystem::remove_all(context.worldDirectory, error);
+            context.worldDirectory.clear();
+        }
+        scenes->UnloadScene(instance);
+
+        return result;
+    }
+
+    void BenchmarkApp::CheckGolden(SceneResult& result) const
+    {
+        const std::string path = goldenDirectory + "/" + result.name + ".render.json";
+
+        if (updateGolden)
+        {
+            std::error_code error;
+            std::filesystem::create_directories(goldenDirectory, error);
+
+            result.goldenFailed = !renderCapture.SaveHashes(path);
+            result.golden = result.goldenFailed ? "failed to write " + path : "saved";
+            return;
+        }
+
+        std::vector<RenderCapture::Frame> golden;
+        if (!RenderCapture::LoadHashes(path, golden))
+        {
+            result.golden = "no golden at " + path + " (run with --update-golden)";
+            result.goldenFailed = true;
+            return;
+        }
+
+        const RenderCapture::Difference difference = renderCapture.Compare(golden);
+        result.goldenFailed = difference.frame >= 0;
+        result.golden = result.goldenFailed ? difference.description : "match";
+    }
+
+    bool BenchmarkApp::WriteResults(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            DEBUG_LOG("Failed to open benchmark output: " + filePath);
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(4);
+        out << "{\n";
+#ifdef _DEBUG
+        out << "  \"config\": \"Debug\",\n";
+#else
+        out << "  \"config\": \"Release\",\n";
+#endif
+        out << "  \"frames\": " << frameCount << ",\n";
+        out << "  \"warmup\": " << warmupFrames << ",\n";
+        out << "  \"dt\": " << fixedDeltaTime << ",\n";
+        out << "  \"scenes\": [\n";
+
+        for (size_t s = 0; s < results.size(); ++s)
+        {
+            const SceneResult& result = results[s];
+
+            out << "    {\n";
+            out << "      \"name\": \"" << result.name << "\",\n";
+            out << "      \"description\": \"" << result.description << "\",\n";
+            out << "      \"setup_ms\": " << result.setupMs << ",\n";
+            out << "      \"render_hash\": \"" << std::hex << std::setw(16) << std::setfill('0') << result.renderHash
+                << std::dec << std::setfill(' ') << "\",\n";
+            if (!result.golden.empty())
+            {
+                out << "      \"golden\": \"" << EscapeJson(result.golden) << "\",\n";
+            }
+            if (!result.checkFailure.empty())
+            {
+                out << "      \"check_failure\": \"" << EscapeJson(result.checkFailure) << "\",\n";
+            }
+            out << "      \"frame_ms\": { \"avg\": " << result.GetFrameAverage()
+                << ", \"p50\": " << result.GetFramePercentile(0.50f)
+                << ", \"p95\": " << result.GetFramePercentile(0.95f)
+                << ", \"p99\": " << result.GetFramePercentile(0.99f)
+                << ", \"max\": " << result.GetFramePercentile(1.0f) << " },\n";
+
+            out << "      \"stages_ms\": {";
+            bool first = true;
+            for (const auto& stage : result.stages)
+            {
+                out << (first ? "\n" : ",\n");
+                out << "        \"" << stage.first << "\": { \"avg\": " << stage.second.totalMs / (std::max)(result.frames, 1)
+                    << ", \"max\": " << stage.second.maxMs << " }";
+                first = false;
+            }
+            out << "\n      },\n";
+
+            out << "      \"counters\": {";
+            first = true;
+            for (const auto& counter : result.counters)
+            {
+                out << (first ? "\n" : ",\n");
+                out << "        \"" << counter.first << "\": " << counter.second;
+                first = false;
+            }
+            out << "\n      }\n";
+            out << "    }" << (s + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        out << "  ]\n}\n";
+
+        DEBUG_LOG("Benchmark results written: " + filePath);
+        return true;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Core/EngineApp.h"
+#include "Core/RenderCapture.h"
+#include "BenchmarkScenes.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    class Scene;
+
+    // Runs the standard stress scenes headless for a fixed number of frames each and
+    // reports per-stage timings (from profiler zones) and engine counters as JSON.
+    class BenchmarkApp : public EngineApp
+    {
+    public:
+        struct StageTiming
+        {
+            double totalMs = 0.0;
+            double maxMs = 0.0;
+        };
+
+        struct SceneResult
+        {
+            std::string name;
+            std::string description;
+            int frames = 0;
+            double setupMs = 0.0;
+            std::vector<float> frameMs;
+            std::map<std::string, StageTiming> stages;
+            std::map<std::string, double> counters;     // per-frame averages unless noted
+            uint64_t renderHash = 0;                    // of every measured frame's draw calls
+            std::string golden;                         // "match", "saved" or the first difference; empty without golden files
+            bool goldenFailed = false;
+            std::string checkFailure;                   // the scene's own check that broke; empty if they held
+
+            // Nearest-rank percentile of frameMs, p in [0, 1]
+            float GetFramePercentile(float p) const;
+            float GetFrameAverage() const;
+        };
+
+    private:
+        int frameCount;
+        int warmupFrames;
+        float fixedDeltaTime;
+        std::vector<std::string> sceneFilter;
+
+        BenchmarkContext context;
+        const BenchmarkScene* currentScene;
+        Scene* currentSceneInstance;
+        RenderCapture renderCapture;                    // hashes only
+        std::string goldenDirectory;
+        bool updateGolden;
+        std::string replayPath;
+
+        std::vector<SceneResult> results;
+
+    public:
+        BenchmarkApp();
+        virtual ~BenchmarkApp() = default;
+
+        void Configure(int frames, int warmup, const std::vector<std::string>& scenes);
+        // Per-frame render hashes of each scene are checked against DIR/<scene>.render.json,
+        // or written there when update is set. Goldens only hold for the same frame count.
+        void SetGolden(const std::string& directory, bool update);
+        // Input capture (Game.exe --record) replayed from the first warmup frame of every
+        // scene; its recorded deltas replace the fixed delta until it runs out
+        void SetReplay(const std::string& path) { replayPath = path; }
+
+        virtual void OnInit() override;
+        virtual void OnUpdate(float deltaTime) override;
+
+        // Runs every selected scene; false if none matched
+        bool RunAll();
+        bool WriteResults(const std::string& filePath) const;
+
+        const std::vector<SceneResult>& GetResults() const { return results; }
+
+    private:
+        SceneResult RunScene(const BenchmarkScene& scene);
+        void CheckGolden(SceneResult& result) const;
+        bool IsSelected(const BenchmarkScene& scene) const;
+    };
+}
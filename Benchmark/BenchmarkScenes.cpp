@@ -0,0 +1,568 @@
+#include "BenchmarkScenes.h"
+#include "Core/Scene.h"
+#include "Core/GameObject.h"
+#include "Components/Transform.h"
+#include "Components/SpriteRenderer.h"
+#include "Components/Rigidbody.h"
+#include "Components/Collider.h"
+#include "Components/Animator.h"
+#include "Components/Camera.h"
+#include "Components/AudioSource.h"
+#include "Components/AudioListener.h"
+#include "Resources/AnimationClip.h"
+#include "Resources/AudioClip.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr float kWorldWidth = 1600.0f;
+        constexpr float kWorldHeight = 900.0f;
+        constexpr float kTwoPi = 6.2831853f;
+
+        constexpr int kChurnPerFrame = 200;
+        constexpr int kChurnLiveTarget = 2000;
+
+        // A world 50 times the view's area, so a camera at zoom 1 sees about 2% of it
+        constexpr int kCulledWorldSprites = 200000;
+        constexpr float kCulledWorldScale = 7.0710678f;   // sqrt(50) per axis
+
+        constexpr int kBulletsPerFrame = 500;
+        constexpr int kBulletLifetimeFrames = 20;
+
+        constexpr int kAudioEmitters = 1000;
+        constexpr int kToneRate = 44100;
+
+        // 32 x 8 cells of 16 sprites with two children each; the focus sweeps row 3 and back
+        constexpr float kStreamCellSize = 512.0f;
+        constexpr int kStreamCellsX = 32;
+        constexpr int kStreamCellsY = 8;
+        constexpr int kStreamRootsPerCell = 16;
+        constexpr int kStreamObjectsPerCell = kStreamRootsPerCell * 3;
+        constexpr float kStreamFocusY = 3.5f * kStreamCellSize;
+        constexpr float kStreamFocusSpeed = 48.0f;         // world units per frame
+        constexpr int kStreamBudgetCells = 24;              // fewer than the unload radius covers
+        constexpr int kStreamBrokenCellX = 6;               // on the path, overwritten with garbage
+        constexpr int kStreamBrokenCellY = 3;
+
+        // Moves its object around a fixed circle every frame
+        class Orbiter : public Component
+        {
+        private:
+            Vector2 center;
+            float radius;
+            float angularSpeed;
+            float phase;
+
+        public:
+            Orbiter(const Vector2& orbitCenter, float orbitRadius, float speed, float startPhase)
+                : Component("Orbiter")
+                , center(orbitCenter)
+                , radius(orbitRadius)
+                , angularSpeed(speed)
+                , phase(startPhase)
+            {
+            }
+
+            virtual void OnUpdate(float deltaTime) override
+            {
+                phase += angularSpeed * deltaTime;
+                GetTransform()->SetPosition(center + Vector2(std::cos(phase), std::sin(phase)) * radius);
+            }
+        };
+
+        // Rotates its local transform, dirtying every descendant's world matrix
+        class Spinner : public Component
+        {
+        private:
+            float degreesPerSecond;
+
+        public:
+            explicit Spinner(float speed)
+                : Component("Spinner")
+                , degreesPerSecond(speed)
+            {
+            }
+
+            virtual void OnUpdate(float deltaTime) override
+            {
+                Transform* transform = GetTransform();
+                transform->SetLocalRotation(transform->GetLocalRotation() + degreesPerSecond * deltaTime);
+            }
+        };
+
+        // Flies in a straight line and destroys its own object after a fixed number of frames
+        class Bullet : public Component
+        {
+        private:
+            Vector2 velocity;
+            int lifetimeFrames;
+            int framesLeft;
+            int* destroyedCount;
+
+        public:
+            Bullet(int lifetime, int* destroyed)
+                : Component("Bullet")
+                , lifetimeFrames(lifetime)
+                , framesLeft(lifetime)
+                , destroyedCount(destroyed)
+            {
+            }
+
+            void Fire(const Vector2& bulletVelocity)
+            {
+                velocity = bulletVelocity;
+                framesLeft = lifetimeFrames;
+            }
+
+            virtual void OnReset() override
+            {
+                velocity = Vector2::Zero;
+                framesLeft = lifetimeFrames;
+            }
+
+            virtual void OnUpdate(float deltaTime) override
+            {
+                Transform* transform = GetTransform();
+                transform->SetPosition(transform->GetPosition() + velocity * deltaTime);
+
+                if (--framesLeft == 0)
+                {
+                    GameObject::Destroy(GetGameObject());
+                    ++*destroyedCount;
+                }
+            }
+        };
+
+        GameObject* CreateSprite(Scene* scene, BenchmarkContext& context, const Vector2& position, float size)
+        {
+            GameObject* gameObject = scene->CreateGameObject("Sprite");
+            gameObject->GetTransform()->SetPosition(position);
+
+            auto* spriteRenderer = gameObject->AddComponent<SpriteRenderer>();
+            if (!context.sprites.empty())
+            {
+                spriteRenderer->SetSprite(context.sprites[context.random() % context.sprites.size()]);
+            }
+            spriteRenderer->SetSize(Vector2(size, size));
+            return gameObject;
+        }
+
+        void BuildStaticSprites(Scene* scene, BenchmarkContext& context)
+        {
+            // 100 x 100 grid
+            for (int y = 0; y < 100; ++y)
+            {
+                for (int x = 0; x < 100; ++x)
+                {
+                    CreateSprite(scene, context, Vector2(8.0f + x * 16.0f, 8.0f + y * 9.0f), 8.0f);
+                }
+            }
+        }
+
+        void BuildCulledWorld(Scene* scene, BenchmarkContext& context)
+        {
+            const float width = kWorldWidth * kCulledWorldScale;
+            const float height = kWorldHeight * kCulledWorldScale;
+            for (int i = 0; i < kCulledWorldSprites; ++i)
+            {
+                CreateSprite(scene, context, Vector2(context.RandomRange(0.0f, width), context.RandomRange(0.0f, height)), 8.0f);
+            }
+
+            GameObject* camera = scene->CreateGameObject("Camera");
+            camera->GetTransform()->SetPosition(Vector2(width * 0.5f, height * 0.5f));
+            camera->AddComponent<Camera>();
+        }
+
+        void BuildMovingSprites(Scene* scene, BenchmarkContext& context)
+        {
+            for (int i = 0; i < 50000; ++i)
+            {
+                const Vector2 center(context.RandomRange(0.0f, kWorldWidth), context.RandomRange(0.0f, kWorldHeight));
+                GameObject* gameObject = CreateSprite(scene, context, center, 4.0f);
+                gameObject->AddComponent<Orbiter>(center, context.RandomRange(5.0f, 60.0f),
+                    context.RandomRange(-3.0f, 3.0f), context.RandomRange(0.0f, kTwoPi));
+            }
+        }
+
+        void BuildCollidingBodies(Scene* scene, BenchmarkContext& context)
+        {
+            // Static walls: colliders without a Rigidbody never move
+            const Vector2 wallCenters[4] = {
+                Vector2(kWorldWidth * 0.5f, kWorldHeight + 25.0f), Vector2(kWorldWidth * 0.5f, -25.0f),
+                Vector2(-25.0f, kWorldHeight * 0.5f), Vector2(kWorldWidth + 25.0f, kWorldHeight * 0.5f)
+            };
+            const Vector2 wallSizes[4] = {
+                Vector2(kWorldWidth + 100.0f, 50.0f), Vector2(kWorldWidth + 100.0f, 50.0f),
+                Vector2(50.0f, kWorldHeight + 100.0f), Vector2(50.0f, kWorldHeight + 100.0f)
+            };
+            for (int i = 0; i < 4; ++i)
+            {
+                GameObject* wall = scene->CreateGameObject("Wall");
+                wall->GetTransform()->SetPosition(wallCenters[i]);
+                wall->AddComponent<BoxCollider>()->SetSize(wallSizes[i]);
+            }
+
+            for (int i = 0; i < 2000; ++i)
+            {
+                const Vector2 position(context.RandomRange(20.0f, kWorldWidth - 20.0f), context.RandomRange(20.0f, kWorldHeight - 20.0f));
+                GameObject* gameObject = CreateSprite(scene, context, position, 10.0f);
+
+                if (i % 2 == 0)
+                {
+                    gameObject->AddComponent<BoxCollider>()->SetSize(Vector2(10.0f, 10.0f));
+                }
+                else
+                {
+                    gameObject->AddComponent<CircleCollider>()->SetRadius(5.0f);
+                }
+
+                auto* body = gameObject->AddComponent<Rigidbody>();
+                body->SetFreezeRotation(true);
+                // No gravity: bodies stay spread over the box, so the pair count holds steady across the run
+                body->SetUseGravity(false);
+                body->SetVelocity(Vector2(context.RandomRange(-150.0f, 150.0f), context.RandomRange(-150.0f, 150.0f)));
+            }
+        }
+
+        void BuildDeepHierarchy(Scene* scene, BenchmarkContext& context)
+        {
+            // 100 chains, 50 levels each; every node spins so all world matrices go stale each frame
+            for (int chain = 0; chain < 100; ++chain)
+            {
+                GameObject* parent = nullptr;
+                for (int depth = 0; depth < 50; ++depth)
+                {
+                    const Vector2 root((chain % 10 + 0.5f) * kWorldWidth / 10.0f, (chain / 10 + 0.5f) * kWorldHeight / 10.0f);
+                    GameObject* node = CreateSprite(scene, context, root, 4.0f);
+                    if (parent)
+                    {
+                        node->SetParent(parent);
+                        node->GetTransform()->SetLocalPosition(6.0f, 0.0f);
+                    }
+                    node->AddComponent<Spinner>(context.RandomRange(-30.0f, 30.0f));
+                    parent = node;
+                }
+            }
+        }
+
+        void BuildAnimators(Scene* scene, BenchmarkContext& context)
+        {
+            if (!context.animationClip)
+            {
+                context.animationClip = std::make_shared<AnimationClip>("BenchmarkCycle");
+                for (const auto& sprite : context.sprites)
+                {
+                    context.animationClip->AddFrame(sprite, 1.0f / 12.0f);
+                }
+            }
+
+            for (int i = 0; i < 1000; ++i)
+            {
+                const Vector2 position(context.RandomRange(0.0f, kWorldWidth), context.RandomRange(0.0f, kWorldHeight));
+                GameObject* gameObject = CreateSprite(scene, context, position, 16.0f);
+
+                auto* animator = gameObject->AddComponent<Animator>();
+                animator->AddAnimation("Cycle", context.animationClip);
+                animator->SetSpeed(context.RandomRange(0.5f, 2.0f));
+            }
+        }
+
+        // Clips only load from files: a half-second 16-bit mono sine, written, loaded and removed
+        std::shared_ptr<AudioClip> CreateToneClip()
+        {
+            const char* path = "benchmark_tone.wav";
+            const uint32_t frames = kToneRate / 2;
+            const uint32_t dataBytes = frames * sizeof(int16_t);
+            {
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if (!file.is_open()) return nullptr;
+
+                auto write32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), 4); };
+                auto write16 = [&file](uint16_t value) { file.write(reinterpret_cast<const char*>(&value), 2); };
+                file.write("RIFF", 4);
+                write32(36 + dataBytes);
+                file.write("WAVEfmt ", 8);
+                write32(16);
+                write16(1);                                     // PCM
+                write16(1);                                     // mono
+                write32(kToneRate);
+                write32(kToneRate * sizeof(int16_t));
+                write16(sizeof(int16_t));
+                write16(16);
+                file.write("data", 4);
+                write32(dataBytes);
+                for (uint32_t i = 0; i < frames; ++i)
+                {
+                    // 440 Hz: 220 whole cycles, so the loop point is seamless
+                    write16(static_cast<uint16_t>(static_cast<int16_t>(std::sin(kTwoPi * 440.0f * i / kToneRate) * 8000.0f)));
+                }
+            }
+
+            auto clip = std::make_shared<AudioClip>();
+            const bool loaded = clip->LoadFromFile(path);
+            std::remove(path);
+            return loaded ? clip : nullptr;
+        }
+
+        void BuildSpatialAudio(Scene* scene, BenchmarkContext& context)
+        {
+            if (!context.audioClip)
+            {
+                context.audioClip = CreateToneClip();
+            }
+
+            const Vector2 center(kWorldWidth * 0.5f, kWorldHeight * 0.5f);
+            GameObject* listener = scene->CreateGameObject("Listener");
+            listener->GetTransform()->SetPosition(center);
+            listener->AddComponent<AudioListener>();
+
+            // Orbiting emitters change distance, pan and radial speed every frame. The mixer has
+            // AudioMixer::kMaxVoices voices; the other sources are still gathered and skipped.
+            for (int i = 0; i < kAudioEmitters; ++i)
+            {
+                const Vector2 orbitCenter(context.RandomRange(0.0f, kWorldWidth), context.RandomRange(0.0f, kWorldHeight));
+                GameObject* gameObject = scene->CreateGameObject("Emitter");
+                gameObject->GetTransform()->SetPosition(orbitCenter);
+                gameObject->AddComponent<Orbiter>(orbitCenter, context.RandomRange(20.0f, 200.0f),
+                    context.RandomRange(-3.0f, 3.0f), context.RandomRange(0.0f, kTwoPi));
+
+                auto* source = gameObject->AddComponent<AudioSource>();
+                source->SetClip(context.audioClip);
+                source->SetLoop(true);
+                source->SetSpatialBlend(1.0f);
+                source->SetMinDistance(50.0f);
+                source->SetMaxDistance(1200.0f);
+                source->SetVolume(0.05f);
+                source->Play();
+            }
+        }
+
+        void BuildWorldStreaming(Scene* scene, BenchmarkContext& context)
+        {
+            std::error_code error;
+            context.worldDirectory = (std::filesystem::temp_directory_path(error) / "aron_benchmark_world").string();
+            std::filesystem::remove_all(context.worldDirectory, error);
+
+            {
+                // Built outside the benchmark scene: only what streams in should end up there
+                Scene source("world_streaming_source");
+                for (int cy = 0; cy < kStreamCellsY; ++cy)
+                {
+                    for (int cx = 0; cx < kStreamCellsX; ++cx)
+                    {
+                        for (int i = 0; i < kStreamRootsPerCell; ++i)
+                        {
+                            const Vector2 position((cx + context.RandomRange(0.1f, 0.9f)) * kStreamCellSize,
+                                (cy + context.RandomRange(0.1f, 0.9f)) * kStreamCellSize);
+                            // Untextured: the shared sprites are in-memory textures a cell file can't name
+                            GameObject* root = source.CreateGameObject("Prop");
+                            root->GetTransform()->SetPosition(position);
+                            auto* spriteRenderer = root->AddComponent<SpriteRenderer>();
+                            spriteRenderer->SetColor(Color(context.RandomRange(0.2f, 1.0f), context.RandomRange(0.2f, 1.0f), 0.5f, 1.0f));
+                            spriteRenderer->SetSize(Vector2(12.0f, 12.0f));
+                            for (int c = 0; c < 2; ++c)
+                            {
+                                GameObject* child = source.CreateGameObject("Decoration");
+                                child->SetParent(root);
+                                child->GetTransform()->SetLocalPosition(c == 0 ? -10.0f : 10.0f, -10.0f);
+                                child->AddComponent<SpriteRenderer>()->SetSize(Vector2(6.0f, 6.0f));
+                            }
+                        }
+                    }
+                }
+
+                if (!WorldPartition::Build(source, context.worldDirectory, kStreamCellSize))
+                {
+                    context.checkFailure = "WorldPartition::Build failed in " + context.worldDirectory;
+                    return;
+                }
+            }
+
+            // A cell that can't load must end up Failed, not be retried every frame
+            {
+                std::ofstream broken(context.worldDirectory + "/cell_" + std::to_string(kStreamBrokenCellX) + "_"
+                    + std::to_string(kStreamBrokenCellY) + ".scene", std::ios::binary | std::ios::trunc);
+                broken << "not a scene";
+            }
+
+            context.worldPartition = std::make_unique<WorldPartition>();
+            WorldPartition& partition = *context.worldPartition;
+            if (!partition.Open(context.worldDirectory, scene))
+            {
+                context.checkFailure = "WorldPartition::Open failed in " + context.worldDirectory;
+                context.worldPartition.reset();
+                return;
+            }
+
+            // Every cell holds the same objects, so any whole cell gives the per-cell estimate
+            WorldPartition::Settings settings;
+            settings.loadRadius = 1.5f * kStreamCellSize;
+            settings.unloadRadius = 2.5f * kStreamCellSize;
+            settings.memoryBudget = kStreamBudgetCells * partition.GetCellMemory(0, 0);
+            partition.SetSettings(settings);
+            partition.SetFocusPosition(Vector2(0.0f, kStreamFocusY));
+
+            context.counters["stream_cells_total"] = partition.GetCellCount();
+            context.counters["stream_memory_budget"] = static_cast<double>(settings.memoryBudget);
+        }
+
+        void TickWorldStreaming(Scene* scene, BenchmarkContext& context)
+        {
+            if (!context.worldPartition || !context.checkFailure.empty()) return;
+            WorldPartition& partition = *context.worldPartition;
+
+            // Last frame's unloads have been destroyed by now and its activations have joined
+            const int loaded = partition.GetLoadedCellCount();
+            if (scene->GetGameObjectCount() != loaded * kStreamObjectsPerCell)
+            {
+                context.checkFailure = std::to_string(scene->GetGameObjectCount()) + " objects in the scene with "
+                    + std::to_string(loaded) + " cells loaded, expected " + std::to_string(loaded * kStreamObjectsPerCell);
+                return;
+            }
+
+            // Back and forth along one row of cells
+            const float span = kStreamCellsX * kStreamCellSize;
+            context.worldTravelled = std::fmod(context.worldTravelled + kStreamFocusSpeed, 2.0f * span);
+            const float x = context.worldTravelled < span ? context.worldTravelled : 2.0f * span - context.worldTravelled;
+            partition.SetFocusPosition(Vector2(x, kStreamFocusY));
+            partition.Update();
+
+            const WorldPartition::Settings& settings = partition.GetSettings();
+            if (partition.GetResidentMemory() > settings.memoryBudget)
+            {
+                context.checkFailure = "resident memory " + std::to_string(partition.GetResidentMemory())
+                    + " over the budget of " + std::to_string(settings.memoryBudget);
+                return;
+            }
+
+            const bool brokenFailed = partition.GetCellState(kStreamBrokenCellX, kStreamBrokenCellY) == WorldPartition::CellState::Failed;
+            if (context.counters["stream_cells_failed"] > 0.0 && !brokenFailed)
+            {
+                context.checkFailure = "the unreadable cell was retried after it failed";
+                return;
+            }
+            context.counters["stream_cells_failed"] = brokenFailed ? 1.0 : 0.0;
+
+            double& loadedMax = context.counters["stream_cells_loaded_max"];
+            double& loadingMax = context.counters["stream_cells_loading_max"];
+            double& residentMax = context.counters["stream_resident_bytes_max"];
+            loadedMax = (std::max)(loadedMax, static_cast<double>(partition.GetLoadedCellCount()));
+            loadingMax = (std::max)(loadingMax, static_cast<double>(partition.GetLoadingCellCount()));
+            residentMax = (std::max)(residentMax, static_cast<double>(partition.GetResidentMemory()));
+        }
+
+        void BuildChurn(Scene* scene, BenchmarkContext& context)
+        {
+            context.liveObjects.reserve(kChurnLiveTarget + kChurnPerFrame);
+        }
+
+        void TickChurn(Scene* scene, BenchmarkContext& context)
+        {
+            // Spawn through the public API against the active scene, retire the oldest once full
+            for (int i = 0; i < kChurnPerFrame; ++i)
+            {
+                GameObject* gameObject = GameObject::Instantiate("Churn");
+                if (!gameObject) return;
+
+                gameObject->GetTransform()->SetPosition(context.RandomRange(0.0f, kWorldWidth), context.RandomRange(0.0f, kWorldHeight));
+                auto* spriteRenderer = gameObject->AddComponent<SpriteRenderer>();
+                if (!context.sprites.empty())
+                {
+                    spriteRenderer->SetSprite(context.sprites[context.random() % context.sprites.size()]);
+                }
+                spriteRenderer->SetSize(Vector2(6.0f, 6.0f));
+
+                context.liveObjects.push_back(gameObject);
+                ++context.instantiated;
+            }
+
+            const int excess = static_cast<int>(context.liveObjects.size()) - kChurnLiveTarget;
+            if (excess > 0)
+            {
+                for (int i = 0; i < excess; ++i)
+                {
+                    GameObject::Destroy(context.liveObjects[i]);
+                }
+                context.liveObjects.erase(context.liveObjects.begin(), context.liveObjects.begin() + excess);
+                context.destroyed += excess;
+            }
+        }
+
+        void TickBullets(Scene* scene, BenchmarkContext& context)
+        {
+            // Short-lived objects with three allocations each (object, transform, components):
+            // the allocator pattern of projectiles and particles
+            const Vector2 muzzle(kWorldWidth * 0.5f, kWorldHeight * 0.5f);
+            for (int i = 0; i < kBulletsPerFrame; ++i)
+            {
+                GameObject* gameObject = GameObject::Instantiate("Bullet");
+                if (!gameObject) return;
+
+                const float angle = context.RandomRange(0.0f, kTwoPi);
+                gameObject->GetTransform()->SetPosition(muzzle);
+                auto* spriteRenderer = gameObject->AddComponent<SpriteRenderer>();
+                if (!context.sprites.empty())
+                {
+                    spriteRenderer->SetSprite(context.sprites[context.random() % context.sprites.size()]);
+                }
+                spriteRenderer->SetSize(Vector2(3.0f, 3.0f));
+                gameObject->AddComponent<Bullet>(kBulletLifetimeFrames, &context.destroyed)
+                    ->Fire(Vector2(std::cos(angle), std::sin(angle)) * context.RandomRange(200.0f, 600.0f));
+
+                ++context.instantiated;
+            }
+        }
+
+        void BuildBulletPool(Scene* scene, BenchmarkContext& context)
+        {
+            // Sprite choice is part of the template here; the churn scene picks one per spawn
+            std::shared_ptr<Sprite> sprite = context.sprites.empty() ? nullptr : context.sprites[context.random() % context.sprites.size()];
+            int* destroyed = &context.destroyed;
+            scene->CreatePool("Bullet", [sprite, destroyed](GameObject* gameObject)
+            {
+                auto* spriteRenderer = gameObject->AddComponent<SpriteRenderer>();
+                spriteRenderer->SetSprite(sprite);
+                spriteRenderer->SetSize(Vector2(3.0f, 3.0f));
+                gameObject->AddComponent<Bullet>(kBulletLifetimeFrames, destroyed);
+            }, kBulletsPerFrame * (kBulletLifetimeFrames + 1));
+        }
+
+        void TickBulletPool(Scene* scene, BenchmarkContext& context)
+        {
+            // Same spawn pattern as bullet_churn; Destroy hands the bullets back to the pool
+            GameObjectPool* pool = scene->FindPool("Bullet");
+            const Vector2 muzzle(kWorldWidth * 0.5f, kWorldHeight * 0.5f);
+            for (int i = 0; i < kBulletsPerFrame; ++i)
+            {
+                GameObject* gameObject = pool->Acquire(muzzle);
+                const float angle = context.RandomRange(0.0f, kTwoPi);
+                gameObject->GetComponent<Bullet>()->Fire(Vector2(std::cos(angle), std::sin(angle)) * context.RandomRange(200.0f, 600.0f));
+
+                ++context.instantiated;
+            }
+        }
+    }
+
+    const std::vector<BenchmarkScene>& GetBenchmarkScenes()
+    {
+        static const std::vector<BenchmarkScene> scenes = {
+            { "static_sprites_10k", "10,000 static sprites on a grid", BuildStaticSprites, nullptr },
+            { "culled_world_200k", "200,000 static sprites over a world 50x the view; one camera sees about 2%", BuildCulledWorld, nullptr },
+            { "moving_sprites_50k", "50,000 sprites moved by a component every frame", BuildMovingSprites, nullptr },
+            { "colliding_bodies_2k", "2,000 dynamic box/circle bodies bouncing in a walled box, no gravity", BuildCollidingBodies, nullptr },
+            { "deep_hierarchy", "100 transform chains, 50 levels deep, all spinning", BuildDeepHierarchy, nullptr },
+            { "animators_1k", "1,000 looping sprite animators", BuildAnimators, nullptr },
+            { "instantiate_churn", "200 Instantiate + 200 Destroy per frame, 2,000 live", BuildChurn, TickChurn },
+            { "bullet_churn", "500 bullets spawned per frame, each destroying itself after 20 frames", nullptr, TickBullets },
+            { "bullet_pool", "bullet_churn spawning from a prewarmed GameObjectPool", BuildBulletPool, TickBulletPool },
+            { "spatial_audio_1k", "1,000 orbiting 3D audio sources around a listener; the mixer voices the first 128", BuildSpatialAudio, nullptr },
+            { "world_streaming", "WorldPartition of 32x8 cells, 12,288 objects; the focus sweeps a row under a 24-cell memory budget", BuildWorldStreaming, TickWorldStreaming },
+        };
+        return scenes;
+    }
+}
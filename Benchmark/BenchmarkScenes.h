@@ -0,0 +1,56 @@
+#pragma once
+#include "Core/framework.h"
+#include "Managers/WorldPartition.h"
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    class Scene;
+    class GameObject;
+    class AnimationClip;
+    class AudioClip;
+    struct Sprite;
+
+    // Shared state for building and ticking one benchmark scene
+    struct BenchmarkContext
+    {
+        std::vector<std::shared_ptr<Sprite>> sprites;   // solid-colour sprites, may be empty without a renderer
+        std::shared_ptr<AnimationClip> animationClip;
+        std::shared_ptr<AudioClip> audioClip;           // looping tone, null if it could not be written
+        std::mt19937 random;
+
+        // Churn bookkeeping, reported as counters
+        std::vector<GameObject*> liveObjects;
+        int instantiated = 0;
+        int destroyed = 0;
+
+        // Streamed world: closed and its directory removed before the scene is unloaded
+        std::unique_ptr<WorldPartition> worldPartition;
+        std::string worldDirectory;
+        float worldTravelled = 0.0f;                    // focus distance along its path so far
+
+        // Scene-specific counters, reported as they are; a broken scene check leaves a message
+        std::map<std::string, double> counters;
+        std::string checkFailure;
+
+        float RandomRange(float minValue, float maxValue)
+        {
+            return std::uniform_real_distribution<float>(minValue, maxValue)(random);
+        }
+    };
+
+    struct BenchmarkScene
+    {
+        const char* name;
+        const char* description;
+        void (*build)(Scene* scene, BenchmarkContext& context);   // may be null for scenes filled by tick
+        void (*tick)(Scene* scene, BenchmarkContext& context);    // per frame before the engine update; may be null
+    };
+
+    // The standard stress scenes, in run order
+    const std::vector<BenchmarkScene>& GetBenchmarkScenes();
+}
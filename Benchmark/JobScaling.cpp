@@ -0,0 +1,284 @@
+#include "JobScaling.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr uint32_t kTransformCount = 1000000;
+        constexpr uint32_t kHeavyCount = 65536;
+        constexpr int kHeavySteps = 256;
+        constexpr uint32_t kTinyJobCount = 16384;
+
+        struct TransformInput
+        {
+            float x, y, rotation, scaleX, scaleY;
+        };
+
+        struct TransformOutput
+        {
+            float m11, m12, m21, m22, dx, dy;
+        };
+
+        struct WorkloadData
+        {
+            std::vector<TransformInput> inputs;
+            std::vector<TransformOutput> outputs;
+            std::vector<float> values;
+            std::atomic<uint32_t> tinyCounter{ 0 };
+        };
+
+        struct Workload
+        {
+            const char* name;
+            const char* description;
+            void (*run)(JobSystem& jobs, WorkloadData& data);
+        };
+
+        void RunTransforms(JobSystem& jobs, WorkloadData& data)
+        {
+            const TransformInput* inputs = data.inputs.data();
+            TransformOutput* outputs = data.outputs.data();
+
+            jobs.ParallelFor(kTransformCount, 1024, [inputs, outputs](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    const TransformInput& in = inputs[i];
+                    const float c = std::cos(in.rotation);
+                    const float s = std::sin(in.rotation);
+                    outputs[i] = { c * in.scaleX, s * in.scaleX, -s * in.scaleY, c * in.scaleY, in.x, in.y };
+                }
+            });
+        }
+
+        void RunHeavy(JobSystem& jobs, WorkloadData& data)
+        {
+            float* values = data.values.data();
+
+            jobs.ParallelFor(kHeavyCount, 64, [values](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    float v = static_cast<float>(i) + 1.0f;
+                    for (int step = 0; step < kHeavySteps; ++step)
+                    {
+                        v = std::sqrt(v * 1.0001f + 1.0f);
+                    }
+                    values[i] = v;
+                }
+            });
+        }
+
+        void RunTinyJobs(JobSystem& jobs, WorkloadData& data)
+        {
+            // Scheduling overhead: one Run per job, almost no work in each
+            JobCounter counter;
+            for (uint32_t i = 0; i < kTinyJobCount; ++i)
+            {
+                jobs.Run([](void* userData, uint32_t begin, uint32_t end)
+                {
+                    static_cast<std::atomic<uint32_t>*>(userData)->fetch_add(end - begin, std::memory_order_relaxed);
+                }, &data.tinyCounter, i, i + 1, &counter);
+
+                // Stay inside the per-thread job ring
+                if ((i & (JobSystem::kJobPoolSize / 2 - 1)) == JobSystem::kJobPoolSize / 2 - 1)
+                {
+                    jobs.Wait(counter);
+                }
+            }
+            jobs.Wait(counter);
+        }
+
+        void RunDependentPhases(JobSystem& jobs, WorkloadData& data)
+        {
+            // Phase B reads what phase A wrote, chained through a counter instead of a sync point
+            float* values = data.values.data();
+            const uint32_t batch = jobs.GetBatchSize(kHeavyCount, 256);
+
+            JobCounter phaseA;
+            for (uint32_t begin = 0; begin < kHeavyCount; begin += batch)
+            {
+                jobs.Run([](void* userData, uint32_t first, uint32_t last)
+                {
+                    float* out = static_cast<float*>(userData);
+                    for (uint32_t i = first; i < last; ++i) out[i] = std::sqrt(static_cast<float>(i));
+                }, values, begin, (std::min)(begin + batch, kHeavyCount), &phaseA);
+            }
+
+            JobCounter phaseB;
+            for (uint32_t begin = 0; begin < kHeavyCount; begin += batch)
+            {
+                jobs.Run([](void* userData, uint32_t first, uint32_t last)
+                {
+                    float* out = static_cast<float*>(userData);
+                    for (uint32_t i = first; i < last; ++i) out[i] = out[i] * out[i] + 1.0f;
+                }, values, begin, (std::min)(begin + batch, kHeavyCount), &phaseB, &phaseA);
+            }
+            jobs.Wait(phaseB);
+        }
+
+        const Workload kWorkloads[] = {
+            { "transform_1m", "1M sprite transforms (sin/cos + 2x3 matrix) via ParallelFor", &RunTransforms },
+            { "compute_heavy", "64K elements x 256 dependent sqrt steps via ParallelFor", &RunHeavy },
+            { "tiny_jobs", "16K single-element Run calls; measures scheduling overhead", &RunTinyJobs },
+            { "dependent_phases", "Two 64K-element phases chained by a counter dependency", &RunDependentPhases }
+        };
+
+        float Median(std::vector<float> values)
+        {
+            if (values.empty()) return 0.0f;
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+    }
+
+    JobScalingBenchmark::JobScalingBenchmark()
+        : maxThreads(0)
+        , iterations(20)
+        , warmupIterations(3)
+    {
+    }
+
+    void JobScalingBenchmark::Configure(int threads, int measured, int warmup)
+    {
+        maxThreads = threads;
+        iterations = (std::max)(1, measured);
+        warmupIterations = (std::max)(0, warmup);
+    }
+
+    void JobScalingBenchmark::Run()
+    {
+        int threadLimit = maxThreads;
+        if (threadLimit <= 0)
+        {
+            threadLimit = (std::max)(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        WorkloadData data;
+        data.inputs.resize(kTransformCount);
+        data.outputs.resize(kTransformCount);
+        data.values.resize(kHeavyCount);
+        for (uint32_t i = 0; i < kTransformCount; ++i)
+        {
+            const float f = static_cast<float>(i);
+            data.inputs[i] = { f, f * 0.5f, f * 0.001f, 1.0f + (i % 7) * 0.1f, 1.0f + (i % 5) * 0.1f };
+        }
+
+        results.clear();
+        for (const Workload& workload : kWorkloads)
+        {
+            WorkloadResult result;
+            result.name = workload.name;
+            result.description = workload.description;
+            results.push_back(result);
+        }
+
+        // Whatever the caller had running is restored afterwards
+        JobSystem& jobs = JobSystem::GetInstance();
+        const bool wasInitialized = jobs.IsInitialized();
+        const int previousWorkers = static_cast<int>(jobs.GetThreadCount()) - 1;
+
+        for (int threads = 1; threads <= threadLimit; ++threads)
+        {
+            jobs.Shutdown();
+            jobs.Initialize(threads - 1);
+
+            for (size_t w = 0; w < results.size(); ++w)
+            {
+                std::vector<float> times;
+                times.reserve(iterations);
+
+                for (int i = 0; i < warmupIterations + iterations; ++i)
+                {
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    kWorkloads[w].run(jobs, data);
+                    const auto end = std::chrono::high_resolution_clock::now();
+
+                    if (i >= warmupIterations)
+                    {
+                        times.push_back(std::chrono::duration<float, std::milli>(end - start).count());
+                    }
+                }
+
+                Sample sample;
+                sample.threads = threads;
+                sample.ms = Median(times);
+                const float baseline = results[w].samples.empty() ? sample.ms : results[w].samples.front().ms;
+                sample.speedup = sample.ms > 0.0f ? baseline / sample.ms : 0.0f;
+                sample.efficiency = sample.speedup / threads;
+                results[w].samples.push_back(sample);
+            }
+        }
+
+        jobs.Shutdown();
+        if (wasInitialized)
+        {
+            jobs.Initialize(previousWorkers);
+        }
+    }
+
+    void JobScalingBenchmark::PrintTable() const
+    {
+        for (const auto& result : results)
+        {
+            std::printf("\n%s - %s\n", result.name.c_str(), result.description.c_str());
+            std::printf("%8s %10s %10s %10s\n", "threads", "ms", "speedup", "eff");
+            for (const auto& sample : result.samples)
+            {
+                std::printf("%8d %10.3f %9.2fx %9.0f%%\n", sample.threads, sample.ms, sample.speedup, sample.efficiency * 100.0f);
+            }
+        }
+    }
+
+    bool JobScalingBenchmark::WriteResults(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(4);
+        out << "{\n";
+#ifdef _DEBUG
+        out << "  \"config\": \"Debug\",\n";
+#else
+        out << "  \"config\": \"Release\",\n";
+#endif
+        out << "  \"iterations\": " << iterations << ",\n";
+        out << "  \"warmup\": " << warmupIterations << ",\n";
+        out << "  \"workloads\": [\n";
+
+        for (size_t w = 0; w < results.size(); ++w)
+        {
+            const WorkloadResult& result = results[w];
+            out << "    {\n";
+            out << "      \"name\": \"" << result.name << "\",\n";
+            out << "      \"description\": \"" << result.description << "\",\n";
+            out << "      \"results\": [\n";
+            for (size_t s = 0; s < result.samples.size(); ++s)
+            {
+                const Sample& sample = result.samples[s];
+                out << "        { \"threads\": " << sample.threads
+                    << ", \"ms\": " << sample.ms
+                    << ", \"speedup\": " << sample.speedup
+                    << ", \"efficiency\": " << sample.efficiency << " }"
+                    << (s + 1 < result.samples.size() ? ",\n" : "\n");
+            }
+            out << "      ]\n";
+            out << "    }" << (w + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n";
+        out << "}\n";
+        return true;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    // Measures JobSystem throughput on fixed workloads from 1 thread up to maxThreads
+    class JobScalingBenchmark
+    {
+    public:
+        struct Sample
+        {
+            int threads;
+            float ms;           // median over the measured iterations
+            float speedup;      // relative to the 1-thread run
+            float efficiency;   // speedup / threads
+        };
+
+        struct WorkloadResult
+        {
+            std::string name;
+            std::string description;
+            std::vector<Sample> samples;
+        };
+
+    private:
+        int maxThreads;
+        int iterations;
+        int warmupIterations;
+        std::vector<WorkloadResult> results;
+
+    public:
+        JobScalingBenchmark();
+
+        // maxThreads <= 0 uses hardware_concurrency
+        void Configure(int maxThreads, int iterations, int warmup);
+        void Run();
+
+        const std::vector<WorkloadResult>& GetResults() const { return results; }
+        void PrintTable() const;
+        bool WriteResults(const std::string& filePath) const;
+    };
+}
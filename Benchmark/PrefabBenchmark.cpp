@@ -0,0 +1,276 @@
+#include "PrefabBenchmark.h"
+#include "Core/Scene.h"
+#include "Core/GameObject.h"
+#include "Managers/SceneManager.h"
+#include "Components/Transform.h"
+#include "Components/SpriteRenderer.h"
+#include "Components/Rigidbody.h"
+#include "Components/Collider.h"
+#include "Components/Animator.h"
+#include "Resources/AnimationClip.h"
+#include "Resources/Prefab.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+namespace AronEngine
+{
+    namespace
+    {
+        // Gameplay settings of the kind a wave spawner stamps out: plain values only
+        class EnemyBrain : public Component
+        {
+        private:
+            float health;
+            float speed;
+            float aggroRadius;
+            float attackCooldown;
+            int damage;
+            int scoreValue;
+            int team;
+
+        public:
+            EnemyBrain()
+                : Component("EnemyBrain")
+                , health(100.0f)
+                , speed(60.0f)
+                , aggroRadius(200.0f)
+                , attackCooldown(1.0f)
+                , damage(10)
+                , scoreValue(50)
+                , team(0)
+            {
+            }
+
+            void SetHealth(float value) { health = value; }
+            void SetSpeed(float value) { speed = value; }
+            void SetAggroRadius(float value) { aggroRadius = value; }
+            void SetAttackCooldown(float value) { attackCooldown = value; }
+            void SetDamage(int value) { damage = value; }
+            void SetScoreValue(int value) { scoreValue = value; }
+            void SetTeam(int value) { team = value; }
+        };
+
+        std::shared_ptr<AnimationClip> GetWalkClip()
+        {
+            static std::shared_ptr<AnimationClip> clip = std::make_shared<AnimationClip>("Walk");
+            return clip;
+        }
+
+        GameObject* BuildSprite(Scene* scene, const Vector2& position)
+        {
+            GameObject* go = scene->CreateGameObject("Sprite");
+            go->GetTransform()->SetPosition(position);
+
+            SpriteRenderer* renderer = go->AddComponent<SpriteRenderer>();
+            renderer->SetColor(Color(0.9f, 0.3f, 0.3f, 1.0f));
+            renderer->SetSize(Vector2(24, 24));
+            renderer->SetSortingOrder(2);
+            return go;
+        }
+
+        GameObject* BuildBody(Scene* scene, const Vector2& position)
+        {
+            GameObject* go = BuildSprite(scene, position);
+            go->SetTag("Enemy");
+            go->SetLayer(3);
+
+            go->AddComponent<BoxCollider>()->SetSize(Vector2(24, 24));
+            Rigidbody* body = go->AddComponent<Rigidbody>();
+            body->SetMass(2.0f);
+            body->SetDrag(0.5f);
+            body->SetUseGravity(false);
+            return go;
+        }
+
+        GameObject* BuildEnemy(Scene* scene, const Vector2& position)
+        {
+            GameObject* go = BuildBody(scene, position);
+
+            Animator* animator = go->AddComponent<Animator>();
+            animator->AddAnimation("Walk", GetWalkClip());
+            animator->SetSpeed(1.5f);
+
+            EnemyBrain* brain = go->AddComponent<EnemyBrain>();
+            brain->SetHealth(250.0f);
+            brain->SetSpeed(80.0f);
+            brain->SetAggroRadius(320.0f);
+            brain->SetAttackCooldown(0.75f);
+            brain->SetDamage(15);
+            brain->SetScoreValue(100);
+            brain->SetTeam(1);
+            return go;
+        }
+
+        GameObject* BuildSquad(Scene* scene, const Vector2& position)
+        {
+            // Leader plus three escorts parented to it
+            GameObject* leader = BuildEnemy(scene, position);
+            for (int i = 0; i < 3; ++i)
+            {
+                GameObject* escort = scene->CreateGameObject("Escort");
+                escort->SetParent(leader);
+                escort->GetTransform()->SetLocalPosition(Vector2(-30.0f + 30.0f * i, 40.0f));
+
+                SpriteRenderer* renderer = escort->AddComponent<SpriteRenderer>();
+                renderer->SetColor(Color(0.3f, 0.3f, 0.9f, 1.0f));
+                renderer->SetSize(Vector2(16, 16));
+                escort->AddComponent<CircleCollider>()->SetRadius(8.0f);
+            }
+            return leader;
+        }
+
+        struct Variant
+        {
+            const char* name;
+            const char* description;
+            GameObject* (*build)(Scene* scene, const Vector2& position);
+        };
+
+        const Variant kVariants[] =
+        {
+            { "sprite", "SpriteRenderer", &BuildSprite },
+            { "body", "SpriteRenderer, BoxCollider, Rigidbody", &BuildBody },
+            { "enemy", "body + Animator + gameplay component", &BuildEnemy },
+            { "squad", "enemy leader with 3 collider escorts", &BuildSquad },
+        };
+
+        int CountObjects(const GameObject* root, int& components)
+        {
+            components += static_cast<int>(root->GetAllComponents().size());
+            int objects = 1;
+            for (const GameObject* child : root->GetChildren())
+            {
+                objects += CountObjects(child, components);
+            }
+            return objects;
+        }
+
+        float Median(std::vector<float> values)
+        {
+            if (values.empty()) return 0.0f;
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+    }
+
+    PrefabBenchmark::PrefabBenchmark()
+        : instanceCount(1000)
+        , iterations(20)
+        , warmupIterations(3)
+    {
+    }
+
+    void PrefabBenchmark::Configure(int count, int measured, int warmup)
+    {
+        instanceCount = (std::max)(1, count);
+        iterations = (std::max)(1, measured);
+        warmupIterations = (std::max)(0, warmup);
+    }
+
+    void PrefabBenchmark::Run(SceneManager* sceneManager)
+    {
+        results.clear();
+        if (!sceneManager)
+            return;
+
+        for (const Variant& variant : kVariants)
+        {
+            Result result;
+            result.name = variant.name;
+            result.description = variant.description;
+
+            // The prefab is captured from a hand-built instance, so both paths produce the same objects
+            Scene* templateScene = sceneManager->CreateScene("prefab_template");
+            GameObject* templateObject = variant.build(templateScene, Vector2(0, 0));
+            result.componentsPerInstance = 0;
+            result.objectsPerInstance = CountObjects(templateObject, result.componentsPerInstance);
+            std::shared_ptr<Prefab> prefab = Prefab::CreateFromGameObject(templateObject);
+            sceneManager->UnloadScene(templateScene);
+
+            std::vector<float> manualTimes;
+            std::vector<float> prefabTimes;
+            manualTimes.reserve(iterations);
+            prefabTimes.reserve(iterations);
+
+            for (int i = 0; i < warmupIterations + iterations; ++i)
+            {
+                for (int path = 0; path < 2; ++path)
+                {
+                    // Scene teardown happens outside the timed region
+                    Scene* scene = sceneManager->CreateScene("prefab_instantiate");
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    for (int n = 0; n < instanceCount; ++n)
+                    {
+                        const Vector2 position(static_cast<float>(n % 64) * 25.0f, static_cast<float>(n / 64) * 25.0f);
+                        if (path == 0) variant.build(scene, position);
+                        else prefab->Instantiate(scene, position);
+                    }
+                    const auto end = std::chrono::high_resolution_clock::now();
+                    sceneManager->UnloadScene(scene);
+
+                    if (i >= warmupIterations)
+                    {
+                        const float us = std::chrono::duration<float, std::micro>(end - start).count() / instanceCount;
+                        (path == 0 ? manualTimes : prefabTimes).push_back(us);
+                    }
+                }
+            }
+
+            result.manualUs = Median(manualTimes);
+            result.prefabUs = Median(prefabTimes);
+            result.speedup = result.prefabUs > 0.0f ? result.manualUs / result.prefabUs : 0.0f;
+            results.push_back(result);
+        }
+    }
+
+    void PrefabBenchmark::PrintTable() const
+    {
+        std::printf("\n%-10s %8s %11s %12s %12s %9s\n", "prefab", "objects", "components", "manual us", "prefab us", "speedup");
+        for (const auto& result : results)
+        {
+            std::printf("%-10s %8d %11d %12.3f %12.3f %8.2fx\n", result.name.c_str(), result.objectsPerInstance,
+                result.componentsPerInstance, result.manualUs, result.prefabUs, result.speedup);
+        }
+    }
+
+    bool PrefabBenchmark::WriteResults(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(4);
+        out << "{\n";
+#ifdef _DEBUG
+        out << "  \"config\": \"Debug\",\n";
+#else
+        out << "  \"config\": \"Release\",\n";
+#endif
+        out << "  \"instances\": " << instanceCount << ",\n";
+        out << "  \"iterations\": " << iterations << ",\n";
+        out << "  \"warmup\": " << warmupIterations << ",\n";
+        out << "  \"prefabs\": [\n";
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& result = results[i];
+            out << "    { \"name\": \"" << result.name << "\""
+                << ", \"description\": \"" << result.description << "\""
+                << ", \"objects\": " << result.objectsPerInstance
+                << ", \"components\": " << result.componentsPerInstance
+                << ", \"manual_us\": " << result.manualUs
+                << ", \"prefab_us\": " << result.prefabUs
+                << ", \"speedup\": " << result.speedup << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n";
+        out << "}\n";
+        return true;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    class SceneManager;
+
+    // Instantiate cost per prefab size: the same objects built with AddComponent and setters,
+    // then cloned from a Prefab captured off one of them
+    class PrefabBenchmark
+    {
+    public:
+        struct Result
+        {
+            std::string name;
+            std::string description;
+            int objectsPerInstance;
+            int componentsPerInstance;
+            float manualUs;     // median microseconds per instance
+            float prefabUs;
+            float speedup;      // manual / prefab
+        };
+
+    private:
+        int instanceCount;
+        int iterations;
+        int warmupIterations;
+        std::vector<Result> results;
+
+    public:
+        PrefabBenchmark();
+
+        void Configure(int instanceCount, int iterations, int warmup);
+        // Builds throwaway scenes through sceneManager; needs an initialized engine for the systems
+        void Run(SceneManager* sceneManager);
+
+        const std::vector<Result>& GetResults() const { return results; }
+        void PrintTable() const;
+        bool WriteResults(const std::string& filePath) const;
+    };
+}
@@ -0,0 +1,242 @@
+#include "SceneLoadBenchmark.h"
+#include "Core/Scene.h"
+#include "Core/GameObject.h"
+#include "Managers/SceneManager.h"
+#include "Components/Transform.h"
+#include "Components/SpriteRenderer.h"
+#include "Components/Rigidbody.h"
+#include "Components/Collider.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+
+namespace AronEngine
+{
+    namespace
+    {
+        void BuildScene(Scene* scene, int objectCount)
+        {
+            int created = 0;
+            while (created < objectCount)
+            {
+                const int n = created;
+                GameObject* go = scene->CreateGameObject("Object" + std::to_string(n));
+                go->GetTransform()->SetPosition(Vector2(static_cast<float>(n % 256) * 20.0f, static_cast<float>(n / 256) * 20.0f));
+                ++created;
+
+                SpriteRenderer* renderer = go->AddComponent<SpriteRenderer>();
+                renderer->SetColor(Color((n % 7) / 7.0f, (n % 5) / 5.0f, (n % 3) / 3.0f, 1.0f));
+                renderer->SetSize(Vector2(16.0f + n % 48, 16.0f + n % 32));
+
+                // A quarter are physics bodies, as platforms and pickups would be
+                if (n % 4 == 0)
+                {
+                    go->SetTag("Dynamic");
+                    go->AddComponent<BoxCollider>()->SetSize(renderer->GetSize());
+                    go->AddComponent<Rigidbody>()->SetMass(1.0f + n % 3);
+                }
+
+                // Every tenth carries two decorations, so parent indices get exercised
+                if (n % 10 == 0)
+                {
+                    for (int c = 0; c < 2 && created < objectCount; ++c, ++created)
+                    {
+                        GameObject* child = scene->CreateGameObject("Decoration");
+                        child->SetParent(go);
+                        child->GetTransform()->SetLocalPosition(Vector2(c == 0 ? -12.0f : 12.0f, -12.0f));
+                        child->AddComponent<SpriteRenderer>()->SetSize(Vector2(8, 8));
+                    }
+                }
+            }
+        }
+
+        float Median(std::vector<float> values)
+        {
+            if (values.empty()) return 0.0f;
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+
+        long long FileSize(const std::string& filePath)
+        {
+            std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+            return file.is_open() ? static_cast<long long>(file.tellg()) : 0;
+        }
+
+        bool ReadFile(const std::string& filePath, std::string& contents)
+        {
+            std::ifstream file(filePath, std::ios::binary);
+            if (!file.is_open()) return false;
+            contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return true;
+        }
+    }
+
+    SceneLoadBenchmark::SceneLoadBenchmark()
+        : objectCounts({ 10000, 100000, 1000000 })
+        , iterations(3)
+        , warmupIterations(1)
+        , filePrefix("scene_load_bench")
+        , lossless(false)
+    {
+    }
+
+    void SceneLoadBenchmark::Configure(const std::vector<int>& counts, int measured, int warmup)
+    {
+        objectCounts.clear();
+        for (int count : counts)
+        {
+            objectCounts.push_back((std::max)(1, count));
+        }
+        iterations = (std::max)(1, measured);
+        warmupIterations = (std::max)(0, warmup);
+    }
+
+    bool SceneLoadBenchmark::Run(SceneManager* sceneManager)
+    {
+        results.clear();
+        lossless = false;
+        if (!sceneManager)
+            return false;
+
+        const std::string jsonPath = filePrefix + ".json";
+        const std::string binaryPath = filePrefix + ".scene";
+        bool ok = true;
+
+        for (size_t c = 0; c < objectCounts.size() && ok; ++c)
+        {
+            Scene* source = sceneManager->CreateScene("scene_load_source");
+            BuildScene(source, objectCounts[c]);
+            const int objects = static_cast<int>(source->GetGameObjects().size());
+
+            const std::string paths[] = { jsonPath, binaryPath };
+            const char* formats[] = { "json", "binary" };
+            Result formatResults[2];
+            for (int f = 0; f < 2 && ok; ++f)
+            {
+                Result& result = formatResults[f];
+                result.objects = objects;
+                result.format = formats[f];
+
+                const auto start = std::chrono::high_resolution_clock::now();
+                ok = source->Save(paths[f]);
+                const auto end = std::chrono::high_resolution_clock::now();
+                result.saveMs = std::chrono::duration<float, std::milli>(end - start).count();
+                result.fileBytes = FileSize(paths[f]);
+            }
+            sceneManager->UnloadScene(source);
+
+            // The smallest scene doubles as the lossless check for the converters
+            if (ok && c == 0)
+            {
+                lossless = CheckConversion(jsonPath);
+            }
+
+            for (int f = 0; f < 2 && ok; ++f)
+            {
+                ok = MeasureLoad(sceneManager, paths[f], objects, formatResults[f]);
+                if (ok) results.push_back(formatResults[f]);
+            }
+        }
+
+        std::remove(jsonPath.c_str());
+        std::remove(binaryPath.c_str());
+        return ok;
+    }
+
+    bool SceneLoadBenchmark::MeasureLoad(SceneManager* sceneManager, const std::string& filePath, int expectedObjects, Result& result)
+    {
+        std::vector<float> times;
+        for (int i = 0; i < warmupIterations + iterations; ++i)
+        {
+            // Scene teardown happens outside the timed region
+            Scene* scene = sceneManager->CreateScene("scene_load");
+            const auto start = std::chrono::high_resolution_clock::now();
+            const bool loaded = scene->Load(filePath);
+            const auto end = std::chrono::high_resolution_clock::now();
+            const int loadedObjects = static_cast<int>(scene->GetGameObjects().size());
+            sceneManager->UnloadScene(scene);
+            if (!loaded || loadedObjects != expectedObjects)
+                return false;
+
+            if (i >= warmupIterations)
+            {
+                times.push_back(std::chrono::duration<float, std::milli>(end - start).count());
+            }
+        }
+
+        result.loadMs = Median(times);
+        result.loadMinMs = *std::min_element(times.begin(), times.end());
+        return true;
+    }
+
+    bool SceneLoadBenchmark::CheckConversion(const std::string& jsonPath)
+    {
+        const std::string binaryCopy = filePrefix + "_converted.scene";
+        const std::string jsonCopy = filePrefix + "_converted.json";
+
+        std::string original;
+        std::string converted;
+        const bool same = Scene::Convert(jsonPath, binaryCopy) && Scene::Convert(binaryCopy, jsonCopy)
+            && ReadFile(jsonPath, original) && ReadFile(jsonCopy, converted) && original == converted;
+
+        std::remove(binaryCopy.c_str());
+        std::remove(jsonCopy.c_str());
+        return same;
+    }
+
+    void SceneLoadBenchmark::PrintTable() const
+    {
+        std::printf("\n%-10s %-8s %10s %10s %10s %10s %14s %10s\n", "objects", "format", "file MB", "save ms", "load ms", "load min", "objects/s", "MB/s");
+        for (const Result& result : results)
+        {
+            const float megabytes = static_cast<float>(result.fileBytes) / (1024.0f * 1024.0f);
+            std::printf("%-10d %-8s %10.2f %10.2f %10.2f %10.2f %14.0f %10.1f\n", result.objects, result.format.c_str(),
+                megabytes, result.saveMs, result.loadMs, result.loadMinMs,
+                result.loadMs > 0.0f ? result.objects * 1000.0f / result.loadMs : 0.0f,
+                result.loadMs > 0.0f ? megabytes * 1000.0f / result.loadMs : 0.0f);
+        }
+        std::printf("JSON -> binary -> JSON lossless: %s\n", lossless ? "yes" : "NO");
+    }
+
+    bool SceneLoadBenchmark::WriteResults(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(4);
+        out << "{\n";
+#ifdef _DEBUG
+        out << "  \"config\": \"Debug\",\n";
+#else
+        out << "  \"config\": \"Release\",\n";
+#endif
+        out << "  \"iterations\": " << iterations << ",\n";
+        out << "  \"warmup\": " << warmupIterations << ",\n";
+        out << "  \"lossless_conversion\": " << (lossless ? "true" : "false") << ",\n";
+        out << "  \"runs\": [\n";
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& result = results[i];
+            out << "    { \"objects\": " << result.objects
+                << ", \"format\": \"" << result.format << "\""
+                << ", \"file_bytes\": " << result.fileBytes
+                << ", \"save_ms\": " << result.saveMs
+                << ", \"load_ms\": " << result.loadMs
+                << ", \"load_min_ms\": " << result.loadMinMs
+                << ", \"objects_per_second\": " << (result.loadMs > 0.0f ? result.objects * 1000.0f / result.loadMs : 0.0f) << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n";
+        out << "}\n";
+        return true;
+    }
+}
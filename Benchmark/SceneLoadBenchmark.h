@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    class SceneManager;
+
+    // Scene file round trip at scale: builds a testscene.json-style scene (sprites, some physics
+    // bodies, small hierarchies) per object count, saves it once as JSON and once as binary,
+    // then loads each file into fresh scenes
+    class SceneLoadBenchmark
+    {
+    public:
+        struct Result
+        {
+            int objects;
+            std::string format;     // "json" or "binary"
+            long long fileBytes;
+            float saveMs;
+            float loadMs;           // median
+            float loadMinMs;
+        };
+
+    private:
+        std::vector<int> objectCounts;
+        int iterations;
+        int warmupIterations;
+        std::string filePrefix;
+        std::vector<Result> results;
+        bool lossless;              // JSON -> binary -> JSON reproduced the file byte for byte
+
+    public:
+        SceneLoadBenchmark();
+
+        void Configure(const std::vector<int>& objectCounts, int iterations, int warmup);
+        // Builds throwaway scenes through sceneManager; false if a file could not be written or read back
+        bool Run(SceneManager* sceneManager);
+
+        const std::vector<Result>& GetResults() const { return results; }
+        bool IsLossless() const { return lossless; }
+        void PrintTable() const;
+        bool WriteResults(const std::string& filePath) const;
+
+    private:
+        bool MeasureLoad(SceneManager* sceneManager, const std::string& filePath, int expectedObjects, Result& result);
+        bool CheckConversion(const std::string& jsonPath);
+    };
+}
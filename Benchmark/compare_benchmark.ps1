@@ -0,0 +1,61 @@
+# Compares a Benchmark.exe results file against a stored baseline.
+# Exits 1 when any scene's frame p50/p95 or stage average got slower than the threshold allows.
+#
+#   powershell -ExecutionPolicy Bypass -File Benchmark\compare_benchmark.ps1 -Baseline Benchmark\baseline.json -Current benchmark_results.json
+
+param(
+    [Parameter(Mandatory = $true)][string]$Baseline,
+    [Parameter(Mandatory = $true)][string]$Current,
+    [double]$Threshold = 0.10,      # relative slowdown that counts as a regression
+    [double]$NoiseFloorMs = 0.05    # absolute differences below this are ignored
+)
+
+if (-not (Test-Path $Baseline)) { Write-Host "Baseline not found: $Baseline"; exit 2 }
+if (-not (Test-Path $Current)) { Write-Host "Results not found: $Current"; exit 2 }
+
+$base = Get-Content $Baseline -Raw | ConvertFrom-Json
+$curr = Get-Content $Current -Raw | ConvertFrom-Json
+
+$regressions = @()
+
+function Compare-Metric($scene, $metric, $old, $new) {
+    $delta = $new - $old
+    $ratio = if ($old -gt 0) { $delta / $old } else { 0 }
+    $flag = ($delta -gt $NoiseFloorMs) -and ($ratio -gt $Threshold)
+
+    $line = "  {0,-28} {1,9:N3} -> {2,9:N3} ms  ({3,7:P1})" -f $metric, $old, $new, $ratio
+    if ($flag) {
+        Write-Host "$line  REGRESSION" -ForegroundColor Red
+        $script:regressions += "$scene / $metric"
+    } else {
+        Write-Host $line
+    }
+}
+
+foreach ($scene in $curr.scenes) {
+    $old = $base.scenes | Where-Object { $_.name -eq $scene.name } | Select-Object -First 1
+    if (-not $old) {
+        Write-Host "$($scene.name): not in baseline, skipped"
+        continue
+    }
+
+    Write-Host $scene.name
+    Compare-Metric $scene.name "frame p50" $old.frame_ms.p50 $scene.frame_ms.p50
+    Compare-Metric $scene.name "frame p95" $old.frame_ms.p95 $scene.frame_ms.p95
+
+    foreach ($stage in $scene.stages_ms.PSObject.Properties) {
+        $oldStage = $old.stages_ms.PSObject.Properties[$stage.Name]
+        if (-not $oldStage) { continue }
+        Compare-Metric $scene.name $stage.Name $oldStage.Value.avg $stage.Value.avg
+    }
+}
+
+Write-Host ""
+if ($regressions.Count -gt 0) {
+    Write-Host "$($regressions.Count) regression(s) over $('{0:P0}' -f $Threshold):" -ForegroundColor Red
+    $regressions | ForEach-Object { Write-Host "  $_" -ForegroundColor Red }
+    exit 1
+}
+
+Write-Host "No regressions over $('{0:P0}' -f $Threshold)." -ForegroundColor Green
+exit 0
@@ -0,0 +1,346 @@
+#include <windows.h>
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "AudioResamplerBenchmark.h"
+#include "BenchmarkApp.h"
+#include "JobScaling.h"
+#include "PrefabBenchmark.h"
+#include "SceneLoadBenchmark.h"
+#include "Core/ObjectPools.h"
+#include "Core/Renderer.h"
+
+using namespace AronEngine;
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: Benchmark.exe [--frames N] [--warmup N] [--scene NAME]... [--out FILE] [--render-thread] [--null-renderer]\n";
+        std::cout << "                     [--golden DIR [--update-golden]] [--replay FILE] [--list]\n";
+        std::cout << "       Benchmark.exe --job-scaling [--threads N] [--iterations N] [--out FILE]\n";
+        std::cout << "       Benchmark.exe --audio-resampler [--iterations N] [--out FILE]\n";
+        std::cout << "       Benchmark.exe --pool-churn [--frames N] [--scene NAME]... [--out PREFIX]\n";
+        std::cout << "       Benchmark.exe --prefab [--count N] [--iterations N] [--out FILE]\n";
+        std::cout << "       Benchmark.exe --scene-load [--count N] [--iterations N] [--out FILE]\n";
+    }
+
+    // Same scenes with ObjectPools off, then on; writes PREFIX_heap.json and PREFIX_pooled.json
+    int RunPoolChurn(int frames, int warmup, std::vector<std::string> scenes, const std::string& prefix, bool nullRenderer)
+    {
+        if (scenes.empty())
+        {
+            scenes = { "instantiate_churn", "bullet_churn", "bullet_pool" };
+        }
+
+        const std::string heapPath = prefix + "_heap.json";
+        const std::string pooledPath = prefix + "_pooled.json";
+
+        BenchmarkApp app;
+        app.Configure(frames, warmup, scenes);
+        app.SetNullRenderer(nullRenderer);
+        if (!app.Initialize(GetModuleHandle(nullptr), 1600, 900, L"AronEngine Benchmark", false))
+        {
+            std::cout << "Engine initialization failed\n";
+            app.Shutdown();
+            return 1;
+        }
+
+        int exitCode = 1;
+        std::cout << "Heap allocation\n";
+        ObjectPools::SetEnabled(false);
+        if (app.RunAll() && app.WriteResults(heapPath))
+        {
+            const std::vector<BenchmarkApp::SceneResult> heapResults = app.GetResults();
+
+            std::cout << "Pooled allocation\n";
+            ObjectPools::SetEnabled(true);
+            if (app.RunAll() && app.WriteResults(pooledPath))
+            {
+                const auto& pooledResults = app.GetResults();
+                std::printf("\n%-22s %12s %12s %12s %12s %9s\n", "scene", "heap avg", "pooled avg", "heap p95", "pooled p95", "speedup");
+                for (size_t i = 0; i < heapResults.size() && i < pooledResults.size(); ++i)
+                {
+                    const float heapAverage = heapResults[i].GetFrameAverage();
+                    const float pooledAverage = pooledResults[i].GetFrameAverage();
+                    std::printf("%-22s %12.3f %12.3f %12.3f %12.3f %8.2fx\n", heapResults[i].name.c_str(),
+                        heapAverage, pooledAverage, heapResults[i].GetFramePercentile(0.95f), pooledResults[i].GetFramePercentile(0.95f),
+                        pooledAverage > 0.0f ? heapAverage / pooledAverage : 0.0f);
+                }
+                std::cout << "\nResults: " << heapPath << ", " << pooledPath
+                    << " (compare with compare_benchmark.ps1)\n";
+                exitCode = 0;
+            }
+        }
+        else
+        {
+            std::cout << "No benchmark scene matched\n";
+        }
+
+        app.Shutdown();
+        return exitCode;
+    }
+
+    // Manual AddComponent builds against prefab clones of the same objects
+    int RunPrefab(int count, int iterations, int warmup, const std::string& outputPath, bool nullRenderer)
+    {
+        BenchmarkApp app;
+        app.SetNullRenderer(nullRenderer);
+        if (!app.Initialize(GetModuleHandle(nullptr), 1600, 900, L"AronEngine Benchmark", false))
+        {
+            std::cout << "Engine initialization failed\n";
+            app.Shutdown();
+            return 1;
+        }
+
+        PrefabBenchmark benchmark;
+        benchmark.Configure(count, iterations, warmup);
+        benchmark.Run(app.GetSceneManager());
+        benchmark.PrintTable();
+
+        int exitCode = 0;
+        if (!benchmark.WriteResults(outputPath))
+        {
+            std::cout << "Failed to write " << outputPath << "\n";
+            exitCode = 1;
+        }
+        else
+        {
+            std::cout << "\nResults: " << outputPath << "\n";
+        }
+
+        app.Shutdown();
+        return exitCode;
+    }
+
+    // Scene::Save once per format, then Scene::Load of each file into fresh scenes
+    int RunSceneLoad(const std::vector<int>& counts, int iterations, int warmup, const std::string& outputPath, bool nullRenderer)
+    {
+        BenchmarkApp app;
+        app.SetNullRenderer(nullRenderer);
+        if (!app.Initialize(GetModuleHandle(nullptr), 1600, 900, L"AronEngine Benchmark", false))
+        {
+            std::cout << "Engine initialization failed\n";
+            app.Shutdown();
+            return 1;
+        }
+
+        SceneLoadBenchmark benchmark;
+        benchmark.Configure(counts, iterations, warmup);
+
+        int exitCode = 0;
+        if (!benchmark.Run(app.GetSceneManager()))
+        {
+            std::cout << "Scene save/load round trip failed\n";
+            exitCode = 1;
+        }
+        else if (!benchmark.IsLossless())
+        {
+            benchmark.PrintTable();
+            std::cout << "JSON and binary scene conversion is not lossless\n";
+            exitCode = 1;
+        }
+        else if (!benchmark.WriteResults(outputPath))
+        {
+            benchmark.PrintTable();
+            std::cout << "Failed to write " << outputPath << "\n";
+            exitCode = 1;
+        }
+        else
+        {
+            benchmark.PrintTable();
+            std::cout << "\nResults: " << outputPath << "\n";
+        }
+
+        app.Shutdown();
+        return exitCode;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int frames = 300;
+    int warmup = 30;
+    std::vector<std::string> scenes;
+    std::string outputPath;
+    bool jobScaling = false;
+    bool audioResampler = false;
+    bool poolChurn = false;
+    bool prefab = false;
+    bool sceneLoad = false;
+    int instanceCount = 0;
+    int maxThreads = 0;
+    int iterations = 0;
+    bool renderThread = false;
+    bool nullRenderer = false;
+    std::string goldenDirectory;
+    bool updateGolden = false;
+    std::string replayPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--frames" && hasValue) frames = std::atoi(argv[++i]);
+        else if (arg == "--warmup" && hasValue) warmup = std::atoi(argv[++i]);
+        else if (arg == "--scene" && hasValue) scenes.push_back(argv[++i]);
+        else if (arg == "--out" && hasValue) outputPath = argv[++i];
+        else if (arg == "--job-scaling") jobScaling = true;
+        else if (arg == "--audio-resampler") audioResampler = true;
+        else if (arg == "--pool-churn") poolChurn = true;
+        else if (arg == "--prefab") prefab = true;
+        else if (arg == "--scene-load") sceneLoad = true;
+        else if (arg == "--count" && hasValue) instanceCount = std::atoi(argv[++i]);
+        else if (arg == "--threads" && hasValue) maxThreads = std::atoi(argv[++i]);
+        else if (arg == "--iterations" && hasValue) iterations = std::atoi(argv[++i]);
+        else if (arg == "--render-thread") renderThread = true;
+        else if (arg == "--null-renderer") nullRenderer = true;
+        else if (arg == "--golden" && hasValue) goldenDirectory = argv[++i];
+        else if (arg == "--update-golden") updateGolden = true;
+        else if (arg == "--replay" && hasValue) replayPath = argv[++i];
+        else if (arg == "--list")
+        {
+            for (const auto& scene : GetBenchmarkScenes())
+            {
+                std::cout << scene.name << "  - " << scene.description << "\n";
+            }
+            return 0;
+        }
+        else
+        {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    if (jobScaling)
+    {
+        // Needs no window or renderer, just the job system
+        if (outputPath.empty()) outputPath = "job_scaling.json";
+
+        JobScalingBenchmark benchmark;
+        benchmark.Configure(maxThreads, iterations > 0 ? iterations : 20, (std::min)(warmup, 5));
+        benchmark.Run();
+        benchmark.PrintTable();
+
+        if (!benchmark.WriteResults(outputPath))
+        {
+            std::cout << "Failed to write " << outputPath << "\n";
+            return 1;
+        }
+        std::cout << "\nResults: " << outputPath << "\n";
+        return 0;
+    }
+
+    if (audioResampler)
+    {
+        // Pure DSP on synthetic tones; fails when a conversion misses its quality limits
+        if (outputPath.empty()) outputPath = "audio_resampler.json";
+
+        AudioResamplerBenchmark benchmark;
+        benchmark.Configure(iterations > 0 ? iterations : 10, (std::min)(warmup, 2));
+        const bool passed = benchmark.Run();
+        benchmark.PrintTable();
+
+        if (!benchmark.WriteResults(outputPath))
+        {
+            std::cout << "Failed to write " << outputPath << "\n";
+            return 1;
+        }
+        std::cout << "\nResults: " << outputPath << "\n";
+        return passed ? 0 : 1;
+    }
+
+    if (poolChurn)
+    {
+        CoInitialize(nullptr);
+        const int exitCode = RunPoolChurn(frames, warmup, scenes, outputPath.empty() ? "pool_churn" : outputPath, nullRenderer);
+        CoUninitialize();
+        return exitCode;
+    }
+
+    if (prefab)
+    {
+        CoInitialize(nullptr);
+        const int exitCode = RunPrefab(instanceCount > 0 ? instanceCount : 1000, iterations > 0 ? iterations : 20, (std::min)(warmup, 3),
+            outputPath.empty() ? "prefab_instantiate.json" : outputPath, nullRenderer);
+        CoUninitialize();
+        return exitCode;
+    }
+
+    if (sceneLoad)
+    {
+        // Million-object JSON files take seconds per load, so fewer passes than the other modes
+        const std::vector<int> counts = instanceCount > 0 ? std::vector<int>{ instanceCount } : std::vector<int>{ 10000, 100000, 1000000 };
+        CoInitialize(nullptr);
+        const int exitCode = RunSceneLoad(counts, iterations > 0 ? iterations : 3, 1,
+            outputPath.empty() ? "scene_load.json" : outputPath, nullRenderer);
+        CoUninitialize();
+        return exitCode;
+    }
+
+    if (outputPath.empty()) outputPath = "benchmark_results.json";
+
+    CoInitialize(nullptr);
+
+    int exitCode = 1;
+    {
+        BenchmarkApp app;
+        app.Configure(frames, warmup, scenes);
+        app.SetGolden(goldenDirectory, updateGolden);
+        app.SetReplay(replayPath);
+        // CPU-side submission cost only: frames are recorded and hashed, never rasterized
+        app.SetNullRenderer(nullRenderer);
+
+        if (app.Initialize(GetModuleHandle(nullptr), 1600, 900, L"AronEngine Benchmark", false))
+        {
+            // Headless runs play frames back inline; this overlaps playback with the next frame
+            app.GetRenderer()->SetRenderThreadEnabled(renderThread);
+
+            if (!app.RunAll())
+            {
+                std::cout << "No benchmark scene matched\n";
+            }
+            else if (app.WriteResults(outputPath))
+            {
+                std::printf("\n%-22s %10s %10s %10s %10s\n", "scene", "setup ms", "p50 ms", "p95 ms", "max ms");
+                for (const auto& result : app.GetResults())
+                {
+                    std::printf("%-22s %10.2f %10.3f %10.3f %10.3f\n", result.name.c_str(), result.setupMs,
+                        result.GetFramePercentile(0.50f), result.GetFramePercentile(0.95f), result.GetFramePercentile(1.0f));
+                }
+                std::cout << "\nResults: " << outputPath << "\n";
+                exitCode = 0;
+
+                for (const auto& result : app.GetResults())
+                {
+                    if (result.checkFailure.empty()) continue;
+                    std::printf("%-22s check failed: %s\n", result.name.c_str(), result.checkFailure.c_str());
+                    exitCode = 1;
+                }
+
+                if (!goldenDirectory.empty())
+                {
+                    std::cout << "\nRender output against " << goldenDirectory << "\n";
+                    for (const auto& result : app.GetResults())
+                    {
+                        std::printf("%-22s %s\n", result.name.c_str(), result.golden.c_str());
+                        if (result.goldenFailed) exitCode = 1;
+                    }
+                }
+            }
+        }
+        else
+        {
+            std::cout << "Engine initialization failed\n";
+        }
+
+        app.Shutdown();
+    }
+
+    CoUninitialize();
+    return exitCode;
+}
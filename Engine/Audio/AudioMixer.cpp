@@ -0,0 +1,387 @@
+#include "framework.h"
+#include "AudioMixer.h"
+#include "../Core/Profiler.h"
+#include "../Resources/AudioClip.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr uint32_t kSlotMask = 0xFF;
+        constexpr int kGenerationShift = 8;
+
+        inline void ComputeGains(float volume, float pan, float& left, float& right)
+        {
+            // Linear balance: centre keeps unity gain on both sides
+            left = volume * (std::min)(1.0f, 1.0f - pan);
+            right = volume * (std::min)(1.0f, 1.0f + pan);
+        }
+    }
+
+    AudioMixer::AudioMixer(int outputRate)
+        : submittedBatch(0)
+        , masterVolume(1.0f)
+        , activeVoiceCount(0)
+        , consumedBatch(0)
+        , outputRate(outputRate)
+        , mixMasterVolume(1.0f)
+    {
+        for (auto& generation : finishedGeneration)
+        {
+            generation.store(0, std::memory_order_relaxed);
+        }
+        pendingCommands.reserve(kCommandCapacity);
+    }
+
+    AudioVoiceHandle AudioMixer::Play(std::shared_ptr<AudioClip> clip, float volume, float pitch, bool loop, int priority)
+    {
+        if (!clip || !clip->IsLoaded() || clip->GetFrameCount() == 0)
+        {
+            return InvalidVoiceHandle;
+        }
+
+        int index = AllocateSlot(priority);
+        if (index < 0)
+        {
+            return InvalidVoiceHandle;
+        }
+
+        VoiceSlot& slot = slots[index];
+        slot.clip = std::move(clip);
+        slot.priority = priority;
+        slot.active = true;
+        ++activeVoiceCount;
+
+        AudioCommand command = {};
+        command.type = AudioCommandType::Play;
+        command.flag = loop;
+        command.handle = (slot.generation << kGenerationShift) | static_cast<uint32_t>(index);
+        command.clip = slot.clip.get();
+        command.value = (std::max)(0.0f, volume);
+        command.pitch = (std::max)(0.1f, (std::min)(3.0f, pitch));
+        pendingCommands.push_back(command);
+
+        return command.handle;
+    }
+
+    void AudioMixer::Stop(AudioVoiceHandle handle)
+    {
+        if (!ResolveSlot(handle)) return;
+
+        RetireSlot(slots[handle & kSlotMask]);
+        Record(AudioCommandType::Stop, handle);
+    }
+
+    void AudioMixer::StopAll()
+    {
+        for (int i = 0; i < kMaxVoices; ++i)
+        {
+            VoiceSlot& slot = slots[i];
+            if (!slot.active) continue;
+
+            RetireSlot(slot);
+            Record(AudioCommandType::Stop, (slot.generation << kGenerationShift) | static_cast<uint32_t>(i));
+        }
+    }
+
+    void AudioMixer::SetPaused(AudioVoiceHandle handle, bool paused)
+    {
+        if (ResolveSlot(handle))
+        {
+            Record(AudioCommandType::SetPaused, handle, 0.0f, paused);
+        }
+    }
+
+    void AudioMixer::SetVolume(AudioVoiceHandle handle, float volume)
+    {
+        if (ResolveSlot(handle))
+        {
+            Record(AudioCommandType::SetVolume, handle, (std::max)(0.0f, volume));
+        }
+    }
+
+    void AudioMixer::SetPan(AudioVoiceHandle handle, float pan)
+    {
+        if (ResolveSlot(handle))
+        {
+            Record(AudioCommandType::SetPan, handle, (std::max)(-1.0f, (std::min)(1.0f, pan)));
+        }
+    }
+
+    void AudioMixer::SetPitch(AudioVoiceHandle handle, float pitch)
+    {
+        if (ResolveSlot(handle))
+        {
+            Record(AudioCommandType::SetPitch, handle, (std::max)(0.1f, (std::min)(3.0f, pitch)));
+        }
+    }
+
+    void AudioMixer::SetParams(AudioVoiceHandle handle, float volume, float pan, float pitch)
+    {
+        if (!ResolveSlot(handle)) return;
+
+        AudioCommand command = {};
+        command.type = AudioCommandType::SetParams;
+        command.handle = handle;
+        command.value = (std::max)(0.0f, volume);
+        command.pan = (std::max)(-1.0f, (std::min)(1.0f, pan));
+        command.pitch = (std::max)(0.1f, (std::min)(3.0f, pitch));
+        pendingCommands.push_back(command);
+    }
+
+    bool AudioMixer::IsPlaying(AudioVoiceHandle handle) const
+    {
+        return ResolveSlot(handle) != nullptr;
+    }
+
+    void AudioMixer::SetMasterVolume(float volume)
+    {
+        masterVolume = (std::max)(0.0f, (std::min)(1.0f, volume));
+        Record(AudioCommandType::SetMasterVolume, InvalidVoiceHandle, masterVolume);
+    }
+
+    void AudioMixer::Flush()
+    {
+        // Voices the mixer ran to the end; it no longer touches their clips
+        for (int i = 0; i < kMaxVoices; ++i)
+        {
+            VoiceSlot& slot = slots[i];
+            if (slot.active && finishedGeneration[i].load(std::memory_order_acquire) == slot.generation)
+            {
+                slot.active = false;
+                slot.clip.reset();
+                --activeVoiceCount;
+            }
+        }
+
+        AudioCommand fence = {};
+        fence.type = AudioCommandType::Fence;
+        fence.batch = ++submittedBatch;
+        pendingCommands.push_back(fence);
+
+        // Whatever doesn't fit stays queued, in order, for the next frame
+        size_t pushed = commandQueue.PushBatch(pendingCommands.data(), pendingCommands.size());
+        pendingCommands.erase(pendingCommands.begin(), pendingCommands.begin() + pushed);
+
+        const uint64_t consumed = consumedBatch.load(std::memory_order_acquire);
+        pendingReleases.erase(
+            std::remove_if(pendingReleases.begin(), pendingReleases.end(),
+                [consumed](const PendingRelease& release) { return release.batch <= consumed; }),
+            pendingReleases.end());
+    }
+
+    const AudioMixer::VoiceSlot* AudioMixer::ResolveSlot(AudioVoiceHandle handle) const
+    {
+        if (handle == InvalidVoiceHandle) return nullptr;
+
+        const uint32_t index = handle & kSlotMask;
+        if (index >= static_cast<uint32_t>(kMaxVoices)) return nullptr;
+
+        const VoiceSlot& slot = slots[index];
+        const uint32_t generation = handle >> kGenerationShift;
+        if (!slot.active || slot.generation != generation) return nullptr;
+        if (finishedGeneration[index].load(std::memory_order_acquire) == generation) return nullptr;
+
+        return &slot;
+    }
+
+    int AudioMixer::AllocateSlot(int priority)
+    {
+        int victim = -1;
+
+        for (int i = 0; i < kMaxVoices; ++i)
+        {
+            const VoiceSlot& slot = slots[i];
+            if (!slot.active || finishedGeneration[i].load(std::memory_order_acquire) == slot.generation)
+            {
+                victim = i;
+                break;
+            }
+
+            // Steal the lowest-priority voice if the new one is at least as important
+            if (slot.priority >= priority && (victim < 0 || slot.priority > slots[victim].priority))
+            {
+                victim = i;
+            }
+        }
+
+        if (victim < 0) return -1;
+
+        VoiceSlot& slot = slots[victim];
+        if (slot.active)
+        {
+            RetireSlot(slot);
+        }
+
+        // Generation lives in the upper 24 bits and must never be 0
+        slot.generation = (slot.generation + 1) & 0xFFFFFF;
+        if (slot.generation == 0) slot.generation = 1;
+
+        return victim;
+    }
+
+    void AudioMixer::RetireSlot(VoiceSlot& slot)
+    {
+        // The mixer may still be reading the clip until it sees the next batch
+        pendingReleases.push_back({ std::move(slot.clip), submittedBatch + 1 });
+        slot.active = false;
+        --activeVoiceCount;
+    }
+
+    void AudioMixer::Record(AudioCommandType type, AudioVoiceHandle handle, float value, bool flag)
+    {
+        AudioCommand command = {};
+        command.type = type;
+        command.flag = flag;
+        command.handle = handle;
+        command.value = value;
+        pendingCommands.push_back(command);
+    }
+
+    void AudioMixer::DrainCommands()
+    {
+        AudioCommand command;
+        while (commandQueue.Pop(command))
+        {
+            Execute(command);
+        }
+    }
+
+    void AudioMixer::Execute(const AudioCommand& command)
+    {
+        if (command.type == AudioCommandType::Fence)
+        {
+            consumedBatch.store(command.batch, std::memory_order_release);
+            return;
+        }
+
+        if (command.type == AudioCommandType::SetMasterVolume)
+        {
+            mixMasterVolume = command.value;
+            return;
+        }
+
+        Voice& voice = voices[command.handle & kSlotMask];
+        const uint32_t generation = command.handle >> kGenerationShift;
+
+        if (command.type == AudioCommandType::Play)
+        {
+            voice.clip = command.clip;
+            voice.resampler = ResamplerState();
+            voice.generation = generation;
+            voice.volume = command.value;
+            voice.pan = 0.0f;
+            voice.pitch = command.pitch;
+            voice.loop = command.flag;
+            voice.paused = false;
+            voice.active = true;
+            ComputeGains(voice.volume, voice.pan, voice.gainL, voice.gainR);
+            return;
+        }
+
+        // Commands for a voice that already ended or was replaced are dropped
+        if (!voice.active || voice.generation != generation) return;
+
+        switch (command.type)
+        {
+        case AudioCommandType::Stop:
+            voice.active = false;
+            voice.clip = nullptr;
+            break;
+        case AudioCommandType::SetPaused:
+            voice.paused = command.flag;
+            break;
+        case AudioCommandType::SetVolume:
+            voice.volume = command.value;
+            break;
+        case AudioCommandType::SetPan:
+            voice.pan = command.value;
+            break;
+        case AudioCommandType::SetPitch:
+            voice.pitch = command.value;
+            break;
+        case AudioCommandType::SetParams:
+            voice.volume = command.value;
+            voice.pan = command.pan;
+            voice.pitch = command.pitch;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void AudioMixer::FinishVoice(int index)
+    {
+        Voice& voice = voices[index];
+        voice.active = false;
+        voice.clip = nullptr;
+        finishedGeneration[index].store(voice.generation, std::memory_order_release);
+    }
+
+    void AudioMixer::Mix(float* output, int frameCount)
+    {
+        PROFILE_SCOPE("AudioMixer::Mix");
+
+        for (int offset = 0; offset < frameCount; offset += kBlockFrames)
+        {
+            // Parameter changes land exactly on block boundaries
+            DrainCommands();
+            MixBlock(output + offset * kOutputChannels, (std::min)(kBlockFrames, frameCount - offset));
+        }
+    }
+
+    void AudioMixer::MixBlock(float* output, int frameCount)
+    {
+        memset(output, 0, sizeof(float) * frameCount * kOutputChannels);
+
+        const float invFrames = 1.0f / frameCount;
+
+        for (int v = 0; v < kMaxVoices; ++v)
+        {
+            Voice& voice = voices[v];
+            if (!voice.active || voice.paused) continue;
+
+            const AudioClip& clip = *voice.clip;
+            const int clipChannels = clip.GetChannels();
+            const float* channelData[2] = { clip.GetChannelData(0), clip.GetChannelData((std::min)(1, clipChannels - 1)) };
+
+            const double step = (static_cast<double>(clip.GetFrequency()) / outputRate) * voice.pitch;
+            const int produced = AudioResampler::Process(channelData, (std::min)(2, clipChannels), clip.GetFrameCount(),
+                                                         voice.loop, step, voice.resampler,
+                                                         scratchL, scratchR, frameCount);
+
+            // Ramp gains across the block so volume/pan changes don't click
+            float targetL, targetR;
+            ComputeGains(voice.volume, voice.pan, targetL, targetR);
+            const float deltaL = (targetL - voice.gainL) * invFrames;
+            const float deltaR = (targetR - voice.gainR) * invFrames;
+            float gainL = voice.gainL;
+            float gainR = voice.gainR;
+
+            for (int i = 0; i < produced; ++i)
+            {
+                gainL += deltaL;
+                gainR += deltaR;
+                output[i * 2] += scratchL[i] * gainL;
+                output[i * 2 + 1] += scratchR[i] * gainR;
+            }
+
+            voice.gainL = targetL;
+            voice.gainR = targetR;
+
+            if (produced < frameCount)
+            {
+                FinishVoice(v);
+            }
+        }
+
+        if (mixMasterVolume != 1.0f)
+        {
+            const int sampleCount = frameCount * kOutputChannels;
+            for (int i = 0; i < sampleCount; ++i)
+            {
+                output[i] *= mixMasterVolume;
+            }
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include "AudioResampler.h"
+#include "../Utils/SpscRing.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace AronEngine
+{
+    class AudioClip;
+
+    // Low 8 bits: voice slot, high 24 bits: generation. 0 is never a valid handle.
+    using AudioVoiceHandle = uint32_t;
+    constexpr AudioVoiceHandle InvalidVoiceHandle = 0;
+
+    enum class AudioCommandType : uint8_t
+    {
+        Play,
+        Stop,
+        SetPaused,
+        SetVolume,
+        SetPan,
+        SetPitch,
+        SetParams,      // volume + pan + pitch in one command (spatial updates)
+        SetMasterVolume,
+        Fence           // end of a game-thread batch
+    };
+
+    // POD so it can cross the lock-free ring by value
+    struct AudioCommand
+    {
+        AudioCommandType type;
+        bool flag;                  // Play: loop, SetPaused: paused
+        AudioVoiceHandle handle;
+        const AudioClip* clip;      // Play only; kept alive by the game-side voice slot
+        float value;                // volume / pan / pitch, Play and SetParams: volume
+        float pan;                  // SetParams only
+        float pitch;                // Play and SetParams
+        uint64_t batch;             // Fence only
+    };
+
+    // Software mixer: resamples every voice to the output rate and sums into interleaved stereo.
+    // Control calls run on the game thread and are only recorded; Flush() publishes them once per
+    // frame and the mixer thread applies them at the next block boundary, so neither side blocks.
+    class AudioMixer
+    {
+    public:
+        static constexpr int kMaxVoices = 128;
+        static constexpr int kBlockFrames = 256;
+        static constexpr int kOutputChannels = 2;
+        static constexpr size_t kCommandCapacity = 4096;
+
+    private:
+        // Game thread view of a voice
+        struct VoiceSlot
+        {
+            std::shared_ptr<AudioClip> clip;
+            uint32_t generation = 0;
+            int priority = 128;         // 0 = highest
+            bool active = false;
+        };
+
+        // Mixer thread render state
+        struct Voice
+        {
+            const AudioClip* clip = nullptr;
+            ResamplerState resampler;
+            uint32_t generation = 0;
+            float volume = 1.0f;
+            float pan = 0.0f;           // -1 = left, 1 = right
+            float pitch = 1.0f;
+            float gainL = 0.0f;         // gains applied at the end of the last block (ramp start)
+            float gainR = 0.0f;
+            bool loop = false;
+            bool paused = false;
+            bool active = false;
+        };
+
+        // Clip reference held until the mixer has consumed the batch that dropped it
+        struct PendingRelease
+        {
+            std::shared_ptr<AudioClip> clip;
+            uint64_t batch;
+        };
+
+        // Game thread
+        std::array<VoiceSlot, kMaxVoices> slots;
+        std::vector<AudioCommand> pendingCommands;
+        std::vector<PendingRelease> pendingReleases;
+        uint64_t submittedBatch;
+        float masterVolume;
+        int activeVoiceCount;
+
+        // Shared
+        SpscRing<AudioCommand, kCommandCapacity> commandQueue;
+        std::array<std::atomic<uint32_t>, kMaxVoices> finishedGeneration;
+        std::atomic<uint64_t> consumedBatch;
+
+        // Mixer thread
+        std::array<Voice, kMaxVoices> voices;
+        int outputRate;
+        float mixMasterVolume;
+        alignas(16) float scratchL[kBlockFrames];
+        alignas(16) float scratchR[kBlockFrames];
+
+    public:
+        explicit AudioMixer(int outputRate = 44100);
+
+        // --- Game thread ---
+
+        // Returns InvalidVoiceHandle when the clip is unusable or every voice is busy with higher priority
+        AudioVoiceHandle Play(std::shared_ptr<AudioClip> clip, float volume, float pitch, bool loop, int priority = 128);
+        void Stop(AudioVoiceHandle handle);
+        void StopAll();
+
+        void SetPaused(AudioVoiceHandle handle, bool paused);
+        void SetVolume(AudioVoiceHandle handle, float volume);
+        void SetPan(AudioVoiceHandle handle, float pan);
+        void SetPitch(AudioVoiceHandle handle, float pitch);
+        void SetParams(AudioVoiceHandle handle, float volume, float pan, float pitch);
+        bool IsPlaying(AudioVoiceHandle handle) const;
+
+        void SetMasterVolume(float volume);
+        float GetMasterVolume() const { return masterVolume; }
+        int GetActiveVoiceCount() const { return activeVoiceCount; }
+
+        // Publishes this frame's commands and reclaims voices the mixer has finished
+        void Flush();
+
+        // --- Mixer thread ---
+
+        // Overwrites frameCount interleaved stereo frames; commands are applied per block
+        void Mix(float* output, int frameCount);
+
+        // Applies all published commands; also usable from the game thread when no mixer thread runs
+        void DrainCommands();
+
+        int GetOutputRate() const { return outputRate; }
+
+    private:
+        const VoiceSlot* ResolveSlot(AudioVoiceHandle handle) const;
+        int AllocateSlot(int priority);
+        void RetireSlot(VoiceSlot& slot);
+        void Record(AudioCommandType type, AudioVoiceHandle handle, float value = 0.0f, bool flag = false);
+
+        void Execute(const AudioCommand& command);
+        void FinishVoice(int index);
+        void MixBlock(float* output, int frameCount);
+    };
+}
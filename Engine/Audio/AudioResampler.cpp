@@ -0,0 +1,341 @@
+#include "framework.h"
+#include "AudioResampler.h"
+#include <xmmintrin.h>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr int kHalfTaps = AudioResampler::kTaps / 2;
+        constexpr int kInterpBits = AudioResampler::kFracBits - AudioResampler::kPhaseBits;
+        constexpr double kPi = 3.14159265358979323846;
+
+        // Cutoff relative to source Nyquist. Bank 0 keeps the full band for step <= 1, where
+        // nothing can alias, so that phase 0 is an exact delta and the unity-rate copy path
+        // matches the filtered path. Bank b > 0 is cut at 0.9 / step for step 2^((b-1)/kBanksPerOctave);
+        // steps in between blend the two neighbouring banks.
+        double BankCutoff(int bank)
+        {
+            if (bank == 0) return 1.0;
+            return 0.9 * std::pow(2.0, -static_cast<double>(bank - 1) / AudioResampler::kBanksPerOctave);
+        }
+
+        constexpr double kKaiserBeta = 8.0;
+
+        double BesselI0(double x)
+        {
+            double sum = 1.0;
+            double term = 1.0;
+            const double halfX = x * 0.5;
+            for (int k = 1; k < 32; ++k)
+            {
+                term *= (halfX / k) * (halfX / k);
+                sum += term;
+                if (term < sum * 1e-12) break;
+            }
+            return sum;
+        }
+
+        struct FilterTable
+        {
+            // One extra phase row so that phase + 1 is always valid for interpolation
+            alignas(16) float coeffs[AudioResampler::kBanks][AudioResampler::kPhases + 1][AudioResampler::kTaps];
+
+            FilterTable()
+            {
+                const double windowNorm = 1.0 / BesselI0(kKaiserBeta);
+
+                for (int bank = 0; bank < AudioResampler::kBanks; ++bank)
+                {
+                    const double cutoff = BankCutoff(bank);
+
+                    for (int phase = 0; phase <= AudioResampler::kPhases; ++phase)
+                    {
+                        const double frac = static_cast<double>(phase) / AudioResampler::kPhases;
+                        double taps[AudioResampler::kTaps];
+                        double sum = 0.0;
+
+                        for (int i = 0; i < AudioResampler::kTaps; ++i)
+                        {
+                            // Distance from the interpolated point to source sample (idx - kHalfTaps + 1 + i)
+                            const double x = (i - (kHalfTaps - 1)) - frac;
+                            const double r = x / kHalfTaps;
+
+                            double window = 0.0;
+                            if (r > -1.0 && r < 1.0)
+                            {
+                                window = BesselI0(kKaiserBeta * std::sqrt(1.0 - r * r)) * windowNorm;
+                            }
+
+                            const double u = cutoff * x;
+                            const double sinc = (std::fabs(u) < 1e-9) ? 1.0 : std::sin(kPi * u) / (kPi * u);
+
+                            taps[i] = cutoff * sinc * window;
+                            sum += taps[i];
+                        }
+
+                        // Unity DC gain for every phase
+                        for (int i = 0; i < AudioResampler::kTaps; ++i)
+                        {
+                            coeffs[bank][phase][i] = static_cast<float>(taps[i] / sum);
+                        }
+                    }
+                }
+            }
+        };
+
+        const FilterTable& GetFilterTable()
+        {
+            static const FilterTable table;
+            return table;
+        }
+
+        constexpr int kRowFloats = (AudioResampler::kPhases + 1) * AudioResampler::kTaps;
+        constexpr int kMaxTaps = AudioResampler::kTaps * AudioResampler::kMaxStretch;
+
+        // Per mixing thread; sized once so Process never allocates after the first call
+        struct FilterScratch
+        {
+            alignas(16) float blended[kRowFloats];
+            std::vector<float> stretched;
+            std::vector<float> edgeL;
+            std::vector<float> edgeR;
+
+            FilterScratch()
+                : stretched(static_cast<size_t>(kRowFloats) * AudioResampler::kMaxStretch)
+                , edgeL(kMaxTaps)
+                , edgeR(kMaxTaps)
+            {
+            }
+        };
+
+        // kPhases + 1 rows of taps coefficients
+        struct Filter
+        {
+            const float* coeffs;
+            int taps;
+        };
+
+        // prototype(x / stretch): the cutoff divides by stretch, the window grows by it
+        void StretchFilter(const float* prototype, int stretchBits, float* out)
+        {
+            const int stretch = 1 << stretchBits;
+            const int taps = AudioResampler::kTaps << stretchBits;
+            const int unitBits = AudioResampler::kPhaseBits + stretchBits;
+            const int unit = 1 << unitBits;                                 // one prototype tap
+            const float fracScale = 1.0f / stretch;
+
+            for (int phase = 0; phase <= AudioResampler::kPhases; ++phase)
+            {
+                float* row = out + phase * taps;
+                float sum = 0.0f;
+
+                for (int j = 0; j < taps; ++j)
+                {
+                    // Prototype tap i of phase p sits at i - p / kPhases from the window start;
+                    // position counts in 1 / unit of a prototype tap, so i = ceil(position / unit)
+                    const int position = AudioResampler::kPhases * (j - (taps / 2 - 1)) - phase + unit * (kHalfTaps - 1);
+                    const int i = ((position + 2 * unit - 1) >> unitBits) - 1;
+
+                    float value = 0.0f;
+                    if (i >= 0 && i < AudioResampler::kTaps)
+                    {
+                        const int offset = i * unit - position;
+                        const int p0 = offset >> stretchBits;
+                        const float a = prototype[p0 * AudioResampler::kTaps + i];
+                        const float b = prototype[(p0 + 1) * AudioResampler::kTaps + i];
+                        value = a + (b - a) * ((offset & (stretch - 1)) * fracScale);
+                    }
+                    row[j] = value;
+                    sum += value;
+                }
+
+                // Unity DC gain for every phase
+                const float scale = 1.0f / sum;
+                for (int j = 0; j < taps; ++j)
+                {
+                    row[j] *= scale;
+                }
+            }
+        }
+
+        // Filter for a 32.32 step: a table bank, two banks blended, or either stretched
+        Filter SelectFilter(uint64_t step, FilterScratch& scratch)
+        {
+            constexpr uint64_t one = 1ull << AudioResampler::kFracBits;
+            const FilterTable& table = GetFilterTable();
+            if (step <= one)
+            {
+                return { &table.coeffs[0][0][0], AudioResampler::kTaps };
+            }
+
+            int stretchBits = 0;
+            uint64_t prototypeStep = step;
+            while (prototypeStep > 2 * one && (1 << stretchBits) < AudioResampler::kMaxStretch)
+            {
+                prototypeStep >>= 1;
+                ++stretchBits;
+            }
+
+            const double position = (std::min)(1.0 + AudioResampler::kBanksPerOctave * std::log2(prototypeStep / 4294967296.0),
+                                               static_cast<double>(AudioResampler::kBanks - 1));
+            const int bank = static_cast<int>(position);
+            const float weight = static_cast<float>(position - bank);
+
+            const float* prototype = &table.coeffs[bank][0][0];
+            if (bank < AudioResampler::kBanks - 1 && weight >= 1e-3f)
+            {
+                // Both banks have unity DC gain per phase, so the blend does too
+                const float* a = prototype;
+                const float* b = &table.coeffs[bank + 1][0][0];
+                const __m128 w = _mm_set1_ps(weight);
+                for (int i = 0; i < kRowFloats; i += 4)
+                {
+                    const __m128 va = _mm_load_ps(a + i);
+                    _mm_store_ps(scratch.blended + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b + i), va), w)));
+                }
+                prototype = scratch.blended;
+            }
+
+            if (stretchBits == 0)
+            {
+                return { prototype, AudioResampler::kTaps };
+            }
+
+            StretchFilter(prototype, stretchBits, scratch.stretched.data());
+            return { scratch.stretched.data(), AudioResampler::kTaps << stretchBits };
+        }
+
+        inline float HorizontalSum(__m128 v)
+        {
+            __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(v, shuf);
+            shuf = _mm_movehl_ps(shuf, sums);
+            sums = _mm_add_ss(sums, shuf);
+            return _mm_cvtss_f32(sums);
+        }
+
+        // Copies a tap window that crosses the clip boundary (wraps for loops, zero otherwise)
+        void GatherEdge(const float* src, int64_t first, int sourceFrames, bool loop, float* dst, int taps)
+        {
+            for (int k = 0; k < taps; ++k)
+            {
+                int64_t s = first + k;
+                if (loop)
+                {
+                    s %= sourceFrames;
+                    if (s < 0) s += sourceFrames;
+                    dst[k] = src[s];
+                }
+                else
+                {
+                    dst[k] = (s >= 0 && s < sourceFrames) ? src[s] : 0.0f;
+                }
+            }
+        }
+    }
+
+    uint64_t AudioResampler::StepToFixed(double step)
+    {
+        step = (std::max)(1.0 / 1024.0, (std::min)(64.0, step));
+        return static_cast<uint64_t>(step * 4294967296.0 + 0.5);
+    }
+
+    int AudioResampler::Process(const float* const* channels, int channelCount, int sourceFrames, bool loop,
+                                double stepRatio, ResamplerState& state,
+                                float* outLeft, float* outRight, int frameCount)
+    {
+        if (!channels || channelCount <= 0 || sourceFrames <= 0) return 0;
+
+        const float* left = channels[0];
+        const float* right = channelCount > 1 ? channels[1] : channels[0];
+        const bool stereo = channelCount > 1;
+
+        const uint64_t step = StepToFixed(stepRatio);
+        const uint64_t end = static_cast<uint64_t>(sourceFrames) << kFracBits;
+        uint64_t pos = state.position;
+        int written = 0;
+
+        // Unity rate on an integer position: plain copy
+        if (step == (1ull << kFracBits) && (pos & 0xFFFFFFFFull) == 0)
+        {
+            while (written < frameCount)
+            {
+                if (pos >= end)
+                {
+                    if (!loop) break;
+                    pos %= end;
+                }
+
+                const int idx = static_cast<int>(pos >> kFracBits);
+                const int count = (std::min)(frameCount - written, sourceFrames - idx);
+                memcpy(outLeft + written, left + idx, count * sizeof(float));
+                memcpy(outRight + written, right + idx, count * sizeof(float));
+                written += count;
+                pos += static_cast<uint64_t>(count) << kFracBits;
+            }
+
+            state.position = pos;
+            return written;
+        }
+
+        static thread_local FilterScratch scratch;
+        const Filter filter = SelectFilter(step, scratch);
+        const int taps = filter.taps;
+        const float interpScale = 1.0f / static_cast<float>(1u << kInterpBits);
+
+        for (; written < frameCount; ++written)
+        {
+            if (pos >= end)
+            {
+                if (!loop) break;
+                pos %= end;
+            }
+
+            const int64_t idx = static_cast<int64_t>(pos >> kFracBits);
+            const uint32_t frac = static_cast<uint32_t>(pos);
+            const int phase = static_cast<int>(frac >> kInterpBits);
+            const __m128 t = _mm_set1_ps(static_cast<float>(frac & ((1u << kInterpBits) - 1)) * interpScale);
+
+            const float* c0 = filter.coeffs + phase * taps;
+            const float* c1 = c0 + taps;
+
+            const int64_t first = idx - (taps / 2 - 1);
+            const float* l = left + first;
+            const float* r = right + first;
+            if (first < 0 || first + taps > sourceFrames)
+            {
+                GatherEdge(left, first, sourceFrames, loop, scratch.edgeL.data(), taps);
+                l = scratch.edgeL.data();
+                if (stereo)
+                {
+                    GatherEdge(right, first, sourceFrames, loop, scratch.edgeR.data(), taps);
+                    r = scratch.edgeR.data();
+                }
+            }
+
+            __m128 accL = _mm_setzero_ps();
+            __m128 accR = _mm_setzero_ps();
+            for (int k = 0; k < taps; k += 4)
+            {
+                const __m128 a = _mm_load_ps(c0 + k);
+                const __m128 b = _mm_load_ps(c1 + k);
+                const __m128 c = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+                accL = _mm_add_ps(accL, _mm_mul_ps(_mm_loadu_ps(l + k), c));
+                if (stereo)
+                {
+                    accR = _mm_add_ps(accR, _mm_mul_ps(_mm_loadu_ps(r + k), c));
+                }
+            }
+
+            const float sampleL = HorizontalSum(accL);
+            outLeft[written] = sampleL;
+            outRight[written] = stereo ? HorizontalSum(accR) : sampleL;
+
+            pos += step;
+        }
+
+        state.position = pos;
+        return written;
+    }
+}
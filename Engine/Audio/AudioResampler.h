@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+
+namespace AronEngine
+{
+    // Per-voice read position in source frames, 32.32 fixed point
+    struct ResamplerState
+    {
+        uint64_t position = 0;
+    };
+
+    // Polyphase windowed-sinc resampler (Kaiser window, SSE dot products).
+    // Source data is planar float PCM; output is planar left/right. When downsampling the
+    // cutoff follows 0.9 / step of source Nyquist; past step 2 the kernel is stretched so it
+    // stays that narrow, and costs proportionally more per output frame.
+    class AudioResampler
+    {
+    public:
+        static constexpr int kTaps = 16;        // filter length per phase up to step 2 (multiple of 4)
+        static constexpr int kPhaseBits = 6;
+        static constexpr int kPhases = 1 << kPhaseBits;
+        static constexpr int kBanksPerOctave = 8;
+        static constexpr int kBanks = kBanksPerOctave + 2;  // full band, then 0.9 / step for steps 1 .. 2
+        static constexpr int kMaxStretch = 32;  // larger steps use kTaps * stretch taps, up to step 64
+        static constexpr int kFracBits = 32;
+
+        // step = (clipRate / outputRate) * pitch, in source frames per output frame.
+        // Mono sources are written to both outputs. Returns the number of frames written,
+        // which is less than frameCount only when a non-looping source reaches its end.
+        static int Process(const float* const* channels, int channelCount, int sourceFrames, bool loop,
+                           double step, ResamplerState& state,
+                           float* outLeft, float* outRight, int frameCount);
+
+        static uint64_t StepToFixed(double step);
+    };
+}
@@ -2,6 +2,10 @@
 #include "Animator.h"
 #include "SpriteRenderer.h"
 #include "../Core/GameObject.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -18,12 +22,23 @@ namespace AronEngine
     {
     }
 
-    void Animator::Start()
+    void Animator::OnStart()
     {
-        Component::Start();
+        Component::OnStart();
         
         spriteRenderer = FindSpriteRenderer();
-        
+        PlayAutoPlayAnimation();
+    }
+
+    void Animator::OnReset()
+    {
+        // Back to the first frame, playing again if it started on its own
+        Stop();
+        PlayAutoPlayAnimation();
+    }
+
+    void Animator::PlayAutoPlayAnimation()
+    {
         if (autoPlay && !defaultAnimation.empty())
         {
             Play(defaultAnimation);
@@ -34,10 +49,32 @@ namespace AronEngine
         }
     }
 
-    void Animator::Update(float deltaTime)
+    void Animator::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool Animator::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void Animator::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool Animator::ReadBinary(BinaryReader& reader)
+    {
+        return Component::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+
+    void Animator::OnUpdate(float deltaTime)
     {
-        Component::Update(deltaTime);
-        
         if (state == AnimatorState::Playing)
         {
             UpdateAnimation(deltaTime);
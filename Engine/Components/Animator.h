@@ -1,5 +1,6 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
 #include "../Resources/AnimationClip.h"
 #include <memory>
 #include <unordered_map>
@@ -22,7 +23,7 @@ namespace AronEngine
         std::shared_ptr<AnimationClip> currentAnimation;
         std::string currentAnimationName;
         
-        SpriteRenderer* spriteRenderer;
+        InstancePtr<SpriteRenderer> spriteRenderer;
         
         float currentTime;
         float speed;
@@ -38,9 +39,21 @@ namespace AronEngine
         Animator();
         virtual ~Animator() = default;
 
-        virtual void Start() override;
-        virtual void Update(float deltaTime) override;
+        virtual void OnStart() override;
+        virtual void OnUpdate(float deltaTime) override;
         virtual void OnDestroy() override;
+        virtual void OnReset() override;
+
+        // Clips are built in code from sprites, so only playback settings are saved
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT(Animator,
+            AE_FIELD(speed).Min(0.0f).Set(&Animator::SetSpeed),
+            AE_FIELD(autoPlay).Set(&Animator::SetAutoPlay),
+            AE_FIELD(defaultAnimation).Set(&Animator::SetDefaultAnimation))
 
         void AddAnimation(const std::string& name, std::shared_ptr<AnimationClip> clip);
         void RemoveAnimation(const std::string& name);
@@ -79,6 +92,7 @@ namespace AronEngine
     private:
         void UpdateAnimation(float deltaTime);
         void UpdateSpriteRenderer();
+        void PlayAutoPlayAnimation();
         SpriteRenderer* FindSpriteRenderer();
     };
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "framework.h"
+#include "AudioListener.h"
+#include "../Core/EngineApp.h"
+#include "../Systems/AudioSystem.h"
+
+namespace AronEngine
+{
+    AudioListener::AudioListener()
+        : Component("AudioListener")
+        , registeredSystem(nullptr)
+    {
+    }
+
+    AudioListener::~AudioListener()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterListener(this);
+        }
+    }
+
+    void AudioListener::OnEnable()
+    {
+        if (!registeredSystem)
+        {
+            if (auto* audioSystem = EngineApp::GetInstance().GetAudioSystem())
+            {
+                audioSystem->RegisterListener(this);
+            }
+        }
+    }
+
+    void AudioListener::OnDisable()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterListener(this);
+        }
+    }
+
+    void AudioListener::OnDestroy()
+    {
+        OnDisable();
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "Component.h"
+
+namespace AronEngine
+{
+    class AudioSystem;
+
+    // Spatial AudioSources are attenuated and panned relative to the active listener
+    class AudioListener : public Component
+    {
+        DECLARE_OBJECT_TYPE(AudioListener)
+
+    private:
+        InstancePtr<AudioSystem> registeredSystem;
+
+    public:
+        AudioListener();
+        virtual ~AudioListener() override;
+
+        void OnEnable() override;
+        void OnDisable() override;
+        void OnDestroy() override;
+
+    private:
+        friend class AudioSystem;
+        void SetRegisteredSystem(AudioSystem* system) { registeredSystem = system; }
+    };
+}
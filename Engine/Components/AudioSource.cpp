@@ -3,12 +3,21 @@
 #include "../Resources/AudioClip.h"
 #include "../Core/GameObject.h"
 #include "../Components/Transform.h"
+#include "../Managers/AudioManager.h"
+#include "../Core/EngineApp.h"
+#include "../Core/AssetRequestQueue.h"
+#include "../Systems/AudioSystem.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
     AudioSource::AudioSource()
         : Component()
         , clip(nullptr)
+        , voice(InvalidVoiceHandle)
         , isPlaying(false)
         , isPaused(false)
         , loop(false)
@@ -19,12 +28,40 @@ namespace AronEngine
         , maxDistance(500.0f)
         , mute(false)
         , priority(128)         // Medium priority
+        , spatialGain(1.0f)
+        , spatialPan(0.0f)
+        , spatialPitch(1.0f)
+        , registeredSystem(nullptr)
+    {
+    }
+
+    AudioSource::AudioSource(const AudioSource& other)
+        : Component(other)
+        , clip(other.clip)
+        , voice(InvalidVoiceHandle)
+        , isPlaying(false)
+        , isPaused(false)
+        , loop(other.loop)
+        , volume(other.volume)
+        , pitch(other.pitch)
+        , spatialBlend(other.spatialBlend)
+        , minDistance(other.minDistance)
+        , maxDistance(other.maxDistance)
+        , mute(other.mute)
+        , priority(other.priority)
+        , spatialGain(1.0f)
+        , spatialPan(0.0f)
+        , spatialPitch(1.0f)
     {
     }
 
     AudioSource::~AudioSource()
     {
         Stop();
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterSource(this);
+        }
     }
 
     void AudioSource::Start()
@@ -33,22 +70,86 @@ namespace AronEngine
         DEBUG_LOG("AudioSource started on GameObject: " + GetGameObject()->GetName());
     }
 
-    void AudioSource::Update(float deltaTime)
+    void AudioSource::OnEnable()
     {
-        Component::Update(deltaTime);
-        
-        if (isPlaying && !isPaused && spatialBlend > 0.0f)
+        if (!registeredSystem)
         {
-            UpdateSpatialAudio();
+            if (auto* audioSystem = EngineApp::GetInstance().GetAudioSystem())
+            {
+                audioSystem->RegisterSource(this);
+            }
+        }
+    }
+
+    void AudioSource::OnDisable()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterSource(this);
         }
     }
 
     void AudioSource::OnDestroy()
     {
         Stop();
+        OnDisable();
         Component::OnDestroy();
     }
 
+    void AudioSource::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        if (clip && !clip->GetFilePath().empty())
+        {
+            writer.Write("clip", clip->GetFilePath());
+        }
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool AudioSource::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        // Not attached or playing yet, so fields are set directly rather than through the mixer
+        if (key == "clip")
+        {
+            std::string path;
+            if (!reader.Read(path)) return false;
+            if (!path.empty()) LoadSavedClip(path);
+            return true;
+        }
+
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void AudioSource::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        writer.WriteString(clip ? clip->GetFilePath() : std::string());
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool AudioSource::ReadBinary(BinaryReader& reader)
+    {
+        std::string_view path;
+        if (!Component::ReadBinary(reader) || !reader.ReadString(path)) return false;
+        if (!path.empty()) LoadSavedClip(std::string(path));
+
+        return Reflection::ReadBinary(*this, reader);
+    }
+
+    void AudioSource::LoadSavedClip(const std::string& path)
+    {
+        // The clip cache belongs to the main thread
+        if (AssetRequestQueue* queue = AssetRequestQueue::GetCurrent())
+        {
+            queue->Push([this, path]() { clip = AudioManager::GetInstance().LoadAudioClip(path); });
+            return;
+        }
+
+        clip = AudioManager::GetInstance().LoadAudioClip(path);
+    }
+
     void AudioSource::Play()
     {
         if (!clip)
@@ -63,27 +164,26 @@ namespace AronEngine
             return;
         }
 
-        auto soundBuffer = clip->GetSoundBuffer();
-        if (!soundBuffer)
+        auto* mixer = AudioManager::GetInstance().GetMixer();
+        mixer->Stop(voice);
+
+        // Start at the spatial values the next Update would give, or the first block plays at
+        // whatever the source was left with and ramps from there
+        if (registeredSystem)
         {
-            DEBUG_LOG("AudioSource::Play() - No sound buffer!");
-            return;
+            registeredSystem->ComputeSpatial(*this, spatialGain, spatialPan, spatialPitch);
         }
 
         DEBUG_LOG("Playing audio clip: " + clip->GetFilePath());
-        
-        // Set volume
-        long attenuation = static_cast<long>(2000.0f * log10f(std::max(0.001f, volume * (mute ? 0.0f : 1.0f))));
-        attenuation = std::max(DSBVOLUME_MIN, std::min(DSBVOLUME_MAX, attenuation));
-        soundBuffer->SetVolume(attenuation);
 
-        // Set looping
-        DWORD playFlags = loop ? DSBPLAY_LOOPING : 0;
-        
-        // Play the sound
-        HRESULT result = soundBuffer->Play(0, 0, playFlags);
-        if (SUCCEEDED(result))
+        // Pitch and the clip/output rate difference are handled by the mixer's resampler
+        voice = mixer->Play(clip, GetEffectiveVolume(), GetEffectivePitch(), loop, priority);
+        if (voice != InvalidVoiceHandle)
         {
+            if (spatialPan != 0.0f)
+            {
+                mixer->SetPan(voice, spatialPan);
+            }
             isPlaying = true;
             isPaused = false;
             DEBUG_LOG("Audio playing successfully");
@@ -109,16 +209,16 @@ namespace AronEngine
         }
 
         DEBUG_LOG("Playing one-shot audio: " + clipToPlay->GetFilePath());
-        
-        // TODO: Implement one-shot playback that doesn't affect main clip
-        // This should play the sound once without changing the current clip
+
+        // Fire-and-forget voice; the main clip keeps playing
+        AudioManager::GetInstance().GetMixer()->Play(clipToPlay, GetEffectiveVolume(), GetEffectivePitch(), false, priority);
     }
 
     void AudioSource::Pause()
     {
-        if (isPlaying && !isPaused && clip && clip->GetSoundBuffer())
+        if (IsPlaying() && !isPaused)
         {
-            clip->GetSoundBuffer()->Stop();
+            AudioManager::GetInstance().GetMixer()->SetPaused(voice, true);
             isPaused = true;
             DEBUG_LOG("Audio paused");
         }
@@ -126,10 +226,9 @@ namespace AronEngine
 
     void AudioSource::UnPause()
     {
-        if (isPlaying && isPaused && clip && clip->GetSoundBuffer())
+        if (IsPlaying() && isPaused)
         {
-            DWORD playFlags = loop ? DSBPLAY_LOOPING : 0;
-            clip->GetSoundBuffer()->Play(0, 0, playFlags);
+            AudioManager::GetInstance().GetMixer()->SetPaused(voice, false);
             isPaused = false;
             DEBUG_LOG("Audio unpaused");
         }
@@ -137,16 +236,40 @@ namespace AronEngine
 
     void AudioSource::Stop()
     {
-        if (isPlaying && clip && clip->GetSoundBuffer())
+        if (isPlaying)
         {
-            clip->GetSoundBuffer()->Stop();
-            clip->GetSoundBuffer()->SetCurrentPosition(0);
+            AudioManager::GetInstance().GetMixer()->Stop(voice);
+            voice = InvalidVoiceHandle;
             isPlaying = false;
             isPaused = false;
             DEBUG_LOG("Audio stopped");
         }
     }
 
+    bool AudioSource::IsPlaying() const
+    {
+        // Non-looping voices end on their own inside the mixer
+        return isPlaying && AudioManager::GetInstance().GetMixer()->IsPlaying(voice);
+    }
+
+    void AudioSource::SetVolume(float vol)
+    {
+        volume = std::max(0.0f, std::min(1.0f, vol));
+        AudioManager::GetInstance().GetMixer()->SetVolume(voice, GetEffectiveVolume());
+    }
+
+    void AudioSource::SetPitch(float p)
+    {
+        pitch = std::max(0.1f, std::min(3.0f, p));
+        AudioManager::GetInstance().GetMixer()->SetPitch(voice, GetEffectivePitch());
+    }
+
+    void AudioSource::SetMute(bool shouldMute)
+    {
+        mute = shouldMute;
+        AudioManager::GetInstance().GetMixer()->SetVolume(voice, GetEffectiveVolume());
+    }
+
     void AudioSource::SetClip(std::shared_ptr<AudioClip> newClip)
     {
         // Stop current audio if playing
@@ -167,22 +290,19 @@ namespace AronEngine
         }
     }
 
-    void AudioSource::UpdateSpatialAudio()
+    void AudioSource::ApplySpatial(float gain, float pan, float pitchScale)
     {
-        // Get position from Transform component
-        auto transform = GetGameObject()->GetComponent<Transform>();
-        if (!transform) return;
-
-        Vector2 position = transform->GetPosition();
-        
-        // TODO: Implement 3D audio positioning using DirectSound3D
-        // Calculate distance to listener, apply volume falloff, etc.
-        
-        // For now, just log the position update
-        static int frameCount = 0;
-        if (frameCount++ % 60 == 0)  // Log every 60 frames to avoid spam
+        // Skip inaudible changes so static emitters cost no mixer commands
+        constexpr float epsilon = 1e-3f;
+        if (std::fabs(gain - spatialGain) < epsilon && std::fabs(pan - spatialPan) < epsilon &&
+            std::fabs(pitchScale - spatialPitch) < epsilon * 0.1f)
         {
-            DEBUG_LOG("3D Audio position update: (" + std::to_string(position.x) + ", " + std::to_string(position.y) + ")");
+            return;
         }
+
+        spatialGain = gain;
+        spatialPan = pan;
+        spatialPitch = pitchScale;
+        AudioManager::GetInstance().GetMixer()->SetParams(voice, GetEffectiveVolume(), spatialPan, GetEffectivePitch());
     }
 }
\ No newline at end of file
@@ -1,15 +1,19 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
+#include "../Audio/AudioMixer.h"
 #include <memory>
 
 namespace AronEngine
 {
     class AudioClip;
+    class AudioSystem;
 
     class AudioSource : public Component
     {
     private:
         std::shared_ptr<AudioClip> clip;
+        AudioVoiceHandle voice;
         bool isPlaying;
         bool isPaused;
         bool loop;
@@ -25,15 +29,41 @@ namespace AronEngine
         // Priority for audio mixing (0 = highest, 256 = lowest)
         int priority;
 
+        // Written by AudioSystem's spatial pass
+        float spatialGain;
+        float spatialPan;
+        float spatialPitch;
+        InstancePtr<AudioSystem> registeredSystem;
+
     public:
         AudioSource();
+        // Copies the settings only; the copy starts silent with no voice
+        AudioSource(const AudioSource& other);
         virtual ~AudioSource() override;
 
         // Component lifecycle
         void Start() override;
-        void Update(float deltaTime) override;
+        void OnEnable() override;
+        void OnDisable() override;
         void OnDestroy() override;
 
+        // Settings and the clip's file path; playback state is not saved
+        void Serialize(JsonWriter& writer) const override;
+        bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        bool ReadBinary(BinaryReader& reader) override;
+
+        // The clip is an asset reference, saved by hand ahead of these
+        AE_REFLECT(AudioSource,
+            AE_FIELD(loop).Set(&AudioSource::SetLoop),
+            AE_FIELD(volume).Range(0.0f, 1.0f).Set(&AudioSource::SetVolume),
+            AE_FIELD(pitch).Range(0.1f, 3.0f).Set(&AudioSource::SetPitch),
+            AE_FIELD(mute).Set(&AudioSource::SetMute),
+            AE_FIELD(spatialBlend).Range(0.0f, 1.0f).Set(&AudioSource::SetSpatialBlend),
+            AE_FIELD(minDistance).Set(&AudioSource::SetMinDistance),
+            AE_FIELD(maxDistance).Set(&AudioSource::SetMaxDistance),
+            AE_FIELD(priority).Range(0.0f, 256.0f).Set(&AudioSource::SetPriority))
+
         // Playback control
         void Play();
         void PlayOneShot(std::shared_ptr<AudioClip> clipToPlay);
@@ -45,16 +75,16 @@ namespace AronEngine
         void SetClip(std::shared_ptr<AudioClip> newClip);
         std::shared_ptr<AudioClip> GetClip() const { return clip; }
 
-        void SetVolume(float vol) { volume = std::max(0.0f, std::min(1.0f, vol)); }
+        void SetVolume(float vol);
         float GetVolume() const { return volume; }
 
-        void SetPitch(float p) { pitch = std::max(0.1f, std::min(3.0f, p)); }
+        void SetPitch(float p);
         float GetPitch() const { return pitch; }
 
         void SetLoop(bool shouldLoop) { loop = shouldLoop; }
         bool GetLoop() const { return loop; }
 
-        void SetMute(bool shouldMute) { mute = shouldMute; }
+        void SetMute(bool shouldMute);
         bool GetMute() const { return mute; }
 
         void SetSpatialBlend(float blend) { spatialBlend = std::max(0.0f, std::min(1.0f, blend)); }
@@ -70,10 +100,20 @@ namespace AronEngine
         int GetPriority() const { return priority; }
 
         // Status
-        bool IsPlaying() const { return isPlaying; }
+        bool IsPlaying() const;
         bool IsPaused() const { return isPaused; }
+        bool HasVoice() const { return isPlaying && voice != InvalidVoiceHandle; }
+
+        // Attenuation gain, pan and Doppler pitch scale from the spatial pass
+        void ApplySpatial(float gain, float pan, float pitchScale);
 
     private:
-        void UpdateSpatialAudio();
+        friend class AudioSystem;
+        void SetRegisteredSystem(AudioSystem* system) { registeredSystem = system; }
+        // Scene file clip; queued when the scene is being built in the background
+        void LoadSavedClip(const std::string& path);
+
+        float GetEffectiveVolume() const { return mute ? 0.0f : volume * spatialGain; }
+        float GetEffectivePitch() const { return pitch * spatialPitch; }
     };
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "framework.h"
+#include "Camera.h"
+#include "Transform.h"
+#include "../Core/EngineApp.h"
+#include "../Systems/RenderSystem.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
+
+namespace AronEngine
+{
+    Camera::Camera()
+        : Component("Camera")
+        , zoom(1.0f)
+        , depth(0)
+        , viewportPosition(0.0f, 0.0f)
+        , viewportSize(1.0f, 1.0f)
+        , registeredSystem(nullptr)
+    {
+    }
+
+    Camera::~Camera()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterCamera(this);
+        }
+    }
+
+    void Camera::SetViewport(const Vector2& position, const Vector2& size)
+    {
+        viewportPosition = Vector2((std::min)((std::max)(position.x, 0.0f), 1.0f), (std::min)((std::max)(position.y, 0.0f), 1.0f));
+        viewportSize = Vector2((std::min)((std::max)(size.x, 0.0f), 1.0f - viewportPosition.x),
+            (std::min)((std::max)(size.y, 0.0f), 1.0f - viewportPosition.y));
+    }
+
+    D2D1_RECT_F Camera::GetPixelRect(float targetWidth, float targetHeight) const
+    {
+        return D2D1::RectF(
+            viewportPosition.x * targetWidth,
+            viewportPosition.y * targetHeight,
+            (viewportPosition.x + viewportSize.x) * targetWidth,
+            (viewportPosition.y + viewportSize.y) * targetHeight);
+    }
+
+    Matrix3x2 Camera::GetViewMatrix(float targetWidth, float targetHeight) const
+    {
+        Vector2 position(0.0f, 0.0f);
+        float rotation = 0.0f;
+        if (Transform* transform = GetTransform())
+        {
+            position = transform->GetPosition();
+            rotation = transform->GetRotation();
+        }
+
+        // The camera's position lands on the viewport's centre
+        const D2D1_RECT_F pixels = GetPixelRect(targetWidth, targetHeight);
+        const Vector2 center((pixels.left + pixels.right) * 0.5f, (pixels.top + pixels.bottom) * 0.5f);
+
+        Matrix3x2 view = Matrix3x2::Translation(-position.x, -position.y);
+        if (rotation != 0.0f)
+        {
+            view = view * Matrix3x2::Rotation(-rotation);
+        }
+        return view * Matrix3x2::Scale(zoom) * Matrix3x2::Translation(center);
+    }
+
+    D2D1_RECT_F Camera::GetWorldBounds(float targetWidth, float targetHeight) const
+    {
+        const Matrix3x2 inverse = GetViewMatrix(targetWidth, targetHeight).Inverse();
+        const D2D1_RECT_F pixels = GetPixelRect(targetWidth, targetHeight);
+        const Vector2 corners[4] = {
+            inverse.TransformPoint(Vector2(pixels.left, pixels.top)),
+            inverse.TransformPoint(Vector2(pixels.right, pixels.top)),
+            inverse.TransformPoint(Vector2(pixels.left, pixels.bottom)),
+            inverse.TransformPoint(Vector2(pixels.right, pixels.bottom)),
+        };
+
+        D2D1_RECT_F bounds = D2D1::RectF(corners[0].x, corners[0].y, corners[0].x, corners[0].y);
+        for (const Vector2& corner : corners)
+        {
+            bounds.left = (std::min)(bounds.left, corner.x);
+            bounds.top = (std::min)(bounds.top, corner.y);
+            bounds.right = (std::max)(bounds.right, corner.x);
+            bounds.bottom = (std::max)(bounds.bottom, corner.y);
+        }
+        return bounds;
+    }
+
+    Vector2 Camera::WorldToScreen(const Vector2& world, float targetWidth, float targetHeight) const
+    {
+        return GetViewMatrix(targetWidth, targetHeight).TransformPoint(world);
+    }
+
+    Vector2 Camera::ScreenToWorld(const Vector2& screen, float targetWidth, float targetHeight) const
+    {
+        return GetViewMatrix(targetWidth, targetHeight).Inverse().TransformPoint(screen);
+    }
+
+    void Camera::OnEnable()
+    {
+        if (!registeredSystem)
+        {
+            if (auto* renderSystem = EngineApp::GetInstance().GetRenderSystem())
+            {
+                renderSystem->RegisterCamera(this);
+            }
+        }
+    }
+
+    void Camera::OnDisable()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterCamera(this);
+        }
+    }
+
+    void Camera::OnDestroy()
+    {
+        OnDisable();
+        Component::OnDestroy();
+    }
+
+    void Camera::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool Camera::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void Camera::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool Camera::ReadBinary(BinaryReader& reader)
+    {
+        return Component::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "Component.h"
+#include "Reflection.h"
+#include "../Utils/Vector2.h"
+#include "../Utils/Matrix3x2.h"
+
+namespace AronEngine
+{
+    class RenderSystem;
+
+    // Looks at its object's world position, turned by its rotation, and draws into a
+    // normalized viewport of the render target. zoom is target pixels per world unit.
+    // Cameras render in ascending depth; with none enabled the world is drawn untransformed.
+    class Camera : public Component
+    {
+        DECLARE_OBJECT_TYPE(Camera)
+
+    private:
+        float zoom;
+        int depth;
+        Vector2 viewportPosition;   // top-left, 0..1 of the target
+        Vector2 viewportSize;       // 0..1 of the target
+        InstancePtr<RenderSystem> registeredSystem;
+
+    public:
+        Camera();
+        virtual ~Camera() override;
+
+        void SetZoom(float value) { zoom = (std::max)(value, 0.01f); }
+        float GetZoom() const { return zoom; }
+
+        void SetDepth(int value) { depth = value; }
+        int GetDepth() const { return depth; }
+
+        void SetViewport(const Vector2& position, const Vector2& size);
+        void SetViewportPosition(const Vector2& position) { SetViewport(position, viewportSize); }
+        void SetViewportSize(const Vector2& size) { SetViewport(viewportPosition, size); }
+        const Vector2& GetViewportPosition() const { return viewportPosition; }
+        const Vector2& GetViewportSize() const { return viewportSize; }
+
+        // The viewport in target pixels
+        D2D1_RECT_F GetPixelRect(float targetWidth, float targetHeight) const;
+        // World to target pixels
+        Matrix3x2 GetViewMatrix(float targetWidth, float targetHeight) const;
+        // World-space box around everything the viewport can show
+        D2D1_RECT_F GetWorldBounds(float targetWidth, float targetHeight) const;
+
+        Vector2 WorldToScreen(const Vector2& world, float targetWidth, float targetHeight) const;
+        Vector2 ScreenToWorld(const Vector2& screen, float targetWidth, float targetHeight) const;
+
+        void OnEnable() override;
+        void OnDisable() override;
+        void OnDestroy() override;
+
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT(Camera,
+            AE_FIELD(zoom).Min(0.01f),
+            AE_FIELD(depth),
+            AE_FIELD(viewportPosition).Set(&Camera::SetViewportPosition),
+            AE_FIELD(viewportSize).Set(&Camera::SetViewportSize))
+
+    private:
+        friend class RenderSystem;
+        void SetRegisteredSystem(RenderSystem* system) { registeredSystem = system; }
+    };
+}
@@ -3,6 +3,13 @@
 #include "Transform.h"
 #include "../Core/GameObject.h"
 #include "../Core/Renderer.h"
+#include "../Core/EngineApp.h"
+#include "../Core/EngineStats.h"
+#include "../Systems/PhysicsSystem.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 #include <cmath>
 
 namespace AronEngine
@@ -14,24 +21,68 @@ namespace AronEngine
         , isTrigger(false)
         , isEnabled(true)
         , type(colliderType)
+        , registeredSystem(nullptr)
+        , systemSlot(-1)
     {
     }
 
-    void Collider::Start()
+    Collider::~Collider()
     {
-        Component::Start();
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterCollider(this);
+        }
+    }
+
+    void Collider::OnEnable()
+    {
+        if (!registeredSystem)
+        {
+            if (auto* physicsSystem = EngineApp::GetInstance().GetPhysicsSystem())
+            {
+                physicsSystem->RegisterCollider(this);
+            }
+        }
     }
 
-    void Collider::Update(float deltaTime)
+    void Collider::OnDisable()
     {
-        Component::Update(deltaTime);
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterCollider(this);
+        }
     }
 
     void Collider::OnDestroy()
     {
+        OnDisable();
         Component::OnDestroy();
     }
 
+    void Collider::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool Collider::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void Collider::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool Collider::ReadBinary(BinaryReader& reader)
+    {
+        return Component::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+
     Vector2 Collider::GetWorldCenter() const
     {
         return GetWorldPosition() + offset;
@@ -53,6 +104,30 @@ namespace AronEngine
     {
     }
 
+    void BoxCollider::Serialize(JsonWriter& writer) const
+    {
+        Collider::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool BoxCollider::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Collider::DeserializeProperty(key, reader);
+    }
+
+    void BoxCollider::WriteBinary(BinaryWriter& writer) const
+    {
+        Collider::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool BoxCollider::ReadBinary(BinaryReader& reader)
+    {
+        return Collider::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+
     Vector2 BoxCollider::GetWorldSize() const
     {
         if (!gameObject)
@@ -85,16 +160,27 @@ namespace AronEngine
     {
         if (!other || !isEnabled || !other->IsEnabled())
             return CollisionInfo();
-            
+
+        EngineStats::Add(StatCounter::CollisionPairsTested);
+
+        CollisionInfo info;
         switch (other->GetColliderType())
         {
             case ColliderType::Box:
-                return CheckCollisionWithBox(static_cast<const BoxCollider*>(other));
+                info = CheckCollisionWithBox(static_cast<const BoxCollider*>(other));
+                break;
             case ColliderType::Circle:
-                return CheckCollisionWithCircle(static_cast<const CircleCollider*>(other));
+                info = CheckCollisionWithCircle(static_cast<const CircleCollider*>(other));
+                break;
             default:
-                return CollisionInfo();
+                break;
+        }
+
+        if (info.isColliding)
+        {
+            EngineStats::Add(StatCounter::Contacts);
         }
+        return info;
     }
 
     CollisionInfo BoxCollider::CheckCollisionWithBox(const BoxCollider* other) const
@@ -145,15 +231,15 @@ namespace AronEngine
         float circleRadius = other->GetWorldRadius();
         
         Vector2 halfSize = boxSize * 0.5f;
-        Vector2 distance = circleCenter - boxCenter;
+        Vector2 offset = circleCenter - boxCenter;
         
         Vector2 clamped = Vector2(
-            (std::max)(-halfSize.x, (std::min)(halfSize.x, distance.x)),
-            (std::max)(-halfSize.y, (std::min)(halfSize.y, distance.y))
+            (std::max)(-halfSize.x, (std::min)(halfSize.x, offset.x)),
+            (std::max)(-halfSize.y, (std::min)(halfSize.y, offset.y))
         );
         
         Vector2 closest = boxCenter + clamped;
-        distance = circleCenter - closest;
+        Vector2 distance = circleCenter - closest;
         
         float distanceSquared = distance.LengthSquared();
         float radiusSquared = circleRadius * circleRadius;
@@ -171,9 +257,20 @@ namespace AronEngine
             }
             else
             {
-                info.normal = Vector2(1, 0);
-                info.penetrationDepth = circleRadius;
-                info.contactPoint = boxCenter;
+                // Circle center inside the box: push out along the axis of least penetration
+                float overlapX = halfSize.x - std::abs(offset.x);
+                float overlapY = halfSize.y - std::abs(offset.y);
+                if (overlapX < overlapY)
+                {
+                    info.normal = Vector2(offset.x < 0 ? -1.0f : 1.0f, 0.0f);
+                    info.penetrationDepth = overlapX + circleRadius;
+                }
+                else
+                {
+                    info.normal = Vector2(0.0f, offset.y < 0 ? -1.0f : 1.0f);
+                    info.penetrationDepth = overlapY + circleRadius;
+                }
+                info.contactPoint = circleCenter;
             }
         }
         
@@ -198,6 +295,30 @@ namespace AronEngine
     {
     }
 
+    void CircleCollider::Serialize(JsonWriter& writer) const
+    {
+        Collider::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool CircleCollider::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Collider::DeserializeProperty(key, reader);
+    }
+
+    void CircleCollider::WriteBinary(BinaryWriter& writer) const
+    {
+        Collider::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool CircleCollider::ReadBinary(BinaryReader& reader)
+    {
+        return Collider::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+
     float CircleCollider::GetWorldRadius() const
     {
         if (!gameObject)
@@ -226,16 +347,27 @@ namespace AronEngine
     {
         if (!other || !isEnabled || !other->IsEnabled())
             return CollisionInfo();
-            
+
+        EngineStats::Add(StatCounter::CollisionPairsTested);
+
+        CollisionInfo info;
         switch (other->GetColliderType())
         {
             case ColliderType::Box:
-                return CheckCollisionWithBox(static_cast<const BoxCollider*>(other));
+                info = CheckCollisionWithBox(static_cast<const BoxCollider*>(other));
+                break;
             case ColliderType::Circle:
-                return CheckCollisionWithCircle(static_cast<const CircleCollider*>(other));
+                info = CheckCollisionWithCircle(static_cast<const CircleCollider*>(other));
+                break;
             default:
-                return CollisionInfo();
+                break;
         }
+
+        if (info.isColliding)
+        {
+            EngineStats::Add(StatCounter::Contacts);
+        }
+        return info;
     }
 
     CollisionInfo CircleCollider::CheckCollisionWithBox(const BoxCollider* other) const
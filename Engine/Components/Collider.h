@@ -1,10 +1,13 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
 #include "../Utils/Vector2.h"
 #include "../Utils/Color.h"
 
 namespace AronEngine
 {
+    class PhysicsSystem;
+
     enum class ColliderType
     {
         Box,
@@ -29,15 +32,27 @@ namespace AronEngine
         bool isTrigger;
         bool isEnabled;
         ColliderType type;
+        InstancePtr<PhysicsSystem> registeredSystem;
+        int32_t systemSlot;                 // index in the physics system's list, -1 when unregistered
         
     public:
         Collider(const std::string& name, ColliderType colliderType);
-        virtual ~Collider() = default;
+        virtual ~Collider();
 
-        virtual void Start() override;
-        virtual void Update(float deltaTime) override;
+        virtual void OnEnable() override;
+        virtual void OnDisable() override;
         virtual void OnDestroy() override;
 
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT(Collider,
+            AE_FIELD(offset).Set(&Collider::SetOffset),
+            AE_FIELD_AS(isTrigger, "trigger").Set(&Collider::SetTrigger),
+            AE_FIELD_AS(isEnabled, "colliderEnabled").Set(&Collider::SetEnabled))
+
         void SetOffset(const Vector2& newOffset) { offset = newOffset; }
         const Vector2& GetOffset() const { return offset; }
         
@@ -56,6 +71,10 @@ namespace AronEngine
         
     protected:
         Vector2 GetWorldPosition() const;
+
+    private:
+        friend class PhysicsSystem;
+        void SetRegisteredSystem(PhysicsSystem* system) { registeredSystem = system; }
     };
 
     class CircleCollider;
@@ -75,6 +94,14 @@ namespace AronEngine
         const Vector2& GetSize() const { return size; }
         
         Vector2 GetWorldSize() const;
+
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT_DERIVED(BoxCollider, Collider,
+            AE_FIELD(size).Set(&BoxCollider::SetSize))
         
         virtual bool ContainsPoint(const Vector2& worldPoint) const override;
         virtual CollisionInfo CheckCollision(const Collider* other) const override;
@@ -100,6 +127,14 @@ namespace AronEngine
         float GetRadius() const { return radius; }
         
         float GetWorldRadius() const;
+
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT_DERIVED(CircleCollider, Collider,
+            AE_FIELD(radius).Min(0.0f).Set(&CircleCollider::SetRadius))
         
         virtual bool ContainsPoint(const Vector2& worldPoint) const override;
         virtual CollisionInfo CheckCollision(const Collider* other) const override;
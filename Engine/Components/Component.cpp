@@ -1,6 +1,12 @@
 #include "framework.h"
 #include "Component.h"
 #include "../Core/GameObject.h"
+#include "../Core/Scene.h"
+#include "../Core/ObjectPools.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -8,14 +14,37 @@ namespace AronEngine
         : Object("Component")
         , gameObject(nullptr)
         , enabled(true)
+        , typeInfo(nullptr)
     {
+        for (auto& slot : phaseSlots) slot = -1;
     }
     
     Component::Component(const std::string& name)
         : Object(name)
         , gameObject(nullptr)
         , enabled(true)
+        , typeInfo(nullptr)
     {
+        for (auto& slot : phaseSlots) slot = -1;
+    }
+
+    Component::Component(const Component& other)
+        : Object(other)
+        , gameObject(nullptr)
+        , enabled(other.enabled)
+        , typeInfo(other.typeInfo)
+    {
+        for (auto& slot : phaseSlots) slot = -1;
+    }
+
+    void* Component::operator new(size_t size)
+    {
+        return ObjectPools::AllocateComponent(size);
+    }
+
+    void Component::operator delete(void* block, size_t size)
+    {
+        ObjectPools::FreeComponent(block, size);
     }
 
     Transform* Component::GetTransform() const
@@ -33,6 +62,43 @@ namespace AronEngine
                 OnEnable();
             else
                 OnDisable();
+
+            RefreshUpdateLists();
+        }
+    }
+
+    void Component::Serialize(JsonWriter& writer) const
+    {
+        writer.Write("enabled", enabled);
+    }
+
+    bool Component::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        if (key == "enabled") return reader.Read(enabled);
+        return false;
+    }
+
+    void Component::WriteBinary(BinaryWriter& writer) const
+    {
+        writer.Write(enabled);
+    }
+
+    bool Component::ReadBinary(BinaryReader& reader)
+    {
+        return reader.Read(enabled);
+    }
+
+    void Component::OnActiveChanged()
+    {
+        RefreshUpdateLists();
+    }
+
+    void Component::RefreshUpdateLists()
+    {
+        Scene* scene = gameObject ? gameObject->GetScene() : nullptr;
+        if (scene)
+        {
+            scene->RefreshComponentUpdates(this);
         }
     }
 }
\ No newline at end of file
@@ -1,24 +1,76 @@
 #pragma once
 #include "../Core/Object.h"
+#include <string_view>
 
 namespace AronEngine
 {
     class GameObject;
     class Transform;
+    class Scene;
+    struct ComponentTypeInfo;
+    class JsonWriter;
+    class JsonReader;
+    class BinaryWriter;
+    class BinaryReader;
 
+    // Per-frame hooks the scene keeps dense per-type lists for
+    enum class ComponentPhase : uint8_t
+    {
+        Update,
+        LateUpdate,
+        FixedUpdate,
+
+        Count
+    };
+
+    constexpr size_t kComponentPhaseCount = static_cast<size_t>(ComponentPhase::Count);
+
+    // A link only the live instance owns (the system it registered with, a cached sibling).
+    // Copying a component for a prefab clone leaves it null so the clone links itself.
+    template<typename T>
+    class InstancePtr
+    {
+    private:
+        T* pointer;
+
+    public:
+        InstancePtr(T* value = nullptr) : pointer(value) {}
+        InstancePtr(const InstancePtr&) : pointer(nullptr) {}
+        InstancePtr& operator=(const InstancePtr&) = delete;
+        InstancePtr& operator=(T* value) { pointer = value; return *this; }
+
+        operator T*() const { return pointer; }
+        T* operator->() const { return pointer; }
+    };
+
+    // Overrides of OnUpdate/OnLateUpdate/OnFixedUpdate are detected per type when the component
+    // is added; types that don't override a hook never get called for it.
     class Component : public Object
     {
         DECLARE_OBJECT_TYPE(Component)
 
+        friend class GameObject;
+        friend class Scene;
+
     protected:
         GameObject* gameObject;
         bool enabled;
 
+    private:
+        const ComponentTypeInfo* typeInfo;
+        int32_t phaseSlots[kComponentPhaseCount];   // index in the scene's per-type list, -1 if absent
+
     public:
         Component();
         Component(const std::string& name);
+        // Detached copy: same settings, no GameObject and not in any update list
+        Component(const Component& other);
         virtual ~Component() = default;
 
+        // Size-class pools in ObjectPools; the virtual destructor passes the derived size back
+        static void* operator new(size_t size);
+        static void operator delete(void* block, size_t size);
+
         GameObject* GetGameObject() const { return gameObject; }
         void SetGameObject(GameObject* go) { gameObject = go; }
         
@@ -27,6 +79,9 @@ namespace AronEngine
         bool IsEnabled() const { return enabled && IsActive(); }
         void SetEnabled(bool enabled);
 
+        // Null for components that weren't added through GameObject::AddComponent
+        const ComponentTypeInfo* GetTypeInfo() const { return typeInfo; }
+
         virtual void Start() {}
         virtual void Update(float deltaTime) {}
         virtual void OnDestroy() {}
@@ -38,8 +93,27 @@ namespace AronEngine
         virtual void OnLateUpdate(float deltaTime) {}
         virtual void OnFixedUpdate(float fixedDeltaTime) {}
         virtual void OnDisable() {}
+        // A pooled object went back to its GameObjectPool: drop per-use state so the next
+        // Acquire behaves like a freshly built instance
+        virtual void OnReset() {}
+
+        // Scene files: write settings as members of the component's JSON object. Load hands
+        // back one member at a time before the component is attached; return false for keys
+        // you don't know so they get skipped. Overrides call the base version first.
+        virtual void Serialize(JsonWriter& writer) const;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader);
+        // Binary scene files: the same settings as fixed-size fields, read back in the order
+        // written with no keys. Any change to the field list needs a scene format version bump.
+        virtual void WriteBinary(BinaryWriter& writer) const;
+        virtual bool ReadBinary(BinaryReader& reader);
 
         virtual void OnDrawGizmos() {}
         virtual void OnDrawGizmosSelected() {}
+
+    protected:
+        void OnActiveChanged() override;
+
+    private:
+        void RefreshUpdateLists();
     };
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "framework.h"
+#include "ComponentRegistry.h"
+#include <mutex>
+
+namespace AronEngine
+{
+    namespace
+    {
+        struct RegistryState
+        {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ComponentTypeInfo>> types;
+        };
+
+        RegistryState& GetRegistry()
+        {
+            static RegistryState registry;
+            return registry;
+        }
+    }
+
+    const ComponentTypeInfo* ComponentRegistry::Register(const std::type_info& type, size_t size,
+        Component* (*clone)(const Component&), Component* (*create)(), bool update, bool lateUpdate, bool fixedUpdate,
+        const ReflectedField* fields, uint32_t fieldCount)
+    {
+        RegistryState& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto info = std::make_unique<ComponentTypeInfo>();
+        info->id = static_cast<uint32_t>(registry.types.size());
+
+        // "class AronEngine::Rigidbody" -> "Rigidbody"
+        std::string name = type.name();
+        const size_t space = name.rfind(' ');
+        if (space != std::string::npos) name = name.substr(space + 1);
+        const size_t scope = name.rfind("::");
+        if (scope != std::string::npos) name = name.substr(scope + 2);
+        info->name = name;
+        info->size = size;
+        info->cppType = &type;
+        info->clone = clone;
+        info->create = create;
+        info->fields = fields;
+        info->fieldCount = fieldCount;
+
+        info->overrides[static_cast<size_t>(ComponentPhase::Update)] = update;
+        info->overrides[static_cast<size_t>(ComponentPhase::LateUpdate)] = lateUpdate;
+        info->overrides[static_cast<size_t>(ComponentPhase::FixedUpdate)] = fixedUpdate;
+
+        registry.types.push_back(std::move(info));
+        return registry.types.back().get();
+    }
+
+    const ComponentTypeInfo* ComponentRegistry::Find(std::string_view name)
+    {
+        RegistryState& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto& type : registry.types)
+        {
+            if (type->name == name)
+                return type.get();
+        }
+        return nullptr;
+    }
+
+    uint32_t ComponentRegistry::GetTypeCount()
+    {
+        RegistryState& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return static_cast<uint32_t>(registry.types.size());
+    }
+
+    const ComponentTypeInfo* ComponentRegistry::GetType(uint32_t id)
+    {
+        RegistryState& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return id < registry.types.size() ? registry.types[id].get() : nullptr;
+    }
+}
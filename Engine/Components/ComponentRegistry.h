@@ -0,0 +1,97 @@
+#pragma once
+#include "Component.h"
+#include "Reflection.h"
+#include <type_traits>
+#include <typeinfo>
+#include <string_view>
+
+namespace AronEngine
+{
+    struct ComponentTypeInfo
+    {
+        uint32_t id;                // dense, in registration order
+        std::string name;
+        size_t size;                // sizeof the most derived type
+        const std::type_info* cppType;
+        // Copy-constructs a detached component with the same settings; null for non-copyable types
+        Component* (*clone)(const Component& source);
+        // Default-constructs a detached component, for scene loading; null for abstract types
+        Component* (*create)();
+        bool overrides[kComponentPhaseCount];
+        // From the type's AE_REFLECT list, base class fields first; null for unreflected types
+        const ReflectedField* fields;
+        uint32_t fieldCount;
+
+        bool Overrides(ComponentPhase phase) const { return overrides[static_cast<size_t>(phase)]; }
+        bool NeedsAnyPhase() const
+        {
+            for (bool value : overrides) if (value) return true;
+            return false;
+        }
+    };
+
+    // &T::OnUpdate names Component::OnUpdate unless T or one of its bases overrides it. An
+    // override we can't take the address of (private) counts as overriding.
+#define AE_DEFINE_HOOK_TRAIT(Trait, Hook)                                                          \
+    template<typename T, typename = void>                                                          \
+    struct Trait : std::true_type {};                                                              \
+    template<typename T>                                                                           \
+    struct Trait<T, std::void_t<decltype(&T::Hook)>>                                               \
+        : std::bool_constant<!std::is_same<decltype(&T::Hook), void (Component::*)(float)>::value> {};
+
+    AE_DEFINE_HOOK_TRAIT(OverridesOnUpdate, OnUpdate)
+    AE_DEFINE_HOOK_TRAIT(OverridesOnLateUpdate, OnLateUpdate)
+    AE_DEFINE_HOOK_TRAIT(OverridesOnFixedUpdate, OnFixedUpdate)
+
+#undef AE_DEFINE_HOOK_TRAIT
+
+    template<typename T, bool Constructible = std::is_default_constructible<T>::value>
+    struct ComponentCreator
+    {
+        static constexpr Component* (*function)() = nullptr;
+    };
+
+    template<typename T>
+    struct ComponentCreator<T, true>
+    {
+        static Component* Create() { return new T(); }
+        static constexpr Component* (*function)() = &Create;
+    };
+
+    template<typename T, bool Copyable = std::is_copy_constructible<T>::value>
+    struct ComponentCloner
+    {
+        static constexpr Component* (*function)(const Component&) = nullptr;
+    };
+
+    template<typename T>
+    struct ComponentCloner<T, true>
+    {
+        static Component* Clone(const Component& source) { return new T(static_cast<const T&>(source)); }
+        static constexpr Component* (*function)(const Component&) = &Clone;
+    };
+
+    class ComponentRegistry
+    {
+    public:
+        // Registered the first time a T is added to a GameObject
+        template<typename T>
+        static const ComponentTypeInfo* Get()
+        {
+            static const ComponentTypeInfo* info = Register(typeid(T), sizeof(T), ComponentCloner<T>::function, ComponentCreator<T>::function,
+                OverridesOnUpdate<T>::value, OverridesOnLateUpdate<T>::value, OverridesOnFixedUpdate<T>::value,
+                FieldTable<T>::Get(), FieldTable<T>::count);
+            return info;
+        }
+
+        // By short name ("Rigidbody"); only types that have been registered through Get
+        static const ComponentTypeInfo* Find(std::string_view name);
+        static uint32_t GetTypeCount();
+        static const ComponentTypeInfo* GetType(uint32_t id);
+
+    private:
+        static const ComponentTypeInfo* Register(const std::type_info& type, size_t size,
+            Component* (*clone)(const Component&), Component* (*create)(), bool update, bool lateUpdate, bool fixedUpdate,
+            const ReflectedField* fields, uint32_t fieldCount);
+    };
+}
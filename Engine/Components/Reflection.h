@@ -0,0 +1,378 @@
+#pragma once
+#include "Component.h"
+#include "../Utils/Vector2.h"
+#include "../Utils/Color.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace AronEngine
+{
+    // Compile-time field lists for components. A component names its saved fields once:
+    //
+    //     public:
+    //         AE_REFLECT(Rigidbody,
+    //             AE_FIELD(mass).Min(0.1f).Set(&Rigidbody::SetMass),
+    //             AE_FIELD_AS(isKinematic, "kinematic").Set(&Rigidbody::SetKinematic))
+    //
+    // and the Reflection:: templates below expand it into JSON/binary serialization, diffing
+    // and the editor's runtime field table. A subclass lists only its own fields with
+    // AE_REFLECT_DERIVED; the base class's come first wherever all fields are walked.
+    // Types without a list never touch any of this.
+
+    enum class FieldKind : uint8_t
+    {
+        Bool,
+        Int,
+        Float,
+        Vector2,
+        Color,
+        String,
+        Enum,       // exchanged as int, range-checked against the declared count
+    };
+
+    template<typename Value, typename = void>
+    struct FieldKindOf;
+
+    template<> struct FieldKindOf<bool> { static constexpr FieldKind value = FieldKind::Bool; };
+    template<> struct FieldKindOf<int> { static constexpr FieldKind value = FieldKind::Int; };
+    template<> struct FieldKindOf<float> { static constexpr FieldKind value = FieldKind::Float; };
+    template<> struct FieldKindOf<Vector2> { static constexpr FieldKind value = FieldKind::Vector2; };
+    template<> struct FieldKindOf<Color> { static constexpr FieldKind value = FieldKind::Color; };
+    template<> struct FieldKindOf<std::string> { static constexpr FieldKind value = FieldKind::String; };
+    template<typename Value>
+    struct FieldKindOf<Value, std::enable_if_t<std::is_enum<Value>::value>> { static constexpr FieldKind value = FieldKind::Enum; };
+
+    // One reflected member of Owner (the class that declares it). Loading writes the member
+    // and applies the limits; edits to a live component (inspector, replication) go through
+    // the setter when there is one, so dirty flags and mixer updates still happen.
+    template<typename Owner, typename Value>
+    struct FieldDescriptor
+    {
+        using OwnerType = Owner;
+        using ValueType = Value;
+        static constexpr FieldKind kind = FieldKindOf<Value>::value;
+
+        const char* name;
+        Value Owner::* member;
+        void (Owner::* setByReference)(const Value&);
+        void (Owner::* setByValue)(Value);
+        float min;
+        float max;
+        bool hasMin;
+        bool hasMax;
+        int enumCount;
+        const char* const* enumNames;   // enumCount entries, or null
+
+        constexpr FieldDescriptor(const char* name, Value Owner::* member)
+            : name(name)
+            , member(member)
+            , setByReference(nullptr)
+            , setByValue(nullptr)
+            , min(0.0f)
+            , max(0.0f)
+            , hasMin(false)
+            , hasMax(false)
+            , enumCount(0)
+            , enumNames(nullptr)
+        {
+        }
+
+        constexpr FieldDescriptor Min(float value) const { FieldDescriptor copy = *this; copy.min = value; copy.hasMin = true; return copy; }
+        constexpr FieldDescriptor Max(float value) const { FieldDescriptor copy = *this; copy.max = value; copy.hasMax = true; return copy; }
+        constexpr FieldDescriptor Range(float low, float high) const { return Min(low).Max(high); }
+        // Values outside [0, count) load as the first enumerator
+        constexpr FieldDescriptor Enum(int count, const char* const* names = nullptr) const
+        {
+            FieldDescriptor copy = *this;
+            copy.enumCount = count;
+            copy.enumNames = names;
+            return copy;
+        }
+        constexpr FieldDescriptor Set(void (Owner::* setter)(const Value&)) const { FieldDescriptor copy = *this; copy.setByReference = setter; return copy; }
+        constexpr FieldDescriptor Set(void (Owner::* setter)(Value)) const { FieldDescriptor copy = *this; copy.setByValue = setter; return copy; }
+
+        void Constrain(Value& value) const
+        {
+            if constexpr (std::is_enum<Value>::value)
+            {
+                const int raw = static_cast<int>(value);
+                if (raw < 0 || raw >= enumCount) value = Value();
+            }
+            else if constexpr (std::is_arithmetic<Value>::value && !std::is_same<Value, bool>::value)
+            {
+                if (hasMax) value = (std::min)(static_cast<Value>(max), value);
+                if (hasMin) value = (std::max)(static_cast<Value>(min), value);
+            }
+        }
+
+        // Setter when declared, otherwise a constrained store
+        template<typename Object>
+        void Assign(Object& object, const Value& value) const
+        {
+            if (setByReference) (object.*setByReference)(value);
+            else if (setByValue) (object.*setByValue)(value);
+            else
+            {
+                Value& target = object.*member;
+                target = value;
+                Constrain(target);
+            }
+        }
+    };
+
+    template<typename Owner, typename Value>
+    constexpr FieldDescriptor<Owner, Value> MakeField(const char* name, Value Owner::* member)
+    {
+        return FieldDescriptor<Owner, Value>(name, member);
+    }
+
+#define AE_FIELD(member) ::AronEngine::MakeField(#member, &ReflectedType::member)
+#define AE_FIELD_AS(member, key) ::AronEngine::MakeField(key, &ReflectedType::member)
+
+    // Goes in a public section of the class body
+#define AE_REFLECT(Type, ...)                                                                      \
+    using ReflectedType = Type;                                                                    \
+    using ReflectedBase = void;                                                                    \
+    static constexpr auto ReflectFields() { return std::make_tuple(__VA_ARGS__); }
+
+#define AE_REFLECT_DERIVED(Type, Base, ...)                                                        \
+    using ReflectedType = Type;                                                                    \
+    using ReflectedBase = Base;                                                                    \
+    static constexpr auto ReflectFields() { return std::make_tuple(__VA_ARGS__); }
+
+    template<typename T, typename = void>
+    struct IsReflected : std::false_type {};
+
+    template<typename T>
+    struct IsReflected<T, std::void_t<typename T::ReflectedType>> : std::true_type {};
+
+    // Type-erased view of a field for code that only has a Component* (the editor). Values
+    // cross as the kind's C++ type: bool, int (ints and enums), float, Vector2, Color, std::string.
+    struct ReflectedField
+    {
+        const char* name;
+        FieldKind kind;
+        float min;
+        float max;
+        bool hasMin;
+        bool hasMax;
+        int enumCount;
+        const char* const* enumNames;
+        void (*get)(const Component& component, void* value);
+        void (*set)(Component& component, const void* value);
+    };
+
+    namespace Reflection
+    {
+        // Every field of T, base classes' first
+        template<typename T>
+        constexpr auto AllFields()
+        {
+            using Declared = typename T::ReflectedType;
+            using Base = typename Declared::ReflectedBase;
+            if constexpr (std::is_void<Base>::value) return Declared::ReflectFields();
+            else return std::tuple_cat(AllFields<Base>(), Declared::ReflectFields());
+        }
+
+        template<typename T>
+        constexpr size_t FieldCount() { return std::tuple_size<decltype(AllFields<T>())>::value; }
+
+        template<typename Tuple, typename Visitor, size_t... I>
+        void VisitTuple(const Tuple& fields, Visitor&& visitor, std::index_sequence<I...>)
+        {
+            (visitor(std::get<I>(fields), I), ...);
+        }
+
+        // visitor(field, index) for the fields T itself declares
+        template<typename T, typename Visitor>
+        void ForEachOwnField(Visitor&& visitor)
+        {
+            constexpr auto fields = T::ReflectedType::ReflectFields();
+            VisitTuple(fields, visitor, std::make_index_sequence<std::tuple_size<decltype(fields)>::value>());
+        }
+
+        // visitor(field, index) for every field of T
+        template<typename T, typename Visitor>
+        void ForEachField(Visitor&& visitor)
+        {
+            constexpr auto fields = AllFields<T>();
+            VisitTuple(fields, visitor, std::make_index_sequence<std::tuple_size<decltype(fields)>::value>());
+        }
+
+        template<typename Value>
+        bool ValuesEqual(const Value& a, const Value& b) { return a == b; }
+
+        inline bool ValuesEqual(const Color& a, const Color& b)
+        {
+            return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+        }
+
+        // Scene files write each class's own fields from its Serialize/WriteBinary override,
+        // after the base class's, so the layout matches a hand-written chain of calls.
+        template<typename T, typename Writer>
+        void WriteJson(const T& object, Writer& writer)
+        {
+            ForEachOwnField<T>([&](const auto& field, size_t)
+            {
+                using Field = std::decay_t<decltype(field)>;
+                const auto& value = object.*field.member;
+                if constexpr (Field::kind == FieldKind::Enum) writer.Write(field.name, static_cast<int>(value));
+                else writer.Write(field.name, value);
+            });
+        }
+
+        // Reads key if T declares it; found tells the caller whether to fall back to the base
+        template<typename T, typename Reader>
+        bool ReadJson(T& object, std::string_view key, Reader& reader, bool& found)
+        {
+            bool result = false;
+            found = false;
+            ForEachOwnField<T>([&](const auto& field, size_t)
+            {
+                if (found || key != field.name) return;
+                found = true;
+
+                using Field = std::decay_t<decltype(field)>;
+                using Value = typename Field::ValueType;
+                auto& target = object.*field.member;
+                if constexpr (Field::kind == FieldKind::Enum)
+                {
+                    int raw = 0;
+                    result = reader.Read(raw);
+                    if (result) target = static_cast<Value>(raw);
+                }
+                else
+                {
+                    result = reader.Read(target);
+                }
+                if (result) field.Constrain(target);
+            });
+            return result;
+        }
+
+        template<typename T, typename Writer>
+        void WriteBinary(const T& object, Writer& writer)
+        {
+            ForEachOwnField<T>([&](const auto& field, size_t)
+            {
+                using Field = std::decay_t<decltype(field)>;
+                const auto& value = object.*field.member;
+                if constexpr (Field::kind == FieldKind::Enum) writer.Write(static_cast<int>(value));
+                else if constexpr (Field::kind == FieldKind::String) writer.WriteString(value);
+                else writer.Write(value);
+            });
+        }
+
+        template<typename T, typename Reader>
+        bool ReadBinary(T& object, Reader& reader)
+        {
+            bool ok = true;
+            ForEachOwnField<T>([&](const auto& field, size_t)
+            {
+                if (!ok) return;
+
+                using Field = std::decay_t<decltype(field)>;
+                using Value = typename Field::ValueType;
+                auto& target = object.*field.member;
+                if constexpr (Field::kind == FieldKind::Enum)
+                {
+                    int raw = 0;
+                    ok = reader.Read(raw);
+                    if (ok) target = static_cast<Value>(raw);
+                }
+                else if constexpr (Field::kind == FieldKind::String)
+                {
+                    ok = reader.ReadString(target);
+                }
+                else
+                {
+                    ok = reader.Read(target);
+                }
+                if (ok) field.Constrain(target);
+            });
+            return ok;
+        }
+
+        // Bit i set when field i (in AllFields order) differs; feed to CopyFields to replicate
+        template<typename T>
+        uint64_t ChangedFields(const T& current, const T& baseline)
+        {
+            static_assert(FieldCount<T>() <= 64, "ChangedFields tracks at most 64 fields");
+
+            uint64_t mask = 0;
+            ForEachField<T>([&](const auto& field, size_t index)
+            {
+                if (!ValuesEqual(current.*field.member, baseline.*field.member)) mask |= uint64_t(1) << index;
+            });
+            return mask;
+        }
+
+        // Applies the masked fields of source to a live target through its setters
+        template<typename T>
+        void CopyFields(T& target, const T& source, uint64_t mask)
+        {
+            ForEachField<T>([&](const auto& field, size_t index)
+            {
+                if (mask & (uint64_t(1) << index)) field.Assign(target, source.*field.member);
+            });
+        }
+
+        template<typename T, size_t I>
+        ReflectedField MakeRuntimeField()
+        {
+            constexpr auto field = std::get<I>(AllFields<T>());
+            using Value = typename std::decay_t<decltype(field)>::ValueType;
+            using Exchange = std::conditional_t<std::is_enum<Value>::value, int, Value>;
+
+            ReflectedField info;
+            info.name = field.name;
+            info.kind = field.kind;
+            info.min = field.min;
+            info.max = field.max;
+            info.hasMin = field.hasMin;
+            info.hasMax = field.hasMax;
+            info.enumCount = field.enumCount;
+            info.enumNames = field.enumNames;
+            info.get = [](const Component& component, void* value)
+            {
+                constexpr auto field = std::get<I>(AllFields<T>());
+                *static_cast<Exchange*>(value) = static_cast<Exchange>(static_cast<const T&>(component).*field.member);
+            };
+            info.set = [](Component& component, const void* value)
+            {
+                constexpr auto field = std::get<I>(AllFields<T>());
+                Value converted = static_cast<Value>(*static_cast<const Exchange*>(value));
+                field.Constrain(converted);
+                field.Assign(static_cast<T&>(component), converted);
+            };
+            return info;
+        }
+
+        template<typename T, size_t... I>
+        const ReflectedField* BuildFieldTable(std::index_sequence<I...>)
+        {
+            static const ReflectedField table[] = { MakeRuntimeField<T, I>()... };
+            return table;
+        }
+    }
+
+    // What ComponentRegistry stores per type; empty for types without a field list
+    template<typename T, bool Reflected = IsReflected<T>::value>
+    struct FieldTable
+    {
+        static const ReflectedField* Get() { return nullptr; }
+        static constexpr uint32_t count = 0;
+    };
+
+    template<typename T>
+    struct FieldTable<T, true>
+    {
+        static const ReflectedField* Get() { return Reflection::BuildFieldTable<T>(std::make_index_sequence<Reflection::FieldCount<T>()>()); }
+        static constexpr uint32_t count = static_cast<uint32_t>(Reflection::FieldCount<T>());
+    };
+}
@@ -2,6 +2,10 @@
 #include "Rigidbody.h"
 #include "Transform.h"
 #include "../Core/GameObject.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -25,15 +29,13 @@ namespace AronEngine
     {
     }
 
-    void Rigidbody::Start()
+    void Rigidbody::OnStart()
     {
-        Component::Start();
+        Component::OnStart();
     }
 
-    void Rigidbody::Update(float deltaTime)
+    void Rigidbody::OnUpdate(float deltaTime)
     {
-        Component::Update(deltaTime);
-        
         if (bodyType == RigidbodyType::Static)
             return;
             
@@ -52,6 +54,39 @@ namespace AronEngine
         Component::OnDestroy();
     }
 
+    void Rigidbody::OnReset()
+    {
+        // Body settings come from the template; only the motion state is per use
+        velocity = Vector2::Zero;
+        acceleration = Vector2::Zero;
+        force = Vector2::Zero;
+        angularVelocity = 0.0f;
+    }
+
+    void Rigidbody::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool Rigidbody::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void Rigidbody::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool Rigidbody::ReadBinary(BinaryReader& reader)
+    {
+        return Component::ReadBinary(reader) && Reflection::ReadBinary(*this, reader);
+    }
+
     void Rigidbody::AddForce(const Vector2& forceVector)
     {
         if (bodyType == RigidbodyType::Dynamic && !isKinematic)
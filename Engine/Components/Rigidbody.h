@@ -1,6 +1,8 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
 #include "../Utils/Vector2.h"
+#include "../Core/SystemAccess.h"
 
 namespace AronEngine
 {
@@ -11,6 +13,8 @@ namespace AronEngine
         Static      // Never moves
     };
 
+    inline constexpr const char* kRigidbodyTypeNames[] = { "Dynamic", "Kinematic", "Static" };
+
     class Rigidbody : public Component
     {
     private:
@@ -40,14 +44,35 @@ namespace AronEngine
         Rigidbody();
         virtual ~Rigidbody() = default;
 
-        virtual void Start() override;
-        virtual void Update(float deltaTime) override;
+        virtual void OnStart() override;
+        virtual void OnUpdate(float deltaTime) override;
         virtual void OnDestroy() override;
+        virtual void OnReset() override;
+
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        AE_REFLECT(Rigidbody,
+            AE_FIELD(bodyType).Enum(3, kRigidbodyTypeNames).Set(&Rigidbody::SetBodyType),
+            AE_FIELD(mass).Min(0.1f).Set(&Rigidbody::SetMass),
+            AE_FIELD(drag).Set(&Rigidbody::SetDrag),
+            AE_FIELD(angularDrag).Set(&Rigidbody::SetAngularDrag),
+            AE_FIELD(useGravity).Set(&Rigidbody::SetUseGravity),
+            AE_FIELD(gravityScale).Set(&Rigidbody::SetGravityScale),
+            AE_FIELD_AS(isKinematic, "kinematic").Set(&Rigidbody::SetKinematic),
+            AE_FIELD(freezeRotation).Set(&Rigidbody::SetFreezeRotation),
+            AE_FIELD(constrainX).Set(&Rigidbody::SetConstrainX),
+            AE_FIELD(constrainY).Set(&Rigidbody::SetConstrainY),
+            AE_FIELD(constrainRotation),
+            AE_FIELD(velocity).Set(&Rigidbody::SetVelocity),
+            AE_FIELD(angularVelocity).Set(&Rigidbody::SetAngularVelocity))
 
         // Velocity
-        void SetVelocity(const Vector2& vel) { velocity = vel; }
+        void SetVelocity(const Vector2& vel) { SYSTEM_ACCESS_WRITE(Rigidbody); velocity = vel; }
         const Vector2& GetVelocity() const { return velocity; }
-        void AddVelocity(const Vector2& vel) { velocity += vel; }
+        void AddVelocity(const Vector2& vel) { SYSTEM_ACCESS_WRITE(Rigidbody); velocity += vel; }
         
         // Forces
         void AddForce(const Vector2& forceVector);
@@ -2,7 +2,14 @@
 #include "SpriteRenderer.h"
 #include "../Core/GameObject.h"
 #include "../Core/TextureManager.h"
+#include "../Core/AssetRequestQueue.h"
 #include "Transform.h"
+#include "../Core/EngineApp.h"
+#include "../Systems/RenderSystem.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -16,9 +23,23 @@ namespace AronEngine
         , flipY(false)
         , size(100, 100)
         , offset(0, 0)
+        , registeredSystem(nullptr)
+        , systemSlot(-1)
+        , spatialHandle(-1)
+        , staleSlot(-1)
+        , drawSequence(0)
+        , countedDrawable(false)
     {
     }
 
+    SpriteRenderer::~SpriteRenderer()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterSpriteRenderer(this);
+        }
+    }
+
     void SpriteRenderer::SetSprite(std::shared_ptr<Sprite> newSprite)
     {
         sprite = newSprite;
@@ -26,6 +47,7 @@ namespace AronEngine
         {
             size = sprite->size;
         }
+        MarkBoundsDirty();
     }
 
     bool SpriteRenderer::LoadSpriteFromFile(const std::string& filepath)
@@ -39,6 +61,7 @@ namespace AronEngine
         sprite = std::make_shared<Sprite>(texture, filepath);
         if (sprite) {
             size = sprite->size;
+            MarkBoundsDirty();
             DEBUG_LOG("Sprite loaded successfully from: " + filepath);
             return true;
         }
@@ -46,18 +69,106 @@ namespace AronEngine
         return false;
     }
 
-    void SpriteRenderer::Start()
+    void SpriteRenderer::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        // Before size: loading the texture resets size to the texture's
+        if (sprite && !sprite->texturePath.empty())
+        {
+            writer.Write("texture", sprite->texturePath);
+        }
+        Reflection::WriteJson(*this, writer);
+    }
+
+    bool SpriteRenderer::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        if (key == "texture")
+        {
+            std::string path;
+            if (!reader.Read(path)) return false;
+            if (!path.empty()) LoadSavedTexture(path);
+            return true;
+        }
+
+        bool found = false;
+        const bool result = Reflection::ReadJson(*this, key, reader, found);
+        return found ? result : Component::DeserializeProperty(key, reader);
+    }
+
+    void SpriteRenderer::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        writer.WriteString(sprite ? sprite->texturePath : std::string());
+        Reflection::WriteBinary(*this, writer);
+    }
+
+    bool SpriteRenderer::ReadBinary(BinaryReader& reader)
+    {
+        if (!Component::ReadBinary(reader)) return false;
+
+        std::string_view texture;
+        if (!reader.ReadString(texture)) return false;
+        // Before size: loading the texture resets size to the texture's
+        if (!texture.empty()) LoadSavedTexture(std::string(texture));
+
+        return Reflection::ReadBinary(*this, reader);
+    }
+
+    void SpriteRenderer::LoadSavedTexture(const std::string& path)
+    {
+        // Built off the main thread: the texture loads later, after size has been read, so
+        // keep the saved size rather than the texture's
+        if (AssetRequestQueue* queue = AssetRequestQueue::GetCurrent())
+        {
+            queue->Push([this, path]()
+            {
+                const Vector2 savedSize = size;
+                LoadSpriteFromFile(path);
+                size = savedSize;
+            });
+            return;
+        }
+
+        LoadSpriteFromFile(path);
+    }
+
+    void SpriteRenderer::MarkBoundsDirty()
     {
-        Component::Start();
+        if (registeredSystem && staleSlot < 0)
+        {
+            registeredSystem->QueueBoundsUpdate(this);
+        }
     }
 
-    void SpriteRenderer::Update(float deltaTime)
+    void SpriteRenderer::OnEnable()
     {
-        Component::Update(deltaTime);
+        if (!registeredSystem)
+        {
+            if (auto* renderSystem = EngineApp::GetInstance().GetRenderSystem())
+            {
+                renderSystem->RegisterSpriteRenderer(this);
+            }
+        }
+    }
+
+    void SpriteRenderer::OnDisable()
+    {
+        if (registeredSystem)
+        {
+            registeredSystem->UnregisterSpriteRenderer(this);
+        }
+    }
+
+    void SpriteRenderer::OnActiveChanged()
+    {
+        Component::OnActiveChanged();
+        // Inactive sprites don't draw; the render system recounts it with the next bounds update
+        MarkBoundsDirty();
     }
 
     void SpriteRenderer::OnDestroy()
     {
+        OnDisable();
         sprite = nullptr;
         Component::OnDestroy();
     }
@@ -116,4 +227,46 @@ namespace AronEngine
         
         return scaleMatrix * rotationMatrix * translationMatrix;
     }
-}
\ No newline at end of file
+
+    D2D1_RECT_F SpriteRenderer::GetLocalRect() const
+    {
+        const Vector2 pivot = sprite ? sprite->pivot : Vector2(0.5f, 0.5f);
+        const float left = -size.x * pivot.x;
+        const float top = -size.y * pivot.y;
+        return D2D1::RectF(left, top, left + size.x, top + size.y);
+    }
+
+    Matrix3x2 SpriteRenderer::GetWorldMatrix() const
+    {
+        Transform* transform = gameObject ? gameObject->GetTransform() : nullptr;
+        if (!transform)
+            return Matrix3x2::Identity();
+
+        const Vector2 position = transform->GetWorldPosition();
+        const Vector2 scale = transform->GetScale();
+        const float rotation = transform->GetRotation();
+
+        Matrix3x2 matrix = Matrix3x2::Scale(flipX ? -scale.x : scale.x, flipY ? -scale.y : scale.y);
+        if (rotation != 0.0f)
+        {
+            matrix = matrix * Matrix3x2::Rotation(rotation);
+        }
+        return matrix * Matrix3x2::Translation(position.x + offset.x, position.y + offset.y);
+    }
+
+    D2D1_RECT_F SpriteRenderer::GetWorldBounds() const
+    {
+        const D2D1_RECT_F local = GetLocalRect();
+        const Matrix3x2 world = GetWorldMatrix();
+
+        // Extent of the transformed rectangle along each axis, without building four corners
+        const float centerX = (local.left + local.right) * 0.5f;
+        const float centerY = (local.top + local.bottom) * 0.5f;
+        const float halfX = (local.right - local.left) * 0.5f;
+        const float halfY = (local.bottom - local.top) * 0.5f;
+        const Vector2 center = world.TransformPoint(Vector2(centerX, centerY));
+        const float extentX = std::abs(world.m11) * halfX + std::abs(world.m21) * halfY;
+        const float extentY = std::abs(world.m12) * halfX + std::abs(world.m22) * halfY;
+        return D2D1::RectF(center.x - extentX, center.y - extentY, center.x + extentX, center.y + extentY);
+    }
+}
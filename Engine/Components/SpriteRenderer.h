@@ -1,7 +1,9 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
 #include "../Utils/Color.h"
 #include "../Utils/Vector2.h"
+#include "../Utils/Matrix3x2.h"
 #include "../Core/TextureManager.h"
 #include <memory>
 #include <string>
@@ -37,6 +39,8 @@ namespace AronEngine
         }
     };
 
+    class RenderSystem;
+
     class SpriteRenderer : public Component
     {
     private:
@@ -48,14 +52,20 @@ namespace AronEngine
         bool flipY;
         Vector2 size;
         Vector2 offset;
+        InstancePtr<RenderSystem> registeredSystem;
+        int32_t systemSlot;                 // index in the render system's list, -1 when unregistered
+        int32_t spatialHandle;              // in the render system's spatial index, -1 when absent
+        int32_t staleSlot;                  // in the render system's re-fit queue, -1 when not queued
+        uint32_t drawSequence;              // registration order, breaks sorting-order ties
+        bool countedDrawable;               // included in the render system's drawable count
 
     public:
         SpriteRenderer();
-        virtual ~SpriteRenderer() = default;
+        virtual ~SpriteRenderer();
 
         // 스프라이트 설정
         void SetSprite(std::shared_ptr<Sprite> newSprite);
-        std::shared_ptr<Sprite> GetSprite() const { return sprite; }
+        const std::shared_ptr<Sprite>& GetSprite() const { return sprite; }
         
         // 텍스처 파일에서 스프라이트 로드
         bool LoadSpriteFromFile(const std::string& filepath);
@@ -78,17 +88,50 @@ namespace AronEngine
         void SetFlipY(bool flip) { flipY = flip; }
         bool GetFlipY() const { return flipY; }
         
-        void SetSize(const Vector2& newSize) { size = newSize; }
+        void SetSize(const Vector2& newSize) { size = newSize; MarkBoundsDirty(); }
         const Vector2& GetSize() const { return size; }
         
-        void SetOffset(const Vector2& newOffset) { offset = newOffset; }
+        void SetOffset(const Vector2& newOffset) { offset = newOffset; MarkBoundsDirty(); }
         const Vector2& GetOffset() const { return offset; }
 
-        virtual void Start() override;
-        virtual void Update(float deltaTime) override;
+        virtual void OnEnable() override;
+        virtual void OnDisable() override;
         virtual void OnDestroy() override;
+
+        virtual void Serialize(JsonWriter& writer) const override;
+        virtual bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        virtual void WriteBinary(BinaryWriter& writer) const override;
+        virtual bool ReadBinary(BinaryReader& reader) override;
+
+        // The texture is an asset reference, saved by hand ahead of these
+        AE_REFLECT(SpriteRenderer,
+            AE_FIELD(color).Set(&SpriteRenderer::SetColor),
+            AE_FIELD(size).Set(&SpriteRenderer::SetSize),
+            AE_FIELD(offset).Set(&SpriteRenderer::SetOffset),
+            AE_FIELD(sortingOrder).Set(&SpriteRenderer::SetSortingOrder),
+            AE_FIELD_AS(sortingLayerName, "sortingLayer").Set(&SpriteRenderer::SetSortingLayer),
+            AE_FIELD(flipX).Set(&SpriteRenderer::SetFlipX),
+            AE_FIELD(flipY).Set(&SpriteRenderer::SetFlipY))
         
         D2D1_RECT_F GetRenderRect() const;
         D2D1_MATRIX_3X2_F GetTransformMatrix() const;
+
+        // The sprite's rectangle around its object, before the world matrix; what gets drawn
+        D2D1_RECT_F GetLocalRect() const;
+        // Scale (with flips), rotation, then the object's position plus offset
+        Matrix3x2 GetWorldMatrix() const;
+        // Axis-aligned box around the drawn sprite in world space, for culling
+        D2D1_RECT_F GetWorldBounds() const;
+
+    protected:
+        void OnActiveChanged() override;
+
+    private:
+        friend class RenderSystem;
+        void SetRegisteredSystem(RenderSystem* system) { registeredSystem = system; }
+        // Size, offset or pivot changed: the render system re-fits the world bounds
+        void MarkBoundsDirty();
+        // Scene file texture; queued when the scene is being built in the background
+        void LoadSavedTexture(const std::string& path);
     };
 }
\ No newline at end of file
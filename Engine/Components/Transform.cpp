@@ -1,6 +1,9 @@
 #include "framework.h"
 #include "Transform.h"
 #include "../Core/GameObject.h"
+#include "../Core/SystemAccess.h"
+#include "../Core/ObjectPools.h"
+#include "../Systems/RenderSystem.h"
 
 namespace AronEngine
 {
@@ -11,10 +14,23 @@ namespace AronEngine
         , localScale(Vector2::One)
         , parent(nullptr)
         , matrixDirty(true)
+        , spatialIndex(nullptr)
+        , indexedSprites(0)
+        , movedSlot(-1)
     {
         SetName("Transform");
     }
 
+    void* Transform::operator new(size_t size)
+    {
+        return ObjectPools::AllocateTransform(size);
+    }
+
+    void Transform::operator delete(void* block, size_t size)
+    {
+        ObjectPools::FreeTransform(block, size);
+    }
+
     void Transform::SetLocalPosition(const Vector2& position)
     {
         if (localPosition != position)
@@ -44,6 +60,7 @@ namespace AronEngine
 
     Vector2 Transform::GetPosition() const
     {
+        SYSTEM_ACCESS_READ(Transform);
         if (parent)
         {
             return parent->GetLocalToWorldMatrix().TransformPoint(localPosition);
@@ -66,6 +83,7 @@ namespace AronEngine
 
     float Transform::GetRotation() const
     {
+        SYSTEM_ACCESS_READ(Transform);
         if (parent)
         {
             return parent->GetRotation() + localRotation;
@@ -87,6 +105,7 @@ namespace AronEngine
 
     Vector2 Transform::GetLossyScale() const
     {
+        SYSTEM_ACCESS_READ(Transform);
         if (parent)
         {
             Vector2 parentScale = parent->GetLossyScale();
@@ -138,6 +157,7 @@ namespace AronEngine
 
     const Matrix3x2& Transform::GetLocalToWorldMatrix() const
     {
+        SYSTEM_ACCESS_READ(Transform);
         if (matrixDirty)
         {
             UpdateMatrices();
@@ -147,6 +167,7 @@ namespace AronEngine
 
     const Matrix3x2& Transform::GetWorldToLocalMatrix() const
     {
+        SYSTEM_ACCESS_READ(Transform);
         if (matrixDirty)
         {
             UpdateMatrices();
@@ -215,7 +236,12 @@ namespace AronEngine
 
     void Transform::MarkMatrixDirty()
     {
+        SYSTEM_ACCESS_WRITE(Transform);
         matrixDirty = true;
+        if (spatialIndex && movedSlot < 0)
+        {
+            spatialIndex->OnTransformMoved(this);
+        }
         
         for (auto* child : children)
         {
@@ -223,6 +249,14 @@ namespace AronEngine
         }
     }
 
+    void Transform::MarkSpritesStale()
+    {
+        if (spatialIndex && movedSlot < 0)
+        {
+            spatialIndex->OnTransformMoved(this);
+        }
+    }
+
     void Transform::UpdateMatrices() const
     {
         Matrix3x2 local = Matrix3x2::TRS(localPosition, localRotation, localScale);
@@ -1,10 +1,13 @@
 #pragma once
 #include "Component.h"
+#include "Reflection.h"
 #include "../Utils/Vector2.h"
 #include "../Utils/Matrix3x2.h"
 
 namespace AronEngine
 {
+    class RenderSystem;
+
     class Transform : public Component
     {
         DECLARE_OBJECT_TYPE(Transform)
@@ -21,10 +24,26 @@ namespace AronEngine
         mutable Matrix3x2 worldToLocalMatrix;
         mutable bool matrixDirty;
 
+        // Set while sprites on this object are in the render system's spatial index; a move
+        // queues the transform there once, so only moved sprites get their bounds re-fitted
+        InstancePtr<RenderSystem> spatialIndex;
+        uint16_t indexedSprites;
+        int32_t movedSlot;                  // in the render system's moved list, -1 if not queued
+
     public:
         Transform();
         virtual ~Transform() = default;
 
+        static void* operator new(size_t size);
+        static void operator delete(void* block, size_t size);
+
+        // Scene files store the transform in the object record, so this list feeds the
+        // inspector and diffing only
+        AE_REFLECT(Transform,
+            AE_FIELD_AS(localPosition, "position").Set(&Transform::SetLocalPosition),
+            AE_FIELD_AS(localRotation, "rotation").Set(&Transform::SetLocalRotation),
+            AE_FIELD_AS(localScale, "scale").Set(&Transform::SetLocalScale))
+
         // Local space properties
         const Vector2& GetLocalPosition() const { return localPosition; }
         void SetLocalPosition(const Vector2& position);
@@ -79,7 +98,12 @@ namespace AronEngine
         void LookAt(const Vector2& target);
 
     private:
+        friend class RenderSystem;
+        friend class GameObject;
         void MarkMatrixDirty();
+        // Requeues this object's sprites in the render system without dirtying the matrices,
+        // e.g. when the object is activated or deactivated
+        void MarkSpritesStale();
         void UpdateMatrices() const;
         void AddChild(Transform* child);
         void RemoveChild(Transform* child);
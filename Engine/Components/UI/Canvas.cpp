@@ -3,6 +3,10 @@
 #include "UIElement.h"
 #include "../../Core/Renderer.h"
 #include "../../Core/EngineApp.h"
+#include "../../Utils/JsonWriter.h"
+#include "../../Utils/JsonReader.h"
+#include "../../Utils/BinaryWriter.h"
+#include "../../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -20,6 +24,44 @@ namespace AronEngine
         uiElements.clear();
     }
 
+    void Canvas::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        writer.Write("renderMode", static_cast<int>(renderMode));
+        writer.Write("sortingOrder", sortingOrder);
+        writer.Write("referenceResolution", referenceResolution);
+    }
+
+    bool Canvas::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        if (key == "renderMode")
+        {
+            int mode = 0;
+            if (!reader.Read(mode)) return false;
+            renderMode = (mode >= 0 && mode <= static_cast<int>(CanvasRenderMode::WorldSpace)) ? static_cast<CanvasRenderMode>(mode) : CanvasRenderMode::ScreenSpaceOverlay;
+            return true;
+        }
+        if (key == "sortingOrder") return reader.Read(sortingOrder);
+        if (key == "referenceResolution") return reader.Read(referenceResolution);
+        return Component::DeserializeProperty(key, reader);
+    }
+
+    void Canvas::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        writer.Write(static_cast<int>(renderMode));
+        writer.Write(sortingOrder);
+        writer.Write(referenceResolution);
+    }
+
+    bool Canvas::ReadBinary(BinaryReader& reader)
+    {
+        int mode = 0;
+        if (!Component::ReadBinary(reader) || !reader.Read(mode)) return false;
+        renderMode = (mode >= 0 && mode <= static_cast<int>(CanvasRenderMode::WorldSpace)) ? static_cast<CanvasRenderMode>(mode) : CanvasRenderMode::ScreenSpaceOverlay;
+        return reader.Read(sortingOrder) && reader.Read(referenceResolution);
+    }
+
     void Canvas::Start()
     {
         Component::Start();
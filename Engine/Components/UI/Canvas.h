@@ -35,6 +35,11 @@ namespace AronEngine
         void Update(float deltaTime) override;
         void OnDestroy() override;
 
+        void Serialize(JsonWriter& writer) const override;
+        bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        bool ReadBinary(BinaryReader& reader) override;
+
         // Properties
         void SetRenderMode(CanvasRenderMode mode) { renderMode = mode; }
         CanvasRenderMode GetRenderMode() const { return renderMode; }
@@ -3,9 +3,37 @@
 #include "../../Core/Renderer.h"
 #include "../../Core/EngineApp.h"
 #include "../../Core/Input.h"
+#include "../../Utils/JsonWriter.h"
+#include "../../Utils/JsonReader.h"
+#include "../../Utils/BinaryWriter.h"
+#include "../../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
+    namespace
+    {
+        // Scene files are UTF-8
+        std::string ToUtf8(const std::wstring& text)
+        {
+            if (text.empty()) return std::string();
+
+            const int size = WideCharToMultiByte(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), nullptr, 0, nullptr, nullptr);
+            std::string result(size, '\0');
+            WideCharToMultiByte(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), &result[0], size, nullptr, nullptr);
+            return result;
+        }
+
+        std::wstring FromUtf8(std::string_view text)
+        {
+            if (text.empty()) return std::wstring();
+
+            const int size = MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), nullptr, 0);
+            std::wstring result(size, L'\0');
+            MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), &result[0], size);
+            return result;
+        }
+    }
+
     UIButton::UIButton()
         : UIElement()
         , text(L"Button")
@@ -29,6 +57,63 @@ namespace AronEngine
     {
     }
 
+    void UIButton::Serialize(JsonWriter& writer) const
+    {
+        UIElement::Serialize(writer);
+        writer.Write("text", ToUtf8(text));
+        writer.Write("font", ToUtf8(fontName));
+        writer.Write("fontSize", fontSize);
+        writer.Write("normalColor", normalColor);
+        writer.Write("highlightedColor", highlightedColor);
+        writer.Write("pressedColor", pressedColor);
+        writer.Write("disabledColor", disabledColor);
+        writer.Write("textColor", textColor);
+    }
+
+    bool UIButton::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        if (key == "text" || key == "font")
+        {
+            const bool isText = key == "text";
+            std::string_view value;
+            if (!reader.ReadString(value)) return false;
+            (isText ? text : fontName) = FromUtf8(value);
+            return true;
+        }
+        if (key == "fontSize") return reader.Read(fontSize);
+        if (key == "normalColor") return reader.Read(normalColor);
+        if (key == "highlightedColor") return reader.Read(highlightedColor);
+        if (key == "pressedColor") return reader.Read(pressedColor);
+        if (key == "disabledColor") return reader.Read(disabledColor);
+        if (key == "textColor") return reader.Read(textColor);
+        return UIElement::DeserializeProperty(key, reader);
+    }
+
+    void UIButton::WriteBinary(BinaryWriter& writer) const
+    {
+        UIElement::WriteBinary(writer);
+        writer.WriteString(ToUtf8(text));
+        writer.WriteString(ToUtf8(fontName));
+        writer.Write(fontSize);
+        writer.Write(normalColor);
+        writer.Write(highlightedColor);
+        writer.Write(pressedColor);
+        writer.Write(disabledColor);
+        writer.Write(textColor);
+    }
+
+    bool UIButton::ReadBinary(BinaryReader& reader)
+    {
+        std::string_view value;
+        if (!UIElement::ReadBinary(reader) || !reader.ReadString(value)) return false;
+        text = FromUtf8(value);
+        if (!reader.ReadString(value)) return false;
+        fontName = FromUtf8(value);
+
+        return reader.Read(fontSize) && reader.Read(normalColor) && reader.Read(highlightedColor)
+            && reader.Read(pressedColor) && reader.Read(disabledColor) && reader.Read(textColor);
+    }
+
     void UIButton::OnRender()
     {
         if (!visible) return;
@@ -45,6 +45,12 @@ namespace AronEngine
         void OnHover() override;
         void OnUnhover() override;
 
+        // The click callback is code, so it isn't saved
+        void Serialize(JsonWriter& writer) const override;
+        bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        bool ReadBinary(BinaryReader& reader) override;
+
         // Properties
         void SetText(const std::wstring& buttonText) { text = buttonText; }
         const std::wstring& GetText() const { return text; }
@@ -2,6 +2,10 @@
 #include "UIElement.h"
 #include "Canvas.h"
 #include "../../Core/GameObject.h"
+#include "../../Utils/JsonWriter.h"
+#include "../../Utils/JsonReader.h"
+#include "../../Utils/BinaryWriter.h"
+#include "../../Utils/BinaryReader.h"
 
 namespace AronEngine
 {
@@ -22,6 +26,65 @@ namespace AronEngine
     {
     }
 
+    void UIElement::Serialize(JsonWriter& writer) const
+    {
+        Component::Serialize(writer);
+        writer.Write("anchoredPosition", anchoredPosition);
+        writer.Write("sizeDelta", sizeDelta);
+        writer.Write("anchor", static_cast<int>(anchor));
+        writer.Write("pivot", pivot);
+        writer.Write("interactable", interactable);
+        writer.Write("visible", visible);
+        writer.Write("alpha", alpha);
+    }
+
+    bool UIElement::DeserializeProperty(std::string_view key, JsonReader& reader)
+    {
+        if (key == "anchoredPosition") return reader.Read(anchoredPosition);
+        if (key == "sizeDelta") return reader.Read(sizeDelta);
+        if (key == "anchor")
+        {
+            int type = 0;
+            if (!reader.Read(type)) return false;
+            anchor = (type >= 0 && type <= static_cast<int>(AnchorType::Custom)) ? static_cast<AnchorType>(type) : AnchorType::MiddleCenter;
+            return true;
+        }
+        if (key == "pivot") return reader.Read(pivot);
+        if (key == "interactable") return reader.Read(interactable);
+        if (key == "visible") return reader.Read(visible);
+        if (key == "alpha")
+        {
+            if (!reader.Read(alpha)) return false;
+            SetAlpha(alpha);
+            return true;
+        }
+        return Component::DeserializeProperty(key, reader);
+    }
+
+    void UIElement::WriteBinary(BinaryWriter& writer) const
+    {
+        Component::WriteBinary(writer);
+        writer.Write(anchoredPosition);
+        writer.Write(sizeDelta);
+        writer.Write(static_cast<int>(anchor));
+        writer.Write(pivot);
+        writer.Write(interactable);
+        writer.Write(visible);
+        writer.Write(alpha);
+    }
+
+    bool UIElement::ReadBinary(BinaryReader& reader)
+    {
+        int type = 0;
+        if (!Component::ReadBinary(reader) || !reader.Read(anchoredPosition) || !reader.Read(sizeDelta) || !reader.Read(type)) return false;
+        anchor = (type >= 0 && type <= static_cast<int>(AnchorType::Custom)) ? static_cast<AnchorType>(type) : AnchorType::MiddleCenter;
+
+        float opacity = 1.0f;
+        if (!reader.Read(pivot) || !reader.Read(interactable) || !reader.Read(visible) || !reader.Read(opacity)) return false;
+        SetAlpha(opacity);
+        return true;
+    }
+
     void UIElement::Start()
     {
         Component::Start();
@@ -18,7 +18,7 @@ namespace AronEngine
     class UIElement : public Component
     {
     protected:
-        Canvas* parentCanvas;
+        InstancePtr<Canvas> parentCanvas;
         Vector2 anchoredPosition;
         Vector2 sizeDelta;
         AnchorType anchor;
@@ -36,6 +36,11 @@ namespace AronEngine
         void Update(float deltaTime) override;
         void OnDestroy() override;
 
+        void Serialize(JsonWriter& writer) const override;
+        bool DeserializeProperty(std::string_view key, JsonReader& reader) override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        bool ReadBinary(BinaryReader& reader) override;
+
         // Virtual methods for derived classes
         virtual void OnRender() = 0;
         virtual void OnClick() {}
@@ -0,0 +1,48 @@
+#include "framework.h"
+#include "AssetRequestQueue.h"
+#include <chrono>
+
+namespace AronEngine
+{
+    namespace
+    {
+        thread_local AssetRequestQueue* t_currentQueue = nullptr;
+    }
+
+    AssetRequestQueue::Scope::Scope(AssetRequestQueue& queue)
+        : previous(t_currentQueue)
+    {
+        t_currentQueue = &queue;
+    }
+
+    AssetRequestQueue::Scope::~Scope()
+    {
+        t_currentQueue = previous;
+    }
+
+    AssetRequestQueue::AssetRequestQueue()
+        : processed(0)
+    {
+    }
+
+    AssetRequestQueue* AssetRequestQueue::GetCurrent()
+    {
+        return t_currentQueue;
+    }
+
+    bool AssetRequestQueue::Process(double budgetMs)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        while (processed < requests.size())
+        {
+            // Release what the request captured as soon as it has run
+            Request request = std::move(requests[processed++]);
+            request();
+
+            const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+            if (elapsedMs >= budgetMs)
+                break;
+        }
+        return IsDone();
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "framework.h"
+#include <functional>
+#include <vector>
+
+namespace AronEngine
+{
+    // Asset loads asked for while a scene is built off the main thread. Textures and audio
+    // clips live in main-thread managers, so code that would load one checks GetCurrent() and,
+    // when a queue is installed on this thread, hands it the load instead. The queue's owner
+    // runs the requests on the main thread once the building thread is done with the objects.
+    class AssetRequestQueue
+    {
+    public:
+        using Request = std::function<void()>;
+
+        // Installs a queue for the current thread for the scope's lifetime
+        class Scope
+        {
+        private:
+            AssetRequestQueue* previous;
+
+        public:
+            explicit Scope(AssetRequestQueue& queue);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+    private:
+        std::vector<Request> requests;
+        size_t processed;
+
+    public:
+        AssetRequestQueue();
+
+        // Null unless the calling thread is building a scene in the background
+        static AssetRequestQueue* GetCurrent();
+
+        void Push(Request request) { requests.push_back(std::move(request)); }
+
+        // Runs requests in order until they run out or budgetMs has passed (at least one per
+        // call); true once all of them have run
+        bool Process(double budgetMs);
+
+        size_t GetCount() const { return requests.size(); }
+        size_t GetProcessedCount() const { return processed; }
+        bool IsDone() const { return processed == requests.size(); }
+    };
+}
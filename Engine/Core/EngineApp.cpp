@@ -2,18 +2,44 @@
 #include "EngineApp.h"
 #include "EngineTime.h"
 #include "Input.h"
+#include "InputRecording.h"
+#include "Profiler.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
+#include "JobSystem.h"
+#include "SystemScheduler.h"
 #include "Renderer.h"
 #include "../Managers/SceneManager.h"
 #include "../Managers/ResourceManager.h"
 #include "../Managers/SimpleAudioManager.h"
+#include "../Managers/AudioManager.h"
 #include "../Systems/RenderSystem.h"
 #include "../Systems/TransformSystem.h"
 #include "../Systems/ScriptSystem.h"
+#include "../Systems/AudioSystem.h"
+#include "../Systems/PhysicsSystem.h"
+#include "../Components/Transform.h"
+#include "../Components/Collider.h"
+#include "../Components/Rigidbody.h"
+#include "../Components/SpriteRenderer.h"
+#include "../Components/AudioSource.h"
+#include "../Components/AudioListener.h"
 #include "../Editor/EditorSystem.h"
 #include "../Editor/ImGuiEditorSystem.h"
 
 namespace AronEngine
 {
+    EngineApp* EngineApp::s_instance = nullptr;
+
+    EngineApp& EngineApp::GetInstance()
+    {
+        if (s_instance)
+        {
+            return *s_instance;
+        }
+        return Singleton<EngineApp>::GetInstance();
+    }
+
     EngineApp::EngineApp()
         : hInstance(nullptr)
         , hWnd(nullptr)
@@ -23,11 +49,23 @@ namespace AronEngine
         , windowClassName(L"AronEngineWindow")
         , isRunning(false)
         , isEditorMode(true)
+        , isHeadless(false)
+        , useNullRenderer(false)
+        , isPlaying(false)
+        , quitAfterReplay(false)
     {
+        if (!s_instance)
+        {
+            s_instance = this;
+        }
     }
 
     EngineApp::~EngineApp()
     {
+        if (s_instance == this)
+        {
+            s_instance = nullptr;
+        }
     }
 
     bool EngineApp::Initialize(HINSTANCE hInstance, int width, int height, const std::wstring& title, bool editorMode)
@@ -36,7 +74,8 @@ namespace AronEngine
         this->width = width;
         this->height = height;
         this->windowTitle = title;
-        this->isEditorMode = editorMode;
+        this->isEditorMode = editorMode && !isHeadless;
+        this->isPlaying = !isEditorMode;
 
         if (!CreateAppWindow())
         {
@@ -52,8 +91,15 @@ namespace AronEngine
         renderSystem = std::make_unique<RenderSystem>();
         transformSystem = std::make_unique<TransformSystem>();
         scriptSystem = std::make_unique<ScriptSystem>();
-
-        if (!renderer->Initialize(hWnd, width, height))
+        audioSystem = std::make_unique<AudioSystem>();
+        physicsSystem = std::make_unique<PhysicsSystem>();
+        systemScheduler = std::make_unique<SystemScheduler>();
+        RegisterEngineSystems();
+
+        const bool rendererReady = useNullRenderer
+            ? renderer->InitializeNull(width, height)
+            : renderer->Initialize(hWnd, width, height);
+        if (!rendererReady)
         {
             DEBUG_LOG("Failed to initialize renderer");
             return false;
@@ -71,8 +117,15 @@ namespace AronEngine
             return false;
         }
 
+        // No audio device is not fatal; the mixer just isn't pumped
+        if (!AudioManager::GetInstance().Initialize(hWnd))
+        {
+            DEBUG_LOG("Failed to initialize audio manager");
+        }
+
         if (isEditorMode)
         {
+            MEMORY_TAG(Editor);
             editorSystem = std::make_unique<EditorSystem>();
             if (!editorSystem->Initialize(hWnd, renderer.get()))
             {
@@ -81,10 +134,25 @@ namespace AronEngine
             }
         }
 
+        // External viewers are optional; the counters work without the mapping
+        EngineStats::GetInstance().OpenSharedMemory();
+
+        if (!JobSystem::GetInstance().Initialize())
+        {
+            DEBUG_LOG("Failed to initialize job system");
+            return false;
+        }
+
         OnInit();
 
-        ShowWindow(hWnd, SW_SHOW);
-        UpdateWindow(hWnd);
+        if (!isHeadless)
+        {
+            // Headless runs keep playback on the calling thread, so frame timings stay comparable
+            renderer->SetRenderThreadEnabled(true);
+
+            ShowWindow(hWnd, SW_SHOW);
+            UpdateWindow(hWnd);
+        }
 
         isRunning = true;
         return true;
@@ -94,6 +162,7 @@ namespace AronEngine
     {
         MSG msg = { 0 };
 
+        Profiler::SetThreadName("Main");
         time->Start();
 
         while (isRunning)
@@ -109,35 +178,83 @@ namespace AronEngine
             }
             else
             {
-                time->Update();
-                float deltaTime = time->GetDeltaTime();
+                {
+                    PROFILE_SCOPE("Frame");
+
+                    float deltaTime = AdvanceFrame();
+
+                    Update(deltaTime);
+                    Render();
+                }
 
-                Update(deltaTime);
-                Render();
+                EndFrame();
             }
         }
     }
 
+    void EngineApp::StepFrame(float fixedDeltaTime)
+    {
+        ProcessMessages();
+
+        {
+            PROFILE_SCOPE("Frame");
+
+            // A replay's recorded delta wins, so headless runs reproduce the captured frames
+            if (!ReadReplayFrame())
+            {
+                time->UpdateWithDelta(fixedDeltaTime);
+            }
+            Update(time->GetDeltaTime());
+            Render();
+        }
+
+        EndFrame();
+    }
+
+    void EngineApp::EndFrame()
+    {
+        Profiler::GetInstance().EndFrame();
+        MemoryTracker::GetInstance().EndFrame();
+
+        EngineStats::Add(StatCounter::BytesAllocated, MemoryTracker::ConsumeFrameAllocatedBytes());
+        EngineStats::GetInstance().EndFrame(time->GetUnscaledDeltaTime() * 1000.0f);
+    }
+
     void EngineApp::Shutdown()
     {
+        // Submitted frames reference editor and scene state that is torn down below
+        if (renderer)
+        {
+            renderer->SetRenderThreadEnabled(false);
+        }
+
         OnShutdown();
 
+        StopInputRecording();
+        StopInputReplay();
+
         if (editorSystem)
         {
             editorSystem->Shutdown();
         }
 
+        systemScheduler.reset();
         scriptSystem.reset();
         transformSystem.reset();
         renderSystem.reset();
+        physicsSystem.reset();
         resourceManager.reset();
         sceneManager.reset();
+        audioSystem.reset();
         renderer.reset();
         input.reset();
         time.reset();
         editorSystem.reset();
         
         SimpleAudioManager::GetInstance().Shutdown();
+        AudioManager::GetInstance().Shutdown();
+        EngineStats::GetInstance().CloseSharedMemory();
+        JobSystem::GetInstance().Shutdown();
 
         if (hWnd)
         {
@@ -194,26 +311,141 @@ namespace AronEngine
         return true;
     }
 
+    bool EngineApp::StartInputRecording(const std::string& path)
+    {
+        auto recorder = std::make_unique<InputRecorder>();
+        if (!recorder->Open(path))
+        {
+            return false;
+        }
+        inputRecorder = std::move(recorder);
+        return true;
+    }
+
+    void EngineApp::StopInputRecording()
+    {
+        inputRecorder.reset();
+    }
+
+    bool EngineApp::StartInputReplay(const std::string& path, bool quitWhenFinished)
+    {
+        auto replay = std::make_unique<InputReplay>();
+        if (!replay->Open(path))
+        {
+            return false;
+        }
+        inputReplay = std::move(replay);
+        quitAfterReplay = quitWhenFinished;
+        return true;
+    }
+
+    void EngineApp::StopInputReplay()
+    {
+        inputReplay.reset();
+    }
+
+    float EngineApp::AdvanceFrame()
+    {
+        PROFILE_SCOPE("EngineApp::AdvanceFrame");
+
+        if (!ReadReplayFrame())
+        {
+            time->Update();
+            input->Update();
+        }
+
+        if (inputRecorder)
+        {
+            inputRecorder->WriteFrame(*input, time->GetUnscaledDeltaTime());
+        }
+
+        return time->GetDeltaTime();
+    }
+
+    bool EngineApp::ReadReplayFrame()
+    {
+        if (!inputReplay)
+            return false;
+
+        float recordedDelta = 0.0f;
+        if (inputReplay->ReadFrame(*input, recordedDelta))
+        {
+            time->UpdateWithDelta(recordedDelta);
+            return true;
+        }
+
+        DEBUG_LOG("Input replay finished after " + std::to_string(inputReplay->GetFramesRead()) + " frames");
+        StopInputReplay();
+        if (quitAfterReplay)
+        {
+            Quit();
+        }
+        return false;
+    }
+
     void EngineApp::Update(float deltaTime)
     {
-        input->Update();
+        PROFILE_SCOPE("EngineApp::Update");
 
         if (editorSystem && isEditorMode)
         {
+            MEMORY_TAG(Editor);
             editorSystem->Update(deltaTime);
         }
 
-        if (sceneManager->GetActiveScene())
+        systemScheduler->Update(deltaTime);
+    }
+
+    void EngineApp::RegisterEngineSystems()
+    {
+        // Declared in the order they used to run; the scheduler only reorders what doesn't conflict.
+        // Scene updates and OnUpdate run arbitrary component and game code, so they fence everything.
+        // Loads and scene switches always finish; the simulation itself waits for play
+        systemScheduler->AddSystem("Scene", SystemAccess().Exclusive().MainThread(), [this](float deltaTime)
         {
-            transformSystem->Update(deltaTime);
-            scriptSystem->Update(deltaTime);
-        }
+            if (isPlaying) sceneManager->Update(deltaTime);
+            else sceneManager->UpdateLoading();
+        });
 
-        OnUpdate(deltaTime);
+        systemScheduler->AddSystem("Physics", SystemAccess().Read<Collider>().Write<Rigidbody>().Write<Transform>(), [this](float deltaTime)
+        {
+            if (isPlaying && sceneManager->GetActiveScene()) physicsSystem->Update(deltaTime);
+        });
+
+        systemScheduler->AddSystem("Transform", SystemAccess().Write<Transform>(), [this](float deltaTime)
+        {
+            if (sceneManager->GetActiveScene()) transformSystem->Update(deltaTime);
+        });
+
+        systemScheduler->AddSystem("Script", SystemAccess().MainThread(), [this](float deltaTime)
+        {
+            if (isPlaying && sceneManager->GetActiveScene()) scriptSystem->Update(deltaTime);
+        });
+
+        systemScheduler->AddSystem("Render", SystemAccess().Read<SpriteRenderer>().Write("RenderQueue"), [this](float deltaTime)
+        {
+            if (sceneManager->GetActiveScene()) renderSystem->Update(deltaTime);
+        });
+
+        systemScheduler->AddSystem("OnUpdate", SystemAccess().Exclusive().MainThread(), [this](float deltaTime)
+        {
+            OnUpdate(deltaTime);
+        });
+
+        // The mixer command ring has a single producer and AudioManager talks to DirectSound
+        systemScheduler->AddSystem("Audio", SystemAccess().Read<Transform>().Read<AudioSource>().Read<AudioListener>()
+            .Write("AudioMixer").MainThread(), [this](float deltaTime)
+        {
+            MEMORY_TAG(Audio);
+            audioSystem->Update(deltaTime);
+            AudioManager::GetInstance().Update();
+        });
     }
 
     void EngineApp::Render()
     {
+        PROFILE_SCOPE("EngineApp::Render");
+
         renderer->BeginDraw();
         renderer->Clear(Color(0.2f, 0.2f, 0.2f));
 
@@ -226,6 +458,7 @@ namespace AronEngine
 
         if (editorSystem && isEditorMode)
         {
+            MEMORY_TAG(Editor);
             editorSystem->Render();
         }
 
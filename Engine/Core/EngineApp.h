@@ -6,13 +6,18 @@ namespace AronEngine
 {
     class Time;
     class Input;
+    class InputRecorder;
+    class InputReplay;
     class Renderer;
     class SceneManager;
     class ResourceManager;
     class RenderSystem;
     class TransformSystem;
     class ScriptSystem;
+    class AudioSystem;
+    class PhysicsSystem;
     class EditorSystem;
+    class SystemScheduler;
 
     class EngineApp : public Singleton<EngineApp>
     {
@@ -27,6 +32,9 @@ namespace AronEngine
         std::wstring windowClassName;
         bool isRunning;
         bool isEditorMode;
+        bool isHeadless;
+        bool useNullRenderer;
+        bool isPlaying;
 
         std::unique_ptr<Time> time;
         std::unique_ptr<Input> input;
@@ -36,17 +44,42 @@ namespace AronEngine
         std::unique_ptr<RenderSystem> renderSystem;
         std::unique_ptr<TransformSystem> transformSystem;
         std::unique_ptr<ScriptSystem> scriptSystem;
+        std::unique_ptr<AudioSystem> audioSystem;
+        std::unique_ptr<PhysicsSystem> physicsSystem;
         std::unique_ptr<EditorSystem> editorSystem;
+        std::unique_ptr<SystemScheduler> systemScheduler;
+
+        std::unique_ptr<InputRecorder> inputRecorder;
+        std::unique_ptr<InputReplay> inputReplay;
+        bool quitAfterReplay;
+
+    private:
+        static EngineApp* s_instance;
 
     protected:
         EngineApp();
         virtual ~EngineApp();
 
     public:
+        // The running app is usually a game subclass, not the Singleton's own instance
+        static EngineApp& GetInstance();
+
         bool Initialize(HINSTANCE hInstance, int width, int height, const std::wstring& title, bool editorMode = true);
         void Run();
         void Shutdown();
 
+        // Headless: call before Initialize. The window stays hidden and no editor is created;
+        // drive frames with StepFrame() instead of Run().
+        void SetHeadless(bool headless) { isHeadless = headless; }
+        bool IsHeadless() const { return isHeadless; }
+        // Null renderer: call before Initialize. Frames are recorded (and captured, see
+        // Renderer::SetCapture) without a graphics device; nothing is drawn or presented.
+        void SetNullRenderer(bool enable) { useNullRenderer = enable; }
+        bool IsNullRenderer() const { return useNullRenderer; }
+        // One full frame (update, render, profiler frame) with a fixed delta, or the recorded
+        // delta and input while an input replay is running
+        void StepFrame(float fixedDeltaTime);
+
         virtual void OnInit() {}
         virtual void OnUpdate(float deltaTime) {}
         virtual void OnRender() {}
@@ -56,19 +89,42 @@ namespace AronEngine
         int GetWidth() const { return width; }
         int GetHeight() const { return height; }
         bool IsEditorMode() const { return isEditorMode; }
+        // Scene updates, physics and scripts only run while playing. Games and headless runs
+        // start playing; the editor starts stopped. Stopping pauses, it does not restore the scene.
+        void SetPlaying(bool playing) { isPlaying = playing; }
+        bool IsPlaying() const { return isPlaying; }
         void Quit() { isRunning = false; }
 
+        // Input capture for repeatable runs; a replay drives both Input and Time
+        bool StartInputRecording(const std::string& path);
+        void StopInputRecording();
+        bool StartInputReplay(const std::string& path, bool quitWhenFinished = false);
+        void StopInputReplay();
+        bool IsRecordingInput() const { return inputRecorder != nullptr; }
+        bool IsReplayingInput() const { return inputReplay != nullptr; }
+
         Time* GetTime() const { return time.get(); }
         Input* GetInput() const { return input.get(); }
         Renderer* GetRenderer() const { return renderer.get(); }
         SceneManager* GetSceneManager() const { return sceneManager.get(); }
         ResourceManager* GetResourceManager() const { return resourceManager.get(); }
+        AudioSystem* GetAudioSystem() const { return audioSystem.get(); }
+        PhysicsSystem* GetPhysicsSystem() const { return physicsSystem.get(); }
+        RenderSystem* GetRenderSystem() const { return renderSystem.get(); }
         EditorSystem* GetEditorSystem() const { return editorSystem.get(); }
+        // Games can add their own systems; they run after the engine's
+        SystemScheduler* GetSystemScheduler() const { return systemScheduler.get(); }
 
     private:
         bool CreateAppWindow();
+        float AdvanceFrame();
+        // Applies the next replayed frame's input and recorded delta; false without one
+        bool ReadReplayFrame();
+        void RegisterEngineSystems();
         void Update(float deltaTime);
         void Render();
+        // Closes the frame for the profiler, memory tracker and stats counters
+        void EndFrame();
         void ProcessMessages();
 
         static LRESULT CALLBACK WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
@@ -0,0 +1,221 @@
+#include "framework.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        const char* const kCounterNames[kStatCounterCount] = {
+            "DrawCalls",
+            "SpritesSubmitted",
+            "Batches",
+            "TexturesBound",
+            "CollisionPairsTested",
+            "Contacts",
+            "GameObjectsCreated",
+            "GameObjectsDestroyed",
+            "ComponentsUpdated",
+            "BytesAllocated",
+            "JobsExecuted",
+            "PooledAcquires",
+            "SpritesCulled"
+        };
+
+        static_assert(kStatCounterCount <= SharedStatsBlock::kMaxCounters, "SharedStatsBlock too small");
+    }
+
+    EngineStats::EngineStats()
+        : historyHead(0)
+        , frameIndex(0)
+        , sharedMapping(nullptr)
+        , sharedBlock(nullptr)
+    {
+        for (auto& value : current)
+        {
+            value.store(0, std::memory_order_relaxed);
+        }
+
+        MEMORY_TAG(Profiling);
+        history.reserve(kHistoryFrames);
+    }
+
+    EngineStats::~EngineStats()
+    {
+        CloseSharedMemory();
+    }
+
+    const char* EngineStats::GetCounterName(StatCounter counter)
+    {
+        const size_t index = static_cast<size_t>(counter);
+        return index < kStatCounterCount ? kCounterNames[index] : "Unknown";
+    }
+
+    void EngineStats::EndFrame(float frameMs)
+    {
+        StatsFrame frame;
+        frame.frameIndex = frameIndex++;
+        frame.frameMs = frameMs;
+        for (size_t i = 0; i < kStatCounterCount; ++i)
+        {
+            frame.values[i] = current[i].exchange(0, std::memory_order_relaxed);
+        }
+
+        if (history.size() < kHistoryFrames)
+        {
+            history.push_back(frame);
+        }
+        else
+        {
+            history[historyHead] = frame;
+            historyHead = (historyHead + 1) % kHistoryFrames;
+        }
+
+        PublishShared(frame);
+    }
+
+    const StatsFrame* EngineStats::GetLastFrame() const
+    {
+        if (history.empty()) return nullptr;
+        if (history.size() < kHistoryFrames) return &history.back();
+        return &history[(historyHead + kHistoryFrames - 1) % kHistoryFrames];
+    }
+
+    std::vector<const StatsFrame*> EngineStats::GetHistory() const
+    {
+        std::vector<const StatsFrame*> frames;
+        frames.reserve(history.size());
+
+        const size_t start = history.size() < kHistoryFrames ? 0 : historyHead;
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            frames.push_back(&history[(start + i) % history.size()]);
+        }
+        return frames;
+    }
+
+    void EngineStats::GetCounterHistory(StatCounter counter, std::vector<float>& outValues) const
+    {
+        outValues.clear();
+        for (const StatsFrame* frame : GetHistory())
+        {
+            outValues.push_back(static_cast<float>(frame->Get(counter)));
+        }
+    }
+
+    double EngineStats::GetAverage(StatCounter counter) const
+    {
+        if (history.empty()) return 0.0;
+
+        double sum = 0.0;
+        for (const auto& frame : history)
+        {
+            sum += static_cast<double>(frame.Get(counter));
+        }
+        return sum / history.size();
+    }
+
+    int64_t EngineStats::GetMax(StatCounter counter) const
+    {
+        int64_t maxValue = 0;
+        for (const auto& frame : history)
+        {
+            maxValue = (std::max)(maxValue, frame.Get(counter));
+        }
+        return maxValue;
+    }
+
+    bool EngineStats::OpenSharedMemory(const wchar_t* name)
+    {
+        CloseSharedMemory();
+
+        sharedMapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+            0, static_cast<DWORD>(sizeof(SharedStatsBlock)), name);
+        if (!sharedMapping)
+        {
+            DEBUG_LOG("Failed to create stats shared memory");
+            return false;
+        }
+
+        sharedBlock = static_cast<SharedStatsBlock*>(
+            MapViewOfFile(sharedMapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedStatsBlock)));
+        if (!sharedBlock)
+        {
+            DEBUG_LOG("Failed to map stats shared memory");
+            CloseHandle(sharedMapping);
+            sharedMapping = nullptr;
+            return false;
+        }
+
+        // Header is written once; only the sequence, frame and values change afterwards
+        sharedBlock->sequence.store(0, std::memory_order_relaxed);
+        sharedBlock->counterCount = static_cast<uint32_t>(kStatCounterCount);
+        sharedBlock->frameIndex = 0;
+        sharedBlock->frameMs = 0.0;
+        memset(sharedBlock->names, 0, sizeof(sharedBlock->names));
+        memset(sharedBlock->values, 0, sizeof(sharedBlock->values));
+        for (size_t i = 0; i < kStatCounterCount; ++i)
+        {
+            strncpy_s(sharedBlock->names[i], kCounterNames[i], _TRUNCATE);
+        }
+        sharedBlock->version = SharedStatsBlock::kVersion;
+        std::atomic_thread_fence(std::memory_order_release);
+        sharedBlock->magic = SharedStatsBlock::kMagic;
+
+        DEBUG_LOG("Engine stats published to shared memory");
+        return true;
+    }
+
+    void EngineStats::CloseSharedMemory()
+    {
+        if (sharedBlock)
+        {
+            UnmapViewOfFile(sharedBlock);
+            sharedBlock = nullptr;
+        }
+        if (sharedMapping)
+        {
+            CloseHandle(sharedMapping);
+            sharedMapping = nullptr;
+        }
+    }
+
+    void EngineStats::PublishShared(const StatsFrame& frame)
+    {
+        if (!sharedBlock) return;
+
+        // Seqlock: odd while writing, so readers never wait on the game thread
+        const uint32_t sequence = sharedBlock->sequence.load(std::memory_order_relaxed);
+        sharedBlock->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        sharedBlock->frameIndex = frame.frameIndex;
+        sharedBlock->frameMs = frame.frameMs;
+        memcpy(sharedBlock->values, frame.values, sizeof(frame.values));
+
+        sharedBlock->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    bool EngineStats::ReadSharedBlock(const SharedStatsBlock* block, StatsFrame& outFrame, int maxRetries)
+    {
+        if (!block || block->magic != SharedStatsBlock::kMagic || block->version != SharedStatsBlock::kVersion)
+            return false;
+
+        const size_t count = (std::min)(static_cast<size_t>(block->counterCount), kStatCounterCount);
+
+        for (int attempt = 0; attempt < maxRetries; ++attempt)
+        {
+            const uint32_t before = block->sequence.load(std::memory_order_acquire);
+            if (before & 1u) continue;
+
+            outFrame.frameIndex = block->frameIndex;
+            outFrame.frameMs = static_cast<float>(block->frameMs);
+            memcpy(outFrame.values, block->values, count * sizeof(int64_t));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (block->sequence.load(std::memory_order_relaxed) == before)
+                return true;
+        }
+        return false;
+    }
+}
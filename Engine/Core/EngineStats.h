@@ -0,0 +1,117 @@
+#pragma once
+#include "framework.h"
+#include "Singleton.h"
+#include <atomic>
+
+namespace AronEngine
+{
+    // Indices are part of the SharedStatsBlock layout: add counters at the end, and bump
+    // SharedStatsBlock::kVersion if an existing one ever moves
+    enum class StatCounter : uint32_t
+    {
+        DrawCalls,
+        SpritesSubmitted,
+        Batches,                // runs of consecutive draws sharing a texture
+        TexturesBound,          // texture changes between draws
+        CollisionPairsTested,
+        Contacts,
+        GameObjectsCreated,
+        GameObjectsDestroyed,
+        ComponentsUpdated,
+        BytesAllocated,
+        JobsExecuted,
+        PooledAcquires,         // GameObjectPool::Acquire calls
+        SpritesCulled,          // drawable sprites outside every view
+
+        Count
+    };
+
+    constexpr size_t kStatCounterCount = static_cast<size_t>(StatCounter::Count);
+
+    struct StatsFrame
+    {
+        uint64_t frameIndex = 0;
+        float frameMs = 0.0f;
+        int64_t values[kStatCounterCount] = {};
+
+        int64_t Get(StatCounter counter) const { return values[static_cast<size_t>(counter)]; }
+    };
+
+    // Layout of the named shared-memory block. An external viewer maps it read-only and copies
+    // it under the sequence lock: retry while the sequence is odd or changes across the copy.
+    struct SharedStatsBlock
+    {
+        static constexpr uint32_t kMagic = 0x54534541;     // "AEST"
+        static constexpr uint32_t kVersion = 1;
+        static constexpr size_t kMaxCounters = 32;
+        static constexpr size_t kNameLength = 32;
+
+        uint32_t magic;
+        uint32_t version;
+        std::atomic<uint32_t> sequence;
+        uint32_t counterCount;
+        uint64_t frameIndex;
+        double frameMs;
+        char names[kMaxCounters][kNameLength];
+        int64_t values[kMaxCounters];           // last completed frame
+    };
+
+    class EngineStats : public Singleton<EngineStats>
+    {
+        friend class Singleton<EngineStats>;
+
+    public:
+        static constexpr size_t kHistoryFrames = 300;
+        static constexpr const wchar_t* kSharedMemoryName = L"Local\\AronEngineStats";
+
+    private:
+        // Written from any thread; relaxed is enough since EndFrame only needs eventual totals
+        std::atomic<int64_t> current[kStatCounterCount];
+
+        std::vector<StatsFrame> history;        // ring of kHistoryFrames
+        size_t historyHead;
+        uint64_t frameIndex;
+
+        HANDLE sharedMapping;
+        SharedStatsBlock* sharedBlock;
+
+    protected:
+        EngineStats();
+        virtual ~EngineStats();
+
+    public:
+        static void Add(StatCounter counter, int64_t amount = 1)
+        {
+            GetInstance().current[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        // Value accumulated so far in the frame in progress
+        int64_t GetCurrent(StatCounter counter) const
+        {
+            return current[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+        }
+
+        // Main thread, once per frame: closes the frame, resets counters and publishes to shared memory
+        void EndFrame(float frameMs);
+
+        const StatsFrame* GetLastFrame() const;
+        // Oldest first; up to kHistoryFrames
+        std::vector<const StatsFrame*> GetHistory() const;
+        void GetCounterHistory(StatCounter counter, std::vector<float>& outValues) const;
+        double GetAverage(StatCounter counter) const;
+        int64_t GetMax(StatCounter counter) const;
+
+        static const char* GetCounterName(StatCounter counter);
+
+        bool OpenSharedMemory(const wchar_t* name = kSharedMemoryName);
+        void CloseSharedMemory();
+        bool IsSharedMemoryOpen() const { return sharedBlock != nullptr; }
+
+        // Viewer side: consistent copy of a mapped block; false if it's not a stats block or the
+        // writer kept it busy for every retry
+        static bool ReadSharedBlock(const SharedStatsBlock* block, StatsFrame& outFrame, int maxRetries = 64);
+
+    private:
+        void PublishShared(const StatsFrame& frame);
+    };
+}
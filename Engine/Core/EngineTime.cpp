@@ -1,10 +1,80 @@
 #include "framework.h"
 #include "EngineTime.h"
+#include "Profiler.h"
+#include <iomanip>
+#include <cfloat>
 
 namespace AronEngine
 {
     static std::chrono::steady_clock::time_point g_startupTime = std::chrono::steady_clock::now();
 
+    namespace
+    {
+        const char* const kUntrackedZone = "Untracked";
+
+        constexpr float kBaselineBlend = 0.05f;
+        // Attribution descends into a child that explains at least this share of its parent's overrun
+        constexpr float kDrillDownShare = 0.5f;
+
+        struct ZoneCandidate
+        {
+            const char* name;
+            float ms;
+            size_t largest;     // index of the longest instance, to descend into
+            float largestMs;
+        };
+
+        float ZoneMs(const ProfileZone& zone)
+        {
+            return static_cast<float>((zone.end - zone.start) * 1e-6);
+        }
+
+        // Zones at exactly `depth` within [begin, end), merged by name
+        void CollectZones(const std::vector<ProfileZone>& zones, size_t begin, size_t end, uint16_t depth, std::vector<ZoneCandidate>& out)
+        {
+            out.clear();
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (zones[i].depth != depth) continue;
+
+                const float ms = ZoneMs(zones[i]);
+                auto it = std::find_if(out.begin(), out.end(),
+                    [&](const ZoneCandidate& c) { return c.name == zones[i].name; });
+                if (it == out.end())
+                {
+                    out.push_back({ zones[i].name, ms, i, ms });
+                }
+                else
+                {
+                    it->ms += ms;
+                    if (ms > it->largestMs)
+                    {
+                        it->largest = i;
+                        it->largestMs = ms;
+                    }
+                }
+            }
+        }
+
+        // End of the subtree rooted at index
+        size_t SubtreeEnd(const std::vector<ProfileZone>& zones, size_t index, size_t rangeEnd)
+        {
+            size_t end = index + 1;
+            while (end < rangeEnd && zones[end].depth > zones[index].depth) ++end;
+            return end;
+        }
+
+        // Calling thread's zones in a frame, sorted by thread so they are contiguous
+        bool FindThreadRange(const ProfileFrame& frame, uint16_t thread, size_t& begin, size_t& end)
+        {
+            begin = 0;
+            while (begin < frame.zones.size() && frame.zones[begin].thread != thread) ++begin;
+            end = begin;
+            while (end < frame.zones.size() && frame.zones[end].thread == thread) ++end;
+            return end > begin;
+        }
+    }
+
     Time::Time()
         : deltaTime(0.0f)
         , timeScale(1.0f)
@@ -13,7 +83,17 @@ namespace AronEngine
         , frameTime(0.0f)
         , frameCount(0)
         , fpsUpdateTime(0.0f)
+        , totalFrames(0)
+        , frameTimeHead(0)
+        , frameTimeCount(0)
+        , stats{}
+        , statsDirty(false)
+        , hitchThresholdMs(33.3f)
+        , hitchCount(0)
+        , lastProfileFrame(UINT64_MAX)
     {
+        memset(frameTimesMs, 0, sizeof(frameTimesMs));
+        memset(frameNumbers, 0, sizeof(frameNumbers));
     }
 
     void Time::Start()
@@ -28,11 +108,26 @@ namespace AronEngine
         currentFrameTime = std::chrono::steady_clock::now();
         
         auto duration = std::chrono::duration_cast<std::chrono::microseconds>(currentFrameTime - lastFrameTime);
-        deltaTime = duration.count() / 1000000.0f;
+        Advance(duration.count() / 1000000.0f);
+    }
+
+    void Time::UpdateWithDelta(float unscaledDeltaTime)
+    {
+        // Keep the clock in step so switching back to Update() doesn't produce one huge frame
+        currentFrameTime = std::chrono::steady_clock::now();
+        Advance(unscaledDeltaTime);
+    }
+
+    void Time::Advance(float unscaledDeltaTime)
+    {
+        deltaTime = unscaledDeltaTime;
         
         frameTime = deltaTime;
         totalTime += deltaTime;
         frameCount++;
+        totalFrames++;
+
+        RecordFrameTime(deltaTime * 1000.0f);
 
         fpsUpdateTime += deltaTime;
         if (fpsUpdateTime >= 1.0f)
@@ -45,6 +140,244 @@ namespace AronEngine
         lastFrameTime = currentFrameTime;
     }
 
+    void Time::RecordFrameTime(float frameMs)
+    {
+        frameTimesMs[frameTimeHead] = frameMs;
+        frameNumbers[frameTimeHead] = totalFrames;
+        frameTimeHead = (frameTimeHead + 1) % kFrameWindow;
+        frameTimeCount = (std::min)(frameTimeCount + 1, kFrameWindow);
+        statsDirty = true;
+
+        // The first delta includes startup work after Start(); don't report it
+        if (totalFrames > 1 && frameMs > hitchThresholdMs)
+        {
+            HitchRecord hitch = { totalFrames, frameMs, nullptr, 0.0f, 0.0f };
+            AttributeHitch(hitch);
+
+            ++hitchCount;
+            if (hitches.size() >= kMaxHitchRecords)
+            {
+                hitches.erase(hitches.begin());
+            }
+            hitches.push_back(hitch);
+
+            std::ostringstream message;
+            message << std::fixed << std::setprecision(2) << "Hitch: frame " << hitch.frame << " took " << frameMs << " ms";
+            if (hitch.culprit)
+            {
+                message << " (" << hitch.culprit << " " << hitch.culpritMs << " ms, typically " << hitch.culpritTypicalMs << " ms)";
+            }
+            DEBUG_LOG(message.str());
+        }
+        else
+        {
+            UpdateZoneBaselines();
+        }
+    }
+
+    void Time::AttributeHitch(HitchRecord& hitch)
+    {
+        // The profiler's last frame covers the interval this delta measured
+        const ProfileFrame* frame = Profiler::GetInstance().GetLastFrame();
+        if (!frame || frame->index == lastProfileFrame) return;
+        lastProfileFrame = frame->index;
+
+        size_t begin = 0;
+        size_t end = 0;
+        if (!FindThreadRange(*frame, Profiler::GetCurrentThreadIndex(), begin, end)) return;
+
+        auto baseline = [this](const char* name)
+        {
+            auto it = zoneBaselines.find(name);
+            return it != zoneBaselines.end() ? it->second : 0.0f;
+        };
+
+        std::vector<ZoneCandidate> candidates;
+        CollectZones(frame->zones, begin, end, frame->zones[begin].depth, candidates);
+
+        float tracked = 0.0f;
+        for (const auto& candidate : candidates) tracked += candidate.ms;
+        candidates.push_back({ kUntrackedZone, (std::max)(0.0f, hitch.frameMs - tracked), end, 0.0f });
+
+        auto pickWorst = [&](const std::vector<ZoneCandidate>& list, float& excess)
+        {
+            const ZoneCandidate* worst = nullptr;
+            excess = -FLT_MAX;
+            for (const auto& candidate : list)
+            {
+                const float over = candidate.ms - baseline(candidate.name);
+                if (over > excess)
+                {
+                    excess = over;
+                    worst = &candidate;
+                }
+            }
+            return worst;
+        };
+
+        float excess = 0.0f;
+        const ZoneCandidate* worst = pickWorst(candidates, excess);
+        ZoneCandidate culprit = *worst;
+
+        // Drill down while a single child accounts for most of the overrun
+        std::vector<ZoneCandidate> children;
+        while (culprit.name != kUntrackedZone)
+        {
+            const size_t subtreeEnd = SubtreeEnd(frame->zones, culprit.largest, end);
+            if (subtreeEnd == culprit.largest + 1) break;
+
+            CollectZones(frame->zones, culprit.largest + 1, subtreeEnd, frame->zones[culprit.largest].depth + 1, children);
+
+            float childExcess = 0.0f;
+            const ZoneCandidate* child = pickWorst(children, childExcess);
+            if (!child || childExcess < excess * kDrillDownShare) break;
+
+            culprit = *child;
+            excess = childExcess;
+        }
+
+        hitch.culprit = culprit.name;
+        hitch.culpritMs = culprit.ms;
+        hitch.culpritTypicalMs = baseline(culprit.name);
+    }
+
+    void Time::UpdateZoneBaselines()
+    {
+        const ProfileFrame* frame = Profiler::GetInstance().GetLastFrame();
+        if (!frame || frame->index == lastProfileFrame) return;
+        lastProfileFrame = frame->index;
+
+        size_t begin = 0;
+        size_t end = 0;
+        if (!FindThreadRange(*frame, Profiler::GetCurrentThreadIndex(), begin, end)) return;
+
+        auto blend = [this](const char* name, float ms)
+        {
+            auto result = zoneBaselines.emplace(name, ms);
+            if (!result.second)
+            {
+                result.first->second += (ms - result.first->second) * kBaselineBlend;
+            }
+        };
+
+        // Sum repeated zones first so a zone called N times is compared as one cost
+        std::vector<ZoneCandidate> level;
+        const uint16_t rootDepth = frame->zones[begin].depth;
+        float tracked = 0.0f;
+        for (uint16_t depth = rootDepth; ; ++depth)
+        {
+            CollectZones(frame->zones, begin, end, depth, level);
+            if (level.empty()) break;
+
+            for (const auto& zone : level)
+            {
+                blend(zone.name, zone.ms);
+                if (depth == rootDepth) tracked += zone.ms;
+            }
+        }
+        blend(kUntrackedZone, (std::max)(0.0f, frameTimesMs[(frameTimeHead + kFrameWindow - 1) % kFrameWindow] - tracked));
+    }
+
+    const FrameTimeStats& Time::GetFrameTimeStats() const
+    {
+        if (!statsDirty) return stats;
+        statsDirty = false;
+
+        stats = FrameTimeStats{};
+        stats.sampleCount = frameTimeCount;
+        if (frameTimeCount == 0) return stats;
+
+        std::vector<float> sorted(frameTimesMs, frameTimesMs + frameTimeCount);
+        std::sort(sorted.begin(), sorted.end());
+
+        double sum = 0.0;
+        for (float ms : sorted) sum += ms;
+
+        // Nearest-rank percentiles
+        auto percentile = [&sorted](float p)
+        {
+            const int rank = static_cast<int>(std::ceil(p * sorted.size()));
+            return sorted[(std::min)((std::max)(rank, 1), static_cast<int>(sorted.size())) - 1];
+        };
+
+        stats.average = static_cast<float>(sum / frameTimeCount);
+        stats.p50 = percentile(0.50f);
+        stats.p95 = percentile(0.95f);
+        stats.p99 = percentile(0.99f);
+        stats.max = sorted.back();
+        return stats;
+    }
+
+    void Time::GetFrameTimeHistory(std::vector<float>& outMs) const
+    {
+        outMs.resize(frameTimeCount);
+        const int start = (frameTimeHead - frameTimeCount + kFrameWindow) % kFrameWindow;
+        for (int i = 0; i < frameTimeCount; ++i)
+        {
+            outMs[i] = frameTimesMs[(start + i) % kFrameWindow];
+        }
+    }
+
+    void Time::BuildFrameTimeHistogram(int* bucketCounts, int bucketCount, float bucketWidthMs) const
+    {
+        if (!bucketCounts || bucketCount <= 0) return;
+
+        memset(bucketCounts, 0, sizeof(int) * bucketCount);
+        const float invWidth = 1.0f / (std::max)(bucketWidthMs, 0.001f);
+        for (int i = 0; i < frameTimeCount; ++i)
+        {
+            // Last bucket collects everything beyond the range
+            const int bucket = (std::min)(static_cast<int>(frameTimesMs[i] * invWidth), bucketCount - 1);
+            ++bucketCounts[bucket];
+        }
+    }
+
+    void Time::ClearFrameStats()
+    {
+        frameTimeHead = 0;
+        frameTimeCount = 0;
+        statsDirty = true;
+        hitchCount = 0;
+        hitches.clear();
+    }
+
+    bool Time::DumpFrameStatsCsv(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            DEBUG_LOG("Failed to open frame stats file: " + filePath);
+            return false;
+        }
+
+        out << std::fixed << std::setprecision(3);
+        out << "frame,frame_ms,hitch,culprit,culprit_ms,culprit_typical_ms\n";
+
+        const int start = (frameTimeHead - frameTimeCount + kFrameWindow) % kFrameWindow;
+        for (int i = 0; i < frameTimeCount; ++i)
+        {
+            const int slot = (start + i) % kFrameWindow;
+            const uint64_t frame = frameNumbers[slot];
+            out << frame << ',' << frameTimesMs[slot];
+
+            auto hitch = std::find_if(hitches.begin(), hitches.end(),
+                [frame](const HitchRecord& h) { return h.frame == frame; });
+            if (hitch != hitches.end())
+            {
+                out << ",1," << (hitch->culprit ? hitch->culprit : "") << ',' << hitch->culpritMs << ',' << hitch->culpritTypicalMs << '\n';
+            }
+            else
+            {
+                out << ",0,,,\n";
+            }
+        }
+
+        const FrameTimeStats& summary = GetFrameTimeStats();
+        DEBUG_LOG("Frame stats written: " + filePath + " (p50 " + std::to_string(summary.p50) + " ms, p99 "
+            + std::to_string(summary.p99) + " ms, " + std::to_string(hitchCount) + " hitches)");
+        return true;
+    }
+
     float Time::GetRealtimeSinceStartup()
     {
         auto now = std::chrono::steady_clock::now();
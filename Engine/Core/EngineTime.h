@@ -3,8 +3,32 @@
 
 namespace AronEngine
 {
+    // Percentiles over the rolling frame-time window, in milliseconds
+    struct FrameTimeStats
+    {
+        float average;
+        float p50;
+        float p95;
+        float p99;
+        float max;
+        int sampleCount;
+    };
+
+    // A frame over the hitch threshold, attributed to the profiler zone that overran its typical cost most
+    struct HitchRecord
+    {
+        uint64_t frame;
+        float frameMs;
+        const char* culprit;        // zone name, "Untracked" for time outside any zone, nullptr without profiler data
+        float culpritMs;
+        float culpritTypicalMs;
+    };
+
     class Time
     {
+    public:
+        static constexpr int kFrameWindow = 600;
+        static constexpr size_t kMaxHitchRecords = 64;
     private:
         std::chrono::steady_clock::time_point startTime;
         std::chrono::steady_clock::time_point lastFrameTime;
@@ -18,6 +42,23 @@ namespace AronEngine
         
         int frameCount;
         float fpsUpdateTime;
+        uint64_t totalFrames;
+
+        // Rolling window of unscaled frame times
+        float frameTimesMs[kFrameWindow];
+        uint64_t frameNumbers[kFrameWindow];
+        int frameTimeHead;
+        int frameTimeCount;
+        mutable FrameTimeStats stats;
+        mutable bool statsDirty;
+
+        float hitchThresholdMs;
+        uint64_t hitchCount;
+        std::vector<HitchRecord> hitches;   // most recent kMaxHitchRecords, oldest first
+
+        // Typical main-thread zone cost (ms, EMA over non-hitch frames) used for attribution
+        std::unordered_map<const char*, float> zoneBaselines;
+        uint64_t lastProfileFrame;
 
     public:
         Time();
@@ -25,6 +66,8 @@ namespace AronEngine
 
         void Start();
         void Update();
+        // Advances by a given delta instead of the clock (input replay, headless runs)
+        void UpdateWithDelta(float unscaledDeltaTime);
 
         float GetDeltaTime() const { return deltaTime * timeScale; }
         float GetUnscaledDeltaTime() const { return deltaTime; }
@@ -36,6 +79,28 @@ namespace AronEngine
         float GetFrameTime() const { return frameTime; }
         int GetFrameCount() const { return frameCount; }
 
+        uint64_t GetTotalFrames() const { return totalFrames; }
+
+        // Frame-time window and hitches
+        const FrameTimeStats& GetFrameTimeStats() const;
+        void GetFrameTimeHistory(std::vector<float>& outMs) const;    // oldest first
+        void BuildFrameTimeHistogram(int* bucketCounts, int bucketCount, float bucketWidthMs) const;
+
+        void SetHitchThreshold(float thresholdMs) { hitchThresholdMs = (std::max)(1.0f, thresholdMs); }
+        float GetHitchThreshold() const { return hitchThresholdMs; }
+        uint64_t GetHitchCount() const { return hitchCount; }
+        const std::vector<HitchRecord>& GetHitches() const { return hitches; }
+        void ClearFrameStats();
+
+        // frame, frame_ms, hitch, culprit, culprit_ms, culprit_typical_ms per frame in the window
+        bool DumpFrameStatsCsv(const std::string& filePath) const;
+
         static float GetRealtimeSinceStartup();
+
+    private:
+        void Advance(float unscaledDeltaTime);
+        void RecordFrameTime(float frameMs);
+        void AttributeHitch(HitchRecord& hitch);
+        void UpdateZoneBaselines();
     };
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "../Managers/SceneManager.h"
 #include "EngineApp.h"
 #include "Scene.h"
+#include <chrono>
+#include <random>
 
 namespace AronEngine
 {
@@ -11,27 +13,40 @@ namespace AronEngine
         : Object("GameObject")
         , parent(nullptr)
         , scene(nullptr)
+        , stableId(0)
         , layer(0)
         , tag("Untagged")
+        , pool(nullptr)
+        , pooledAvailable(false)
     {
         transform = std::make_unique<Transform>();
         transform->SetGameObject(this);
+        componentCache[std::type_index(typeid(Transform))] = transform.get();
     }
 
     GameObject::GameObject(const std::string& name)
         : Object(name)
         , parent(nullptr)
         , scene(nullptr)
+        , stableId(0)
         , layer(0)
         , tag("Untagged")
+        , pool(nullptr)
+        , pooledAvailable(false)
     {
         transform = std::make_unique<Transform>();
         transform->SetGameObject(this);
+        componentCache[std::type_index(typeid(Transform))] = transform.get();
     }
 
     GameObject::~GameObject()
     {
         OnDestroy();
+
+        for (auto& component : components)
+        {
+            RemoveComponentUpdates(component.get());
+        }
         
         for (auto& child : children)
         {
@@ -45,6 +60,123 @@ namespace AronEngine
         {
             parent->RemoveChild(this);
         }
+
+        if (scene && stableId != 0)
+        {
+            scene->UnregisterStableId(this);
+        }
+    }
+
+    void* GameObject::operator new(size_t size)
+    {
+        return ObjectPools::AllocateGameObject(size);
+    }
+
+    void GameObject::operator delete(void* block, size_t size)
+    {
+        ObjectPools::FreeGameObject(block, size);
+    }
+
+    void GameObject::SetScene(Scene* newScene)
+    {
+        if (scene == newScene)
+            return;
+
+        for (auto& component : components)
+        {
+            RemoveComponentUpdates(component.get());
+        }
+        if (scene && stableId != 0)
+        {
+            scene->UnregisterStableId(this);
+        }
+
+        scene = newScene;
+
+        if (scene && stableId != 0)
+        {
+            scene->RegisterStableId(this);
+        }
+        for (auto& component : components)
+        {
+            RefreshComponentUpdates(component.get());
+        }
+    }
+
+    void GameObject::SetStableId(uint64_t id)
+    {
+        if (stableId == id)
+            return;
+
+        if (scene && stableId != 0)
+        {
+            scene->UnregisterStableId(this);
+        }
+        stableId = id;
+        if (scene && stableId != 0)
+        {
+            scene->RegisterStableId(this);
+        }
+    }
+
+    uint64_t GameObject::GenerateStableId()
+    {
+        // Random rather than counted so IDs from separately built files don't collide
+        thread_local std::mt19937_64 generator(std::random_device{}()
+            ^ static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+
+        uint64_t id;
+        do
+        {
+            id = generator();
+        } while (id == 0);
+        return id;
+    }
+
+    void GameObject::AttachComponent(std::unique_ptr<Component> component, const ComponentTypeInfo* type)
+    {
+        Component* ptr = component.get();
+        ptr->SetGameObject(this);
+        ptr->typeInfo = type;
+
+        componentCache[std::type_index(*type->cppType)] = ptr;
+        components.push_back(std::move(component));
+
+        ptr->OnAwake();
+        // A staged scene is still on its loader thread; it enables everything on hand-off
+        if (IsActive() && !(scene && scene->IsStaged()))
+            ptr->OnEnable();
+        RefreshComponentUpdates(ptr);
+    }
+
+    void GameObject::OnActiveChanged()
+    {
+        for (auto& component : components)
+        {
+            RefreshComponentUpdates(component.get());
+        }
+
+        // Drawability depends on the object being active
+        if (transform)
+        {
+            transform->MarkSpritesStale();
+        }
+    }
+
+    void GameObject::RefreshComponentUpdates(Component* component)
+    {
+        if (scene)
+        {
+            scene->RefreshComponentUpdates(component);
+        }
+    }
+
+    void GameObject::RemoveComponentUpdates(Component* component)
+    {
+        if (scene)
+        {
+            scene->RemoveComponentUpdates(component);
+        }
     }
 
     void GameObject::SetParent(GameObject* newParent)
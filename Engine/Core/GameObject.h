@@ -1,6 +1,10 @@
 #pragma once
 #include "Object.h"
 #include "../Components/Transform.h"
+#include "../Components/ComponentRegistry.h"
+#include "MemoryTracker.h"
+#include "ObjectPools.h"
+#include "SystemAccess.h"
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -10,11 +14,16 @@ namespace AronEngine
 {
     class Component;
     class Scene;
+    class GameObjectPool;
+    class Prefab;
 
     class GameObject : public Object
     {
         DECLARE_OBJECT_TYPE(GameObject)
 
+        friend class GameObjectPool;
+        friend class Prefab;
+
     private:
         std::unique_ptr<Transform> transform;
         std::vector<std::unique_ptr<Component>> components;
@@ -24,14 +33,22 @@ namespace AronEngine
         std::vector<GameObject*> children;
         
         Scene* scene;
+        uint64_t stableId;              // 0 = none; see SetStableId
         int layer;
         std::string tag;
 
+        GameObjectPool* pool;           // set for instances created by a GameObjectPool
+        bool pooledAvailable;           // inactive and waiting in its pool
+
     public:
         GameObject();
         GameObject(const std::string& name);
         virtual ~GameObject();
 
+        // Pooled through ObjectPools
+        static void* operator new(size_t size);
+        static void operator delete(void* block, size_t size);
+
         Transform* GetTransform() const { return transform.get(); }
         
         GameObject* GetParent() const { return parent; }
@@ -42,7 +59,15 @@ namespace AronEngine
         void RemoveChild(GameObject* child);
         
         Scene* GetScene() const { return scene; }
-        void SetScene(Scene* scene) { this->scene = scene; }
+        void SetScene(Scene* scene);
+
+        GameObjectPool* GetPool() const { return pool; }
+
+        // Saved with the object, unlike the instance ID, so references can outlive a reload or
+        // cross into another file (Scene::FindGameObjectByStableId). Unique per world, 0 = none.
+        uint64_t GetStableId() const { return stableId; }
+        void SetStableId(uint64_t id);
+        static uint64_t GenerateStableId();
         
         int GetLayer() const { return layer; }
         void SetLayer(int layer) { this->layer = layer; }
@@ -54,24 +79,19 @@ namespace AronEngine
         T* AddComponent(Args&&... args)
         {
             static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
+            static_assert(alignof(T) <= PoolAllocator::kAlignment, "Component pools only guarantee 16-byte alignment");
+            MEMORY_TAG(Scene);
             
             auto component = std::make_unique<T>(std::forward<Args>(args)...);
             T* ptr = component.get();
-            ptr->SetGameObject(this);
-            
-            componentCache[std::type_index(typeid(T))] = ptr;
-            components.push_back(std::move(component));
-            
-            ptr->OnAwake();
-            if (IsActive())
-                ptr->OnEnable();
-            
+            AttachComponent(std::move(component), ComponentRegistry::Get<T>());
             return ptr;
         }
 
         template<typename T>
         T* GetComponent() const
         {
+            SYSTEM_ACCESS_READ(T);
             auto it = componentCache.find(std::type_index(typeid(T)));
             if (it != componentCache.end())
             {
@@ -102,6 +122,7 @@ namespace AronEngine
             {
                 Component* comp = it->second;
                 componentCache.erase(it);
+                RemoveComponentUpdates(comp);
                 
                 components.erase(
                     std::remove_if(components.begin(), components.end(),
@@ -113,6 +134,10 @@ namespace AronEngine
 
         const std::vector<std::unique_ptr<Component>>& GetAllComponents() const { return components; }
 
+        // Takes ownership and runs OnAwake/OnEnable, for components built from type info
+        // (prefab clones, scene files) rather than through AddComponent<T>
+        void AttachComponent(std::unique_ptr<Component> component, const ComponentTypeInfo* type);
+
         void Start();
         void Update(float deltaTime);
         void LateUpdate(float deltaTime);
@@ -126,5 +151,13 @@ namespace AronEngine
         static GameObject* Instantiate(GameObject* parent, const std::string& name = "GameObject");
         static void Destroy(GameObject* gameObject);
         static void DestroyImmediate(GameObject* gameObject);
+
+    protected:
+        void OnActiveChanged() override;
+
+    private:
+        // Keep the scene's per-type update lists in step with this object's components
+        void RefreshComponentUpdates(Component* component);
+        void RemoveComponentUpdates(Component* component);
     };
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "framework.h"
+#include "GameObjectPool.h"
+#include "GameObject.h"
+#include "Scene.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
+
+namespace AronEngine
+{
+    GameObjectPool::GameObjectPool(Scene* ownerScene, const std::string& poolName, BuildFunction buildFunction)
+        : scene(ownerScene)
+        , name(poolName)
+        , build(std::move(buildFunction))
+        , totalCount(0)
+        , peakActive(0)
+        , hasTemplateState(false)
+        , templateRotation(0.0f)
+        , templateLayer(0)
+    {
+    }
+
+    GameObjectPool::~GameObjectPool()
+    {
+        // Instances are owned by the scene; it destroys them before its pools
+    }
+
+    void GameObjectPool::Prewarm(int count)
+    {
+        MEMORY_TAG(Scene);
+
+        // Reserved up front so Release never reallocates
+        available.reserve(static_cast<size_t>((std::max)(count, totalCount)));
+        while (static_cast<int>(available.size()) < count)
+        {
+            GameObject* gameObject = CreateInstance();
+            if (!gameObject) return;
+
+            gameObject->OnDisable();
+            gameObject->SetActive(false);
+            gameObject->pooledAvailable = true;
+            available.push_back(gameObject);
+        }
+    }
+
+    GameObject* GameObjectPool::Acquire()
+    {
+        GameObject* gameObject = nullptr;
+        if (!available.empty())
+        {
+            gameObject = available.back();
+            available.pop_back();
+            gameObject->pooledAvailable = false;
+            gameObject->SetActive(true);
+            gameObject->OnEnable();
+        }
+        else
+        {
+            // Pool ran dry: grow by one, built active
+            gameObject = CreateInstance();
+            if (!gameObject) return nullptr;
+        }
+
+        peakActive = (std::max)(peakActive, GetActiveCount());
+        EngineStats::Add(StatCounter::PooledAcquires);
+        return gameObject;
+    }
+
+    GameObject* GameObjectPool::Acquire(const Vector2& position, GameObject* parent)
+    {
+        GameObject* gameObject = Acquire();
+        if (gameObject)
+        {
+            if (parent)
+            {
+                gameObject->SetParent(parent);
+            }
+            gameObject->GetTransform()->SetPosition(position);
+        }
+        return gameObject;
+    }
+
+    bool GameObjectPool::Release(GameObject* gameObject)
+    {
+        if (!gameObject || gameObject->pool != this || gameObject->pooledAvailable)
+        {
+            DEBUG_LOG("GameObjectPool '" + name + "': released an object that isn't an active instance");
+            return false;
+        }
+
+        gameObject->OnDisable();
+        for (const auto& component : gameObject->GetAllComponents())
+        {
+            component->OnReset();
+        }
+
+        if (gameObject->GetParent())
+        {
+            gameObject->SetParent(nullptr);
+        }
+
+        Transform* transform = gameObject->GetTransform();
+        transform->SetLocalPosition(templatePosition);
+        transform->SetLocalRotation(templateRotation);
+        transform->SetLocalScale(templateScale);
+        if (gameObject->GetTag() != templateTag) gameObject->SetTag(templateTag);
+        gameObject->SetLayer(templateLayer);
+
+        gameObject->SetActive(false);
+        gameObject->pooledAvailable = true;
+        available.push_back(gameObject);
+        return true;
+    }
+
+    GameObject* GameObjectPool::CreateInstance()
+    {
+        if (!scene) return nullptr;
+
+        GameObject* gameObject = scene->CreateGameObject(name);
+        gameObject->pool = this;
+        if (build)
+        {
+            build(gameObject);
+        }
+
+        if (!hasTemplateState)
+        {
+            Transform* transform = gameObject->GetTransform();
+            templatePosition = transform->GetLocalPosition();
+            templateRotation = transform->GetLocalRotation();
+            templateScale = transform->GetLocalScale();
+            templateTag = gameObject->GetTag();
+            templateLayer = gameObject->GetLayer();
+            hasTemplateState = true;
+        }
+
+        ++totalCount;
+        if (available.capacity() < static_cast<size_t>(totalCount))
+        {
+            available.reserve(static_cast<size_t>(totalCount) * 2);
+        }
+        return gameObject;
+    }
+}
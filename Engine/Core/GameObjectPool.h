@@ -0,0 +1,66 @@
+#pragma once
+#include "framework.h"
+#include "../Utils/Vector2.h"
+#include <functional>
+
+namespace AronEngine
+{
+    class GameObject;
+    class Scene;
+
+    // Recycles instances of one recurring object (projectiles, effects). The build function is
+    // the template: it gets a fresh GameObject and adds its components. Released instances are
+    // deactivated and reset through Component::OnReset instead of destroyed, so once the pool
+    // is warm, Acquire/Release allocate nothing.
+    // Pools belong to a scene (Scene::CreatePool) and their instances live in it like any other
+    // object; GameObject::Destroy on a pooled instance releases it back to its pool.
+    class GameObjectPool
+    {
+    public:
+        using BuildFunction = std::function<void(GameObject* gameObject)>;
+
+    private:
+        Scene* scene;
+        std::string name;
+        BuildFunction build;
+
+        std::vector<GameObject*> available;
+        int totalCount;
+        int peakActive;
+
+        // Restored on release; taken from the first instance right after building
+        bool hasTemplateState;
+        Vector2 templatePosition;
+        float templateRotation;
+        Vector2 templateScale;
+        std::string templateTag;
+        int templateLayer;
+
+    public:
+        GameObjectPool(Scene* ownerScene, const std::string& poolName, BuildFunction buildFunction);
+        ~GameObjectPool();
+
+        GameObjectPool(const GameObjectPool&) = delete;
+        GameObjectPool& operator=(const GameObjectPool&) = delete;
+
+        // Builds inactive instances until count are available
+        void Prewarm(int count);
+
+        // Activates an available instance, building one if the pool is empty
+        GameObject* Acquire();
+        GameObject* Acquire(const Vector2& position, GameObject* parent = nullptr);
+
+        // Deactivates and resets; false if the object isn't an active instance of this pool
+        bool Release(GameObject* gameObject);
+
+        const std::string& GetName() const { return name; }
+        Scene* GetScene() const { return scene; }
+        int GetTotalCount() const { return totalCount; }
+        int GetAvailableCount() const { return static_cast<int>(available.size()); }
+        int GetActiveCount() const { return totalCount - static_cast<int>(available.size()); }
+        int GetPeakActiveCount() const { return peakActive; }
+
+    private:
+        GameObject* CreateInstance();
+    };
+}
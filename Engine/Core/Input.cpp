@@ -1,15 +1,28 @@
 #include "framework.h"
 #include "Input.h"
+#include <emmintrin.h>
 
 namespace AronEngine
 {
+    namespace
+    {
+        constexpr uint64_t kMouseButtonMask = (1ull << VK_LBUTTON) | (1ull << VK_RBUTTON) | (1ull << VK_MBUTTON);
+        constexpr uint64_t kAllMouseButtonMask = kMouseButtonMask | (1ull << VK_XBUTTON1) | (1ull << VK_XBUTTON2);
+    }
+
     Input::Input()
         : hWnd(nullptr)
+        , pendingMousePosition(0, 0)
+        , pendingWheel(0.0f)
         , mousePosition(0, 0)
         , previousMousePosition(0, 0)
         , mouseDelta(0, 0)
         , mouseWheel(0.0f)
     {
+        memset(pendingPressCount, 0, sizeof(pendingPressCount));
+        memset(pressCount, 0, sizeof(pressCount));
+        pendingEvents.reserve(64);
+        frameEvents.reserve(64);
     }
 
     bool Input::Initialize(HWND hWnd)
@@ -20,12 +33,71 @@ namespace AronEngine
 
     void Input::Update()
     {
-        previousKeyState = currentKeyState;
-        previousMousePosition = mousePosition;
-        
+        // Latch everything ProcessMessage collected since the last frame
+        previousKeys = currentKeys;
+        currentKeys = pendingKeys;
+
+        const __m128i* cur = reinterpret_cast<const __m128i*>(currentKeys.words);
+        const __m128i* prev = reinterpret_cast<const __m128i*>(previousKeys.words);
+        const __m128i* pressed = reinterpret_cast<const __m128i*>(pendingPressed.words);
+        const __m128i* released = reinterpret_cast<const __m128i*>(pendingReleased.words);
+        __m128i* down = reinterpret_cast<__m128i*>(downKeys.words);
+        __m128i* up = reinterpret_cast<__m128i*>(upKeys.words);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            const __m128i c = _mm_load_si128(cur + i);
+            const __m128i p = _mm_load_si128(prev + i);
+            _mm_store_si128(down + i, _mm_or_si128(_mm_andnot_si128(p, c), _mm_load_si128(pressed + i)));
+            _mm_store_si128(up + i, _mm_or_si128(_mm_andnot_si128(c, p), _mm_load_si128(released + i)));
+        }
+
+        pendingPressed.Reset();
+        pendingReleased.Reset();
+        memcpy(pressCount, pendingPressCount, sizeof(pressCount));
+        memset(pendingPressCount, 0, sizeof(pendingPressCount));
+
+        frameEvents.swap(pendingEvents);
+        pendingEvents.clear();
+
         UpdateMousePosition();
+        previousMousePosition = mousePosition;
+        mousePosition = pendingMousePosition;
         mouseDelta = mousePosition - previousMousePosition;
-        mouseWheel = 0.0f;
+        mouseWheel = pendingWheel;
+        pendingWheel = 0.0f;
+    }
+
+    void Input::GetFrameState(InputFrameState& state) const
+    {
+        state.keys = currentKeys;
+        state.down = downKeys;
+        state.up = upKeys;
+        memcpy(state.pressCount, pressCount, sizeof(pressCount));
+        state.mousePosition = mousePosition;
+        state.mouseWheel = mouseWheel;
+    }
+
+    void Input::SetFrameState(const InputFrameState& state, const std::vector<InputEvent>& events)
+    {
+        previousKeys = currentKeys;
+        currentKeys = state.keys;
+        downKeys = state.down;
+        upKeys = state.up;
+        memcpy(pressCount, state.pressCount, sizeof(pressCount));
+        frameEvents = events;
+
+        previousMousePosition = mousePosition;
+        mousePosition = state.mousePosition;
+        mouseDelta = mousePosition - previousMousePosition;
+        mouseWheel = state.mouseWheel;
+
+        // Live edges and events must not leak into the frame after replay ends; held keys stay tracked
+        pendingPressed.Reset();
+        pendingReleased.Reset();
+        memset(pendingPressCount, 0, sizeof(pendingPressCount));
+        pendingEvents.clear();
+        pendingWheel = 0.0f;
     }
 
     void Input::ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
@@ -33,121 +105,128 @@ namespace AronEngine
         switch (message)
         {
         case WM_KEYDOWN:
-            currentKeyState[wParam] = true;
+            // Bit 30: key was already down (auto-repeat)
+            KeyEvent(static_cast<int>(wParam), true, (lParam & (1 << 30)) != 0);
             break;
             
         case WM_KEYUP:
-            currentKeyState[wParam] = false;
+            KeyEvent(static_cast<int>(wParam), false, false);
             break;
             
         case WM_LBUTTONDOWN:
-            currentKeyState[VK_LBUTTON] = true;
+            KeyEvent(VK_LBUTTON, true, false);
             break;
             
         case WM_LBUTTONUP:
-            currentKeyState[VK_LBUTTON] = false;
+            KeyEvent(VK_LBUTTON, false, false);
             break;
             
         case WM_RBUTTONDOWN:
-            currentKeyState[VK_RBUTTON] = true;
+            KeyEvent(VK_RBUTTON, true, false);
             break;
             
         case WM_RBUTTONUP:
-            currentKeyState[VK_RBUTTON] = false;
+            KeyEvent(VK_RBUTTON, false, false);
             break;
             
         case WM_MBUTTONDOWN:
-            currentKeyState[VK_MBUTTON] = true;
+            KeyEvent(VK_MBUTTON, true, false);
             break;
             
         case WM_MBUTTONUP:
-            currentKeyState[VK_MBUTTON] = false;
+            KeyEvent(VK_MBUTTON, false, false);
             break;
             
         case WM_MOUSEMOVE:
-            mousePosition.x = static_cast<float>(LOWORD(lParam));
-            mousePosition.y = static_cast<float>(HIWORD(lParam));
+            pendingMousePosition.x = static_cast<float>(static_cast<short>(LOWORD(lParam)));
+            pendingMousePosition.y = static_cast<float>(static_cast<short>(HIWORD(lParam)));
+            PushEvent(InputEventType::MouseMove, 0, pendingMousePosition.x, pendingMousePosition.y);
             break;
             
         case WM_MOUSEWHEEL:
-            mouseWheel = static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA;
+        {
+            const float notches = static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA;
+            pendingWheel += notches;
+            PushEvent(InputEventType::MouseWheel, 0, notches, 0.0f);
             break;
         }
+        }
     }
 
-    bool Input::GetKey(KeyCode key) const
+    void Input::KeyEvent(int key, bool down, bool repeat)
     {
-        auto it = currentKeyState.find(static_cast<int>(key));
-        return it != currentKeyState.end() && it->second;
-    }
+        key &= 0xFF;
 
-    bool Input::GetKeyDown(KeyCode key) const
-    {
-        int keyInt = static_cast<int>(key);
-        auto curr = currentKeyState.find(keyInt);
-        auto prev = previousKeyState.find(keyInt);
-        
-        bool currentPressed = (curr != currentKeyState.end() && curr->second);
-        bool previousPressed = (prev != previousKeyState.end() && prev->second);
-        
-        return currentPressed && !previousPressed;
-    }
+        if (down)
+        {
+            if (repeat || pendingKeys.Test(key))
+            {
+                return;
+            }
 
-    bool Input::GetKeyUp(KeyCode key) const
-    {
-        int keyInt = static_cast<int>(key);
-        auto curr = currentKeyState.find(keyInt);
-        auto prev = previousKeyState.find(keyInt);
-        
-        bool currentPressed = (curr != currentKeyState.end() && curr->second);
-        bool previousPressed = (prev != previousKeyState.end() && prev->second);
-        
-        return !currentPressed && previousPressed;
+            pendingKeys.Set(key);
+            pendingPressed.Set(key);
+            if (pendingPressCount[key] < 255)
+            {
+                ++pendingPressCount[key];
+            }
+            PushEvent(InputEventType::KeyDown, key, pendingMousePosition.x, pendingMousePosition.y);
+        }
+        else
+        {
+            pendingKeys.Clear(key);
+            pendingReleased.Set(key);
+            PushEvent(InputEventType::KeyUp, key, pendingMousePosition.x, pendingMousePosition.y);
+        }
     }
 
-    bool Input::GetMouseButton(int button) const
+    void Input::PushEvent(InputEventType type, int key, float x, float y)
     {
-        return GetKey(static_cast<KeyCode>(button));
-    }
+        // Consecutive mouse moves collapse into the latest one
+        if (type == InputEventType::MouseMove && !pendingEvents.empty() &&
+            pendingEvents.back().type == InputEventType::MouseMove)
+        {
+            InputEvent& last = pendingEvents.back();
+            last.timestamp = GetTimestamp();
+            last.x = x;
+            last.y = y;
+            return;
+        }
 
-    bool Input::GetMouseButtonDown(int button) const
-    {
-        return GetKeyDown(static_cast<KeyCode>(button));
+        InputEvent event;
+        event.timestamp = GetTimestamp();
+        event.type = type;
+        event.key = static_cast<uint8_t>(key);
+        event.x = x;
+        event.y = y;
+        pendingEvents.push_back(event);
     }
 
-    bool Input::GetMouseButtonUp(int button) const
+    bool Input::IsAnyKeyDown() const
     {
-        return GetKeyUp(static_cast<KeyCode>(button));
+        return ((downKeys.words[0] & ~kAllMouseButtonMask) | downKeys.words[1] | downKeys.words[2] | downKeys.words[3]) != 0;
     }
 
-    bool Input::IsAnyKeyDown() const
+    bool Input::IsAnyMouseButtonDown() const
     {
-        for (const auto& [key, pressed] : currentKeyState)
-        {
-            if (pressed && key != VK_LBUTTON && key != VK_RBUTTON && key != VK_MBUTTON)
-            {
-                auto prev = previousKeyState.find(key);
-                if (prev == previousKeyState.end() || !prev->second)
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
+        return (downKeys.words[0] & kMouseButtonMask) != 0;
     }
 
-    bool Input::IsAnyMouseButtonDown() const
+    int64_t Input::GetTimestamp()
     {
-        return GetMouseButtonDown(0) || GetMouseButtonDown(1) || GetMouseButtonDown(2);
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
     void Input::UpdateMousePosition()
     {
+        if (!hWnd) return;
+
         POINT pt;
         if (GetCursorPos(&pt) && ScreenToClient(hWnd, &pt))
         {
-            mousePosition.x = static_cast<float>(pt.x);
-            mousePosition.y = static_cast<float>(pt.y);
+            pendingMousePosition.x = static_cast<float>(pt.x);
+            pendingMousePosition.y = static_cast<float>(pt.y);
         }
     }
-}
\ No newline at end of file
+}
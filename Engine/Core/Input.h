@@ -46,12 +46,72 @@ namespace AronEngine
         F11 = VK_F11, F12 = VK_F12,
     };
 
+    // 256 virtual-key states, one bit each
+    struct alignas(16) KeyBits
+    {
+        uint64_t words[4] = { 0, 0, 0, 0 };
+
+        bool Test(int key) const { return ((words[(key & 0xFF) >> 6] >> (key & 63)) & 1) != 0; }
+        void Set(int key) { words[(key & 0xFF) >> 6] |= (1ull << (key & 63)); }
+        void Clear(int key) { words[(key & 0xFF) >> 6] &= ~(1ull << (key & 63)); }
+        void Reset() { words[0] = words[1] = words[2] = words[3] = 0; }
+        bool Any() const { return (words[0] | words[1] | words[2] | words[3]) != 0; }
+    };
+
+    enum class InputEventType : uint8_t
+    {
+        KeyDown,
+        KeyUp,
+        MouseMove,
+        MouseWheel
+    };
+
+    // One window message worth of input, in arrival order
+    struct InputEvent
+    {
+        int64_t timestamp;      // microseconds, steady clock
+        InputEventType type;
+        uint8_t key;            // virtual key for KeyDown/KeyUp (mouse buttons use VK_xBUTTON)
+        float x;                // MouseMove: position, MouseWheel: x = notches
+        float y;
+    };
+
+    // Latched per-frame state; what a recording stores and a replay restores
+    struct InputFrameState
+    {
+        KeyBits keys;
+        KeyBits down;
+        KeyBits up;
+        uint8_t pressCount[256];
+        Vector2 mousePosition;
+        float mouseWheel;
+    };
+
     class Input
     {
+    public:
+        static constexpr int kMaxKeys = 256;
+
     private:
         HWND hWnd;
-        std::unordered_map<int, bool> currentKeyState;
-        std::unordered_map<int, bool> previousKeyState;
+
+        // Written by ProcessMessage between frames, latched by Update
+        KeyBits pendingKeys;
+        KeyBits pendingPressed;     // went down at least once since the last latch
+        KeyBits pendingReleased;    // went up at least once since the last latch
+        uint8_t pendingPressCount[kMaxKeys];
+        std::vector<InputEvent> pendingEvents;
+        Vector2 pendingMousePosition;
+        float pendingWheel;
+
+        // Frame state seen by gameplay
+        KeyBits currentKeys;
+        KeyBits previousKeys;
+        KeyBits downKeys;           // pressed this frame, including taps released within the frame
+        KeyBits upKeys;             // released this frame, including taps
+        uint8_t pressCount[kMaxKeys];
+        std::vector<InputEvent> frameEvents;
+
         Vector2 mousePosition;
         Vector2 previousMousePosition;
         Vector2 mouseDelta;
@@ -65,13 +125,17 @@ namespace AronEngine
         void Update();
         void ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam);
 
-        bool GetKey(KeyCode key) const;
-        bool GetKeyDown(KeyCode key) const;
-        bool GetKeyUp(KeyCode key) const;
+        bool GetKey(KeyCode key) const { return currentKeys.Test(static_cast<int>(key)); }
+        bool GetKeyDown(KeyCode key) const { return downKeys.Test(static_cast<int>(key)); }
+        bool GetKeyUp(KeyCode key) const { return upKeys.Test(static_cast<int>(key)); }
+
+        // Number of presses this frame (can exceed 1 when a key is tapped faster than the frame rate)
+        int GetKeyPressCount(KeyCode key) const { return pressCount[static_cast<int>(key) & 0xFF]; }
 
-        bool GetMouseButton(int button) const;
-        bool GetMouseButtonDown(int button) const;
-        bool GetMouseButtonUp(int button) const;
+        // Buttons are virtual keys: VK_LBUTTON, VK_RBUTTON, VK_MBUTTON
+        bool GetMouseButton(int button) const { return currentKeys.Test(button); }
+        bool GetMouseButtonDown(int button) const { return downKeys.Test(button); }
+        bool GetMouseButtonUp(int button) const { return upKeys.Test(button); }
 
         Vector2 GetMousePosition() const { return mousePosition; }
         Vector2 GetMouseDelta() const { return mouseDelta; }
@@ -80,7 +144,22 @@ namespace AronEngine
         bool IsAnyKeyDown() const;
         bool IsAnyMouseButtonDown() const;
 
+        // Events latched for this frame, in the order the window received them
+        const std::vector<InputEvent>& GetEvents() const { return frameEvents; }
+
+        const KeyBits& GetKeyState() const { return currentKeys; }
+        const KeyBits& GetKeyDownState() const { return downKeys; }
+        const KeyBits& GetKeyUpState() const { return upKeys; }
+
+        // Replay support: SetFrameState stands in for Update() and discards live input gathered meanwhile
+        void GetFrameState(InputFrameState& state) const;
+        void SetFrameState(const InputFrameState& state, const std::vector<InputEvent>& events);
+
+        static int64_t GetTimestamp();
+
     private:
+        void KeyEvent(int key, bool down, bool repeat);
+        void PushEvent(InputEventType type, int key, float x, float y);
         void UpdateMousePosition();
     };
 }
\ No newline at end of file
@@ -0,0 +1,269 @@
+#include "framework.h"
+#include "InputRecording.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr char kMagic[4] = { 'A', 'I', 'R', 'P' };
+        constexpr uint32_t kVersion = 1;
+        constexpr std::streamoff kFrameCountOffset = 8;
+
+        // Sections present in a frame record
+        enum FrameFlags : uint8_t
+        {
+            FrameKeys = 1 << 0,         // held keys changed since the previous record
+            FrameDown = 1 << 1,
+            FrameUp = 1 << 2,
+            FrameMouse = 1 << 3,        // mouse position changed
+            FrameWheel = 1 << 4,
+            FramePressCounts = 1 << 5,
+            FrameEvents = 1 << 6
+        };
+
+        template<typename T>
+        void Write(std::ofstream& out, const T& value)
+        {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        void Read(std::ifstream& in, T& value)
+        {
+            in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        }
+
+        void ResetState(InputFrameState& state)
+        {
+            state.keys.Reset();
+            state.down.Reset();
+            state.up.Reset();
+            memset(state.pressCount, 0, sizeof(state.pressCount));
+            state.mousePosition = Vector2(0.0f, 0.0f);
+            state.mouseWheel = 0.0f;
+        }
+    }
+
+    InputRecorder::InputRecorder()
+        : frameCount(0)
+    {
+        ResetState(lastState);
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        Close();
+    }
+
+    bool InputRecorder::Open(const std::string& path)
+    {
+        Close();
+
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            DEBUG_LOG("Failed to open input recording: " + path);
+            return false;
+        }
+
+        filePath = path;
+        frameCount = 0;
+        ResetState(lastState);
+
+        file.write(kMagic, sizeof(kMagic));
+        Write(file, kVersion);
+        Write(file, frameCount);     // patched in Close()
+
+        DEBUG_LOG("Recording input to: " + path);
+        return true;
+    }
+
+    void InputRecorder::Close()
+    {
+        if (!file.is_open()) return;
+
+        file.seekp(kFrameCountOffset, std::ios::beg);
+        Write(file, frameCount);
+        file.close();
+
+        DEBUG_LOG("Input recording closed: " + filePath + " (" + std::to_string(frameCount) + " frames)");
+    }
+
+    void InputRecorder::WriteFrame(const Input& input, float unscaledDeltaTime)
+    {
+        if (!file.is_open()) return;
+
+        InputFrameState state;
+        input.GetFrameState(state);
+        const auto& events = input.GetEvents();
+
+        uint16_t pressEntries = 0;
+        for (int key = 0; key < Input::kMaxKeys; ++key)
+        {
+            pressEntries += state.pressCount[key] != 0 ? 1 : 0;
+        }
+
+        uint8_t flags = 0;
+        if (memcmp(state.keys.words, lastState.keys.words, sizeof(state.keys.words)) != 0) flags |= FrameKeys;
+        if (state.down.Any()) flags |= FrameDown;
+        if (state.up.Any()) flags |= FrameUp;
+        if (state.mousePosition != lastState.mousePosition) flags |= FrameMouse;
+        if (state.mouseWheel != 0.0f) flags |= FrameWheel;
+        if (pressEntries > 0) flags |= FramePressCounts;
+        if (!events.empty()) flags |= FrameEvents;
+
+        Write(file, unscaledDeltaTime);
+        Write(file, flags);
+
+        if (flags & FrameKeys) Write(file, state.keys.words);
+        if (flags & FrameDown) Write(file, state.down.words);
+        if (flags & FrameUp) Write(file, state.up.words);
+        if (flags & FrameMouse)
+        {
+            Write(file, state.mousePosition.x);
+            Write(file, state.mousePosition.y);
+        }
+        if (flags & FrameWheel) Write(file, state.mouseWheel);
+
+        if (flags & FramePressCounts)
+        {
+            Write(file, pressEntries);
+            for (int key = 0; key < Input::kMaxKeys; ++key)
+            {
+                if (state.pressCount[key] == 0) continue;
+                Write(file, static_cast<uint8_t>(key));
+                Write(file, state.pressCount[key]);
+            }
+        }
+
+        if (flags & FrameEvents)
+        {
+            const uint16_t eventCount = static_cast<uint16_t>((std::min)(events.size(), static_cast<size_t>(0xFFFF)));
+            Write(file, eventCount);
+            for (uint16_t i = 0; i < eventCount; ++i)
+            {
+                const InputEvent& event = events[i];
+                Write(file, event.timestamp);
+                Write(file, event.type);
+                Write(file, event.key);
+                Write(file, event.x);
+                Write(file, event.y);
+            }
+        }
+
+        lastState = state;
+        ++frameCount;
+    }
+
+    InputReplay::InputReplay()
+        : frameCount(0)
+        , framesRead(0)
+    {
+        ResetState(state);
+    }
+
+    bool InputReplay::Open(const std::string& path)
+    {
+        Close();
+
+        file.open(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            DEBUG_LOG("Failed to open input replay: " + path);
+            return false;
+        }
+
+        char magic[4];
+        uint32_t version = 0;
+        file.read(magic, sizeof(magic));
+        Read(file, version);
+        Read(file, frameCount);
+
+        if (!file || memcmp(magic, kMagic, sizeof(kMagic)) != 0 || version != kVersion)
+        {
+            DEBUG_LOG("Invalid input replay file: " + path);
+            file.close();
+            return false;
+        }
+
+        filePath = path;
+        framesRead = 0;
+        ResetState(state);
+        events.clear();
+
+        DEBUG_LOG("Replaying input from: " + path + " (" + std::to_string(frameCount) + " frames)");
+        return true;
+    }
+
+    void InputReplay::Close()
+    {
+        if (file.is_open())
+        {
+            file.close();
+        }
+    }
+
+    bool InputReplay::ReadFrame(Input& input, float& unscaledDeltaTime)
+    {
+        if (!file.is_open()) return false;
+
+        // A frame count of 0 means the recorder never closed cleanly; read until EOF
+        if (frameCount != 0 && framesRead >= frameCount) return false;
+
+        uint8_t flags = 0;
+        Read(file, unscaledDeltaTime);
+        Read(file, flags);
+        if (!file) return false;
+
+        if (flags & FrameKeys) Read(file, state.keys.words);
+
+        state.down.Reset();
+        state.up.Reset();
+        if (flags & FrameDown) Read(file, state.down.words);
+        if (flags & FrameUp) Read(file, state.up.words);
+
+        if (flags & FrameMouse)
+        {
+            Read(file, state.mousePosition.x);
+            Read(file, state.mousePosition.y);
+        }
+
+        state.mouseWheel = 0.0f;
+        if (flags & FrameWheel) Read(file, state.mouseWheel);
+
+        memset(state.pressCount, 0, sizeof(state.pressCount));
+        if (flags & FramePressCounts)
+        {
+            uint16_t pressEntries = 0;
+            Read(file, pressEntries);
+            for (uint16_t i = 0; i < pressEntries; ++i)
+            {
+                uint8_t key = 0;
+                Read(file, key);
+                Read(file, state.pressCount[key]);
+            }
+        }
+
+        events.clear();
+        if (flags & FrameEvents)
+        {
+            uint16_t eventCount = 0;
+            Read(file, eventCount);
+            events.resize(eventCount);
+            for (auto& event : events)
+            {
+                Read(file, event.timestamp);
+                Read(file, event.type);
+                Read(file, event.key);
+                Read(file, event.x);
+                Read(file, event.y);
+            }
+        }
+
+        if (!file) return false;
+
+        input.SetFrameState(state, events);
+        ++framesRead;
+        return true;
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "framework.h"
+#include "Input.h"
+
+namespace AronEngine
+{
+    // Binary input stream: "AIRP", version, frame count, then one delta-coded record per frame
+    // (unscaled delta time + latched Input state + that frame's events).
+    class InputRecorder
+    {
+    private:
+        std::ofstream file;
+        std::string filePath;
+        uint32_t frameCount;
+
+        InputFrameState lastState;
+
+    public:
+        InputRecorder();
+        ~InputRecorder();
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return file.is_open(); }
+
+        // Call after Input/Time have been updated for the frame
+        void WriteFrame(const Input& input, float unscaledDeltaTime);
+
+        uint32_t GetFrameCount() const { return frameCount; }
+        const std::string& GetFilePath() const { return filePath; }
+    };
+
+    // Feeds a recorded stream back into Input and Time, one frame per call
+    class InputReplay
+    {
+    private:
+        std::ifstream file;
+        std::string filePath;
+        uint32_t frameCount;
+        uint32_t framesRead;
+
+        InputFrameState state;
+        std::vector<InputEvent> events;
+
+    public:
+        InputReplay();
+        ~InputReplay() = default;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return file.is_open(); }
+
+        // Applies the next frame to input and returns its delta time; false at end of stream
+        bool ReadFrame(Input& input, float& unscaledDeltaTime);
+
+        uint32_t GetFrameCount() const { return frameCount; }
+        uint32_t GetFramesRead() const { return framesRead; }
+        const std::string& GetFilePath() const { return filePath; }
+    };
+}
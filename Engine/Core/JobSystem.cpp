@@ -0,0 +1,348 @@
+#include "framework.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        thread_local int t_workerIndex = -1;
+
+        // Idle workers re-check the queues this many times before sleeping
+        constexpr int kSpinCount = 64;
+
+        uint32_t NextRandom(uint32_t& state)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+    }
+
+    JobSystem::JobSystem()
+        : running(false)
+        , sleepingWorkers(0)
+        , queuedJobs(0)
+        , externalPoolIndex(0)
+        , externalCount(0)
+        , deferredCount(0)
+    {
+    }
+
+    JobSystem::~JobSystem()
+    {
+        Shutdown();
+    }
+
+    bool JobSystem::Initialize(int workerThreads)
+    {
+        if (IsInitialized())
+        {
+            DEBUG_LOG("JobSystem already initialized");
+            return false;
+        }
+
+        if (workerThreads < 0)
+        {
+            const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            workerThreads = hardwareThreads > 1 ? static_cast<int>(hardwareThreads) - 1 : 0;
+        }
+
+        MEMORY_TAG(General);
+
+        externalPool.resize(kJobPoolSize);
+        externalPoolIndex = 0;
+
+        workers.reserve(static_cast<size_t>(workerThreads) + 1);
+        for (int i = 0; i <= workerThreads; ++i)
+        {
+            auto worker = std::make_unique<Worker>();
+            worker->random = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+            workers.push_back(std::move(worker));
+        }
+
+        t_workerIndex = 0;
+        running.store(true, std::memory_order_release);
+
+        for (uint32_t i = 1; i < workers.size(); ++i)
+        {
+            workers[i]->thread = std::thread(&JobSystem::WorkerMain, this, i);
+        }
+
+        DEBUG_LOG("JobSystem initialized with " + std::to_string(workers.size()) + " threads");
+        return true;
+    }
+
+    void JobSystem::Shutdown()
+    {
+        if (!IsInitialized()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            running.store(false, std::memory_order_release);
+        }
+        wakeCondition.notify_all();
+
+        for (auto& worker : workers)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        workers.clear();
+        externalQueue.clear();
+        externalCount.store(0, std::memory_order_relaxed);
+        deferredJobs.clear();
+        deferredCount.store(0, std::memory_order_relaxed);
+        queuedJobs.store(0, std::memory_order_relaxed);
+        t_workerIndex = -1;
+    }
+
+    int JobSystem::GetCurrentWorkerIndex()
+    {
+        return t_workerIndex;
+    }
+
+    uint32_t JobSystem::GetBatchSize(uint32_t count, uint32_t minBatchSize) const
+    {
+        // About four chunks per thread leaves room for stealing to even out uneven chunks
+        const uint32_t chunks = GetThreadCount() * 4;
+        const uint32_t batchSize = (count + chunks - 1) / chunks;
+        return (std::max)((std::max)(batchSize, minBatchSize), 1u);
+    }
+
+    void JobSystem::Run(JobFunction function, void* data, uint32_t begin, uint32_t end,
+        JobCounter* counter, const JobCounter* dependency)
+    {
+        if (!IsInitialized())
+        {
+            // Single-threaded fallback: everything submitted earlier has already finished
+            function(data, begin, end);
+            EngineStats::Add(StatCounter::JobsExecuted);
+            return;
+        }
+
+        if (counter)
+        {
+            counter->value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Job* job = AllocateJob();
+        job->function = function;
+        job->data = data;
+        job->begin = begin;
+        job->end = end;
+        job->counter = counter;
+        job->dependency = dependency;
+
+        if (dependency && !dependency->IsDone())
+        {
+            // Re-checked under the lock (seq_cst, paired with Execute) so a finishing job can't miss it
+            std::lock_guard<std::mutex> lock(deferredMutex);
+            if (dependency->value.load(std::memory_order_seq_cst) != 0)
+            {
+                deferredJobs.push_back(job);
+                deferredCount.fetch_add(1, std::memory_order_seq_cst);
+                return;
+            }
+        }
+
+        Enqueue(job);
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        const int index = t_workerIndex;
+        while (!counter.IsDone())
+        {
+            if (Job* job = FindJob(index))
+            {
+                Execute(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool JobSystem::ExecuteOne()
+    {
+        if (!IsInitialized()) return false;
+
+        Job* job = FindJob(t_workerIndex);
+        if (!job) return false;
+
+        Execute(job);
+        return true;
+    }
+
+    Job* JobSystem::AllocateJob()
+    {
+        const int index = t_workerIndex;
+        if (index >= 0 && index < static_cast<int>(workers.size()))
+        {
+            Worker& worker = *workers[index];
+            return &worker.jobPool[worker.jobPoolIndex++ & (kJobPoolSize - 1)];
+        }
+
+        std::lock_guard<std::mutex> lock(externalMutex);
+        return &externalPool[externalPoolIndex++ & (kJobPoolSize - 1)];
+    }
+
+    void JobSystem::Enqueue(Job* job)
+    {
+        const int index = t_workerIndex;
+        const bool pushed = index >= 0 && index < static_cast<int>(workers.size()) && workers[index]->queue.Push(job);
+        if (!pushed)
+        {
+            std::lock_guard<std::mutex> lock(externalMutex);
+            externalQueue.push_back(job);
+            externalCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // seq_cst pairs with the sleeper's increment of sleepingWorkers, so one of us sees the other
+        queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            wakeCondition.notify_one();
+        }
+    }
+
+    Job* JobSystem::FindJob(int index)
+    {
+        Job* job = nullptr;
+        const int workerCount = static_cast<int>(workers.size());
+
+        if (index >= 0 && index < workerCount)
+        {
+            job = workers[index]->queue.Pop();
+        }
+
+        if (!job && externalCount.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(externalMutex);
+            if (!externalQueue.empty())
+            {
+                job = externalQueue.front();
+                externalQueue.pop_front();
+                externalCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (!job && workerCount > 1)
+        {
+            // Start at a random victim so thieves don't all pile onto worker 0
+            uint32_t seed = index >= 0 ? workers[index]->random : 0x2545F491u;
+            const int start = static_cast<int>(NextRandom(seed) % static_cast<uint32_t>(workerCount));
+            if (index >= 0) workers[index]->random = seed;
+
+            for (int i = 0; i < workerCount && !job; ++i)
+            {
+                const int victim = (start + i) % workerCount;
+                if (victim == index) continue;
+
+                job = workers[victim]->queue.Steal();
+                if (job && index >= 0)
+                {
+                    workers[index]->stolen.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (job)
+        {
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    void JobSystem::Execute(Job* job)
+    {
+        {
+            PROFILE_SCOPE("Job");
+            job->function(job->data, job->begin, job->end);
+        }
+
+        const int index = t_workerIndex;
+        if (index >= 0 && index < static_cast<int>(workers.size()))
+        {
+            workers[index]->executed.fetch_add(1, std::memory_order_relaxed);
+        }
+        EngineStats::Add(StatCounter::JobsExecuted);
+
+        // Copy out first: once the counter hits zero a waiter may free it
+        JobCounter* counter = job->counter;
+        if (counter && counter->value.fetch_sub(1, std::memory_order_seq_cst) == 1)
+        {
+            if (deferredCount.load(std::memory_order_seq_cst) > 0)
+            {
+                ReleaseDeferred();
+            }
+        }
+    }
+
+    void JobSystem::ReleaseDeferred()
+    {
+        std::vector<Job*> ready;
+        {
+            std::lock_guard<std::mutex> lock(deferredMutex);
+            for (size_t i = 0; i < deferredJobs.size();)
+            {
+                if (deferredJobs[i]->dependency->IsDone())
+                {
+                    ready.push_back(deferredJobs[i]);
+                    deferredJobs[i] = deferredJobs.back();
+                    deferredJobs.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            deferredCount.fetch_sub(static_cast<int32_t>(ready.size()), std::memory_order_seq_cst);
+        }
+
+        for (Job* job : ready)
+        {
+            Enqueue(job);
+        }
+    }
+
+    void JobSystem::WorkerMain(uint32_t index)
+    {
+        t_workerIndex = static_cast<int>(index);
+        Profiler::SetThreadName("Job Worker " + std::to_string(index));
+
+        while (running.load(std::memory_order_acquire))
+        {
+            Job* job = FindJob(static_cast<int>(index));
+            for (int spin = 0; !job && spin < kSpinCount; ++spin)
+            {
+                std::this_thread::yield();
+                job = FindJob(static_cast<int>(index));
+            }
+
+            if (job)
+            {
+                Execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            wakeCondition.wait(lock, [this]()
+            {
+                return !running.load(std::memory_order_acquire) || queuedJobs.load(std::memory_order_seq_cst) > 0;
+            });
+            sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "framework.h"
+#include "Singleton.h"
+#include "../Utils/WorkStealingQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace AronEngine
+{
+    // Processes indices [begin, end) of whatever data points at
+    using JobFunction = void(*)(void* data, uint32_t begin, uint32_t end);
+
+    // Number of unfinished jobs submitted against it. Must outlive those jobs, and any job
+    // that names it as a dependency must have started before it is destroyed.
+    struct JobCounter
+    {
+        std::atomic<int32_t> value{ 0 };
+
+        bool IsDone() const { return value.load(std::memory_order_acquire) == 0; }
+    };
+
+    struct Job
+    {
+        JobFunction function;
+        void* data;
+        uint32_t begin;
+        uint32_t end;
+        JobCounter* counter;
+        const JobCounter* dependency;   // held back until this reaches zero
+    };
+
+    // Work-stealing job system. The thread that calls Initialize is worker 0 and only runs jobs
+    // while it waits; the other workers are background threads that sleep when there's no work.
+    class JobSystem : public Singleton<JobSystem>
+    {
+        friend class Singleton<JobSystem>;
+
+    public:
+        static constexpr size_t kQueueCapacity = 4096;
+        // Jobs are carved from a per-thread ring; a thread may have at most this many in flight
+        static constexpr size_t kJobPoolSize = 4096;
+
+    private:
+        struct Worker
+        {
+            WorkStealingQueue<Job, kQueueCapacity> queue;
+            Job jobPool[kJobPoolSize];
+            uint32_t jobPoolIndex = 0;
+            uint32_t random = 0;
+            std::thread thread;
+
+            std::atomic<uint64_t> executed{ 0 };
+            std::atomic<uint64_t> stolen{ 0 };
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;       // [0] is the initializing thread
+        std::atomic<bool> running;
+
+        // Sleeping workers wait for queuedJobs to become non-zero
+        std::mutex sleepMutex;
+        std::condition_variable wakeCondition;
+        std::atomic<int32_t> sleepingWorkers;
+        std::atomic<int32_t> queuedJobs;
+
+        // Jobs submitted from threads that aren't workers (or whose queue is full)
+        std::mutex externalMutex;
+        std::deque<Job*> externalQueue;
+        std::vector<Job> externalPool;
+        uint32_t externalPoolIndex;
+        std::atomic<int32_t> externalCount;
+
+        // Jobs waiting on a dependency counter
+        std::mutex deferredMutex;
+        std::vector<Job*> deferredJobs;
+        std::atomic<int32_t> deferredCount;
+
+    protected:
+        JobSystem();
+        virtual ~JobSystem();
+
+    public:
+        // workerThreads < 0 picks hardware_concurrency - 1; 0 runs everything on the calling thread
+        bool Initialize(int workerThreads = -1);
+        // No jobs may be in flight
+        void Shutdown();
+        bool IsInitialized() const { return !workers.empty(); }
+
+        // Including the initializing thread
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>((std::max)(workers.size(), static_cast<size_t>(1))); }
+
+        // Runs function(data, begin, end) on some worker. Without Initialize it runs inline.
+        void Run(JobFunction function, void* data, uint32_t begin, uint32_t end,
+            JobCounter* counter, const JobCounter* dependency = nullptr);
+
+        // Executes other jobs until counter reaches zero
+        void Wait(JobCounter& counter);
+        // Runs one queued job on the calling thread; false if there was none
+        bool ExecuteOne();
+
+        // body(begin, end) over [0, count) in chunks of at least minBatchSize; returns when all ran
+        template<typename F>
+        void ParallelFor(uint32_t count, uint32_t minBatchSize, const F& body);
+
+        // Chunk size ParallelFor would use
+        uint32_t GetBatchSize(uint32_t count, uint32_t minBatchSize) const;
+
+        // -1 on threads that aren't workers
+        static int GetCurrentWorkerIndex();
+
+        uint64_t GetExecutedCount(uint32_t worker) const { return worker < workers.size() ? workers[worker]->executed.load(std::memory_order_relaxed) : 0; }
+        uint64_t GetStolenCount(uint32_t worker) const { return worker < workers.size() ? workers[worker]->stolen.load(std::memory_order_relaxed) : 0; }
+
+    private:
+        void WorkerMain(uint32_t index);
+        Job* AllocateJob();
+        void Enqueue(Job* job);
+        Job* FindJob(int index);
+        void Execute(Job* job);
+        void ReleaseDeferred();
+    };
+
+    template<typename F>
+    void JobSystem::ParallelFor(uint32_t count, uint32_t minBatchSize, const F& body)
+    {
+        if (count == 0) return;
+
+        const uint32_t batchSize = GetBatchSize(count, minBatchSize);
+        if (batchSize >= count || workers.size() <= 1)
+        {
+            body(0, count);
+            return;
+        }
+
+        const JobFunction trampoline = [](void* data, uint32_t begin, uint32_t end)
+        {
+            (*static_cast<const F*>(data))(begin, end);
+        };
+        void* data = const_cast<void*>(static_cast<const void*>(&body));
+
+        JobCounter counter;
+        for (uint32_t begin = 0; begin < count; begin += batchSize)
+        {
+            Run(trampoline, data, begin, (std::min)(begin + batchSize, count), &counter);
+        }
+        Wait(counter);
+    }
+}
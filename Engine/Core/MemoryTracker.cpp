@@ -0,0 +1,358 @@
+#include "framework.h"
+#include "MemoryTracker.h"
+#include "ObjectPools.h"
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+namespace AronEngine
+{
+    namespace
+    {
+        // Constant-initialized so operator new can use them before any static constructor runs
+        struct TagCounters
+        {
+            std::atomic<int64_t> bytes;
+            std::atomic<int64_t> allocations;
+            std::atomic<int64_t> peakBytes;
+            std::atomic<int64_t> totalAllocations;
+            std::atomic<int64_t> payloadBytes;
+        };
+
+        TagCounters g_tagCounters[kMemoryTagCount];
+        std::atomic<int64_t> g_frameAllocatedBytes;
+
+        thread_local MemoryTag t_tagStack[MemoryTracker::kMaxTagDepth];
+        thread_local int t_tagDepth = 0;
+
+        const char* const kTagNames[kMemoryTagCount] = {
+            "General",
+            "Scene",
+            "Rendering",
+            "Textures",
+            "Audio",
+            "Editor",
+            "Profiling"
+        };
+
+        void UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+        {
+            int64_t current = peak.load(std::memory_order_relaxed);
+            while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::string FormatBytes(int64_t bytes)
+        {
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(2);
+            const double absolute = static_cast<double>(bytes < 0 ? -bytes : bytes);
+            if (absolute >= 1024.0 * 1024.0) stream << bytes / (1024.0 * 1024.0) << " MB";
+            else if (absolute >= 1024.0) stream << bytes / 1024.0 << " KB";
+            else stream << bytes << " B";
+            return stream.str();
+        }
+    }
+
+    MemoryTracker::MemoryTracker()
+        : historyHead(0)
+        , frameIndex(0)
+    {
+        memset(budgets, 0, sizeof(budgets));
+        history.reserve(kHistoryFrames);
+    }
+
+    void MemoryTracker::PushTag(MemoryTag tag)
+    {
+        // Deeper nesting keeps charging the innermost tag that fit
+        if (t_tagDepth < kMaxTagDepth)
+        {
+            t_tagStack[t_tagDepth] = tag;
+        }
+        ++t_tagDepth;
+    }
+
+    void MemoryTracker::PopTag()
+    {
+        if (t_tagDepth > 0)
+        {
+            --t_tagDepth;
+        }
+    }
+
+    MemoryTag MemoryTracker::GetCurrentTag()
+    {
+        if (t_tagDepth == 0) return MemoryTag::General;
+        return t_tagStack[(std::min)(t_tagDepth, kMaxTagDepth) - 1];
+    }
+
+    void MemoryTracker::OnAllocate(MemoryTag tag, size_t size)
+    {
+        TagCounters& counters = g_tagCounters[static_cast<size_t>(tag)];
+        const int64_t bytes = counters.bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        UpdatePeak(counters.peakBytes, bytes);
+        g_frameAllocatedBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::OnFree(MemoryTag tag, size_t size)
+    {
+        TagCounters& counters = g_tagCounters[static_cast<size_t>(tag)];
+        counters.bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+        counters.allocations.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::TrackPayload(MemoryTag tag, int64_t bytes)
+    {
+        g_tagCounters[static_cast<size_t>(tag)].payloadBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    MemoryTagStats MemoryTracker::GetTagStats(MemoryTag tag)
+    {
+        const TagCounters& counters = g_tagCounters[static_cast<size_t>(tag)];
+        MemoryTagStats stats;
+        stats.bytes = counters.bytes.load(std::memory_order_relaxed);
+        stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+        stats.payloadBytes = counters.payloadBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    MemoryTagStats MemoryTracker::GetTotalStats()
+    {
+        MemoryTagStats total;
+        for (size_t i = 0; i < kMemoryTagCount; ++i)
+        {
+            const MemoryTagStats stats = GetTagStats(static_cast<MemoryTag>(i));
+            total.bytes += stats.bytes;
+            total.allocations += stats.allocations;
+            total.peakBytes += stats.peakBytes;     // sum of per-tag peaks, an upper bound
+            total.totalAllocations += stats.totalAllocations;
+            total.payloadBytes += stats.payloadBytes;
+        }
+        return total;
+    }
+
+    int64_t MemoryTracker::ConsumeFrameAllocatedBytes()
+    {
+        return g_frameAllocatedBytes.exchange(0, std::memory_order_relaxed);
+    }
+
+    const char* MemoryTracker::GetTagName(MemoryTag tag)
+    {
+        const size_t index = static_cast<size_t>(tag);
+        return index < kMemoryTagCount ? kTagNames[index] : "Unknown";
+    }
+
+    void MemoryTracker::EndFrame()
+    {
+        HistorySample sample;
+        for (size_t i = 0; i < kMemoryTagCount; ++i)
+        {
+            sample.bytes[i] = g_tagCounters[i].bytes.load(std::memory_order_relaxed);
+            sample.payloadBytes[i] = g_tagCounters[i].payloadBytes.load(std::memory_order_relaxed);
+        }
+
+        if (history.size() < kHistoryFrames)
+        {
+            history.push_back(sample);
+        }
+        else
+        {
+            history[historyHead] = sample;
+            historyHead = (historyHead + 1) % kHistoryFrames;
+        }
+        ++frameIndex;
+    }
+
+    void MemoryTracker::GetTagHistory(MemoryTag tag, std::vector<float>& outKilobytes) const
+    {
+        outKilobytes.clear();
+        outKilobytes.reserve(history.size());
+
+        const size_t index = static_cast<size_t>(tag);
+        const size_t start = history.size() < kHistoryFrames ? 0 : historyHead;
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            const HistorySample& sample = history[(start + i) % history.size()];
+            outKilobytes.push_back(static_cast<float>(sample.bytes[index] + sample.payloadBytes[index]) / 1024.0f);
+        }
+    }
+
+    bool MemoryTracker::IsOverBudget(MemoryTag tag) const
+    {
+        const int64_t budget = GetBudget(tag);
+        if (budget <= 0) return false;
+
+        const MemoryTagStats stats = GetTagStats(tag);
+        return stats.bytes + stats.payloadBytes > budget;
+    }
+
+    void MemoryTracker::Mark(const std::string& label)
+    {
+        MemoryMark mark;
+        mark.label = label;
+        mark.frame = frameIndex;
+        for (size_t i = 0; i < kMemoryTagCount; ++i)
+        {
+            mark.tags[i] = GetTagStats(static_cast<MemoryTag>(i));
+        }
+        marks.push_back(std::move(mark));
+
+        DEBUG_LOG("Memory mark: " + label + " (" + FormatBytes(GetTotalStats().bytes) + " live)");
+    }
+
+    bool MemoryTracker::WriteReport(const std::string& filePath) const
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            DEBUG_LOG("Failed to open memory report: " + filePath);
+            return false;
+        }
+
+        out << "AronEngine memory report, frame " << frameIndex
+            << (IsHookEnabled() ? "" : " (heap hooks disabled)") << "\n\n";
+
+        out << std::left << std::setw(12) << "Tag" << std::right
+            << std::setw(14) << "Heap" << std::setw(10) << "Blocks"
+            << std::setw(14) << "Peak" << std::setw(12) << "Allocs"
+            << std::setw(14) << "Payload" << std::setw(14) << "Budget" << "\n";
+
+        for (size_t i = 0; i < kMemoryTagCount; ++i)
+        {
+            const MemoryTag tag = static_cast<MemoryTag>(i);
+            const MemoryTagStats stats = GetTagStats(tag);
+            out << std::left << std::setw(12) << kTagNames[i] << std::right
+                << std::setw(14) << FormatBytes(stats.bytes) << std::setw(10) << stats.allocations
+                << std::setw(14) << FormatBytes(stats.peakBytes) << std::setw(12) << stats.totalAllocations
+                << std::setw(14) << FormatBytes(stats.payloadBytes)
+                << std::setw(14) << (budgets[i] > 0 ? FormatBytes(budgets[i]) : std::string("-"))
+                << (IsOverBudget(tag) ? "  OVER BUDGET" : "") << "\n";
+        }
+
+        // Pool chunks are already counted in the tags above; this is how full they are
+        out << "\n" << std::left << std::setw(40) << "Object pool" << std::right
+            << std::setw(8) << "Block" << std::setw(10) << "Used" << std::setw(10) << "Capacity"
+            << std::setw(10) << "Peak" << std::setw(12) << "Allocs" << "\n";
+        for (const PoolStats& pool : ObjectPools::GetStats())
+        {
+            out << std::left << std::setw(40) << pool.name << std::right
+                << std::setw(8) << pool.blockSize << std::setw(10) << pool.used << std::setw(10) << pool.capacity
+                << std::setw(10) << pool.peak << std::setw(12) << pool.totalAllocations << "\n";
+        }
+
+        // A tag that doesn't return to its earlier level after an unload is the leak to chase
+        if (!marks.empty())
+        {
+            out << "\nMarks (heap + payload, delta from previous mark)\n";
+            for (size_t m = 0; m < marks.size(); ++m)
+            {
+                const MemoryMark& mark = marks[m];
+                out << "\n[" << mark.frame << "] " << mark.label << "\n";
+                for (size_t i = 0; i < kMemoryTagCount; ++i)
+                {
+                    const int64_t total = mark.tags[i].bytes + mark.tags[i].payloadBytes;
+                    out << "  " << std::left << std::setw(12) << kTagNames[i] << std::right
+                        << std::setw(14) << FormatBytes(total)
+                        << std::setw(10) << mark.tags[i].allocations;
+                    if (m > 0)
+                    {
+                        const MemoryTagStats& previous = marks[m - 1].tags[i];
+                        const int64_t delta = total - (previous.bytes + previous.payloadBytes);
+                        out << std::setw(14) << (delta > 0 ? "+" : "") + FormatBytes(delta)
+                            << std::setw(10) << std::showpos << (mark.tags[i].allocations - previous.allocations) << std::noshowpos;
+                    }
+                    out << "\n";
+                }
+            }
+        }
+
+        DEBUG_LOG("Memory report written: " + filePath);
+        return true;
+    }
+}
+
+#if AE_MEMORY_TRACKING
+
+// Global operator new/delete replacement. Every block carries a 16-byte header just before the
+// returned pointer recording its size, tag and offset from the malloc'd address, so frees are
+// charged to the tag that allocated them regardless of the current tag stack.
+namespace
+{
+    struct AllocationHeader
+    {
+        size_t size;
+        uint32_t offset;
+        uint8_t tag;
+        uint8_t padding[3];
+    };
+
+    constexpr size_t kHeaderSize = sizeof(AllocationHeader);
+    static_assert(kHeaderSize == 16, "AllocationHeader must keep 16-byte alignment");
+
+    void* TrackedAllocate(size_t size, size_t alignment) noexcept
+    {
+        const size_t extra = alignment > kHeaderSize ? alignment : 0;
+        char* raw = static_cast<char*>(std::malloc(size + kHeaderSize + extra));
+        if (!raw) return nullptr;
+
+        uintptr_t user = reinterpret_cast<uintptr_t>(raw) + kHeaderSize;
+        if (extra)
+        {
+            user = (user + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        }
+
+        const AronEngine::MemoryTag tag = AronEngine::MemoryTracker::GetCurrentTag();
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user - kHeaderSize);
+        header->size = size;
+        header->offset = static_cast<uint32_t>(user - reinterpret_cast<uintptr_t>(raw));
+        header->tag = static_cast<uint8_t>(tag);
+
+        AronEngine::MemoryTracker::OnAllocate(tag, size);
+        return reinterpret_cast<void*>(user);
+    }
+
+    void TrackedFree(void* pointer) noexcept
+    {
+        if (!pointer) return;
+
+        const AllocationHeader* header = reinterpret_cast<const AllocationHeader*>(static_cast<char*>(pointer) - kHeaderSize);
+        AronEngine::MemoryTracker::OnFree(static_cast<AronEngine::MemoryTag>(header->tag), header->size);
+        std::free(static_cast<char*>(pointer) - header->offset);
+    }
+
+    void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+    {
+        void* pointer = TrackedAllocate(size, alignment);
+        if (!pointer) throw std::bad_alloc();
+        return pointer;
+    }
+}
+
+void* operator new(size_t size) { return TrackedAllocateOrThrow(size, kHeaderSize); }
+void* operator new[](size_t size) { return TrackedAllocateOrThrow(size, kHeaderSize); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, kHeaderSize); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, kHeaderSize); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+#include "framework.h"
+#include "Singleton.h"
+#include <atomic>
+
+// Set AE_MEMORY_TRACKING to 0 to drop the global operator new/delete replacement.
+// Tags, payload accounting and the report keep working; heap columns stay at zero.
+#ifndef AE_MEMORY_TRACKING
+#define AE_MEMORY_TRACKING 1
+#endif
+
+#define AE_MEMORY_CONCAT_INNER(a, b) a##b
+#define AE_MEMORY_CONCAT(a, b) AE_MEMORY_CONCAT_INNER(a, b)
+
+// Heap allocations made on this thread until the end of the scope are charged to tag
+#define MEMORY_TAG(tag) ::AronEngine::MemoryTagScope AE_MEMORY_CONCAT(memoryTag_, __LINE__)(::AronEngine::MemoryTag::tag)
+
+namespace AronEngine
+{
+    enum class MemoryTag : uint8_t
+    {
+        General,        // anything allocated outside a MEMORY_TAG scope
+        Scene,
+        Rendering,
+        Textures,
+        Audio,
+        Editor,
+        Profiling,
+
+        Count
+    };
+
+    constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+    struct MemoryTagStats
+    {
+        int64_t bytes = 0;              // live heap bytes
+        int64_t allocations = 0;        // live heap blocks
+        int64_t peakBytes = 0;
+        int64_t totalAllocations = 0;   // since startup
+        int64_t payloadBytes = 0;       // explicitly tracked resource data (GPU bitmaps, decoded PCM)
+    };
+
+    // Snapshot taken with Mark(), e.g. around level loads, to diff for leaks
+    struct MemoryMark
+    {
+        std::string label;
+        uint64_t frame;
+        MemoryTagStats tags[kMemoryTagCount];
+    };
+
+    class MemoryTracker : public Singleton<MemoryTracker>
+    {
+        friend class Singleton<MemoryTracker>;
+
+    public:
+        static constexpr size_t kHistoryFrames = 600;
+        static constexpr int kMaxTagDepth = 32;
+
+    private:
+        struct HistorySample
+        {
+            int64_t bytes[kMemoryTagCount];
+            int64_t payloadBytes[kMemoryTagCount];
+        };
+
+        std::vector<HistorySample> history;     // ring of kHistoryFrames
+        size_t historyHead;
+        uint64_t frameIndex;
+
+        std::vector<MemoryMark> marks;
+        int64_t budgets[kMemoryTagCount];       // 0 = no budget
+
+    protected:
+        MemoryTracker();
+        virtual ~MemoryTracker() = default;
+
+    public:
+        // Hot path, safe from operator new: touches only constant-initialized globals and TLS
+        static void PushTag(MemoryTag tag);
+        static void PopTag();
+        static MemoryTag GetCurrentTag();
+        static void OnAllocate(MemoryTag tag, size_t size);
+        static void OnFree(MemoryTag tag, size_t size);
+
+        static void TrackPayload(MemoryTag tag, int64_t bytes);
+        static void UntrackPayload(MemoryTag tag, int64_t bytes) { TrackPayload(tag, -bytes); }
+
+        static MemoryTagStats GetTagStats(MemoryTag tag);
+        static MemoryTagStats GetTotalStats();
+        // Heap bytes allocated since the last call (all tags), for per-frame counters
+        static int64_t ConsumeFrameAllocatedBytes();
+        static const char* GetTagName(MemoryTag tag);
+        static bool IsHookEnabled() { return AE_MEMORY_TRACKING != 0; }
+
+        // Main thread, once per frame
+        void EndFrame();
+
+        // Oldest first, in KB: heap bytes plus payload
+        void GetTagHistory(MemoryTag tag, std::vector<float>& outKilobytes) const;
+
+        void SetBudget(MemoryTag tag, int64_t bytes) { budgets[static_cast<size_t>(tag)] = bytes; }
+        int64_t GetBudget(MemoryTag tag) const { return budgets[static_cast<size_t>(tag)]; }
+        bool IsOverBudget(MemoryTag tag) const;
+
+        void Mark(const std::string& label);
+        const std::vector<MemoryMark>& GetMarks() const { return marks; }
+        void ClearMarks() { marks.clear(); }
+
+        // Per-tag table, budgets, and every mark with its delta from the previous one
+        bool WriteReport(const std::string& filePath) const;
+    };
+
+    class MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(MemoryTag tag) { MemoryTracker::PushTag(tag); }
+        ~MemoryTagScope() { MemoryTracker::PopTag(); }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+    };
+}
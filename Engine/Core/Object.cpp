@@ -3,7 +3,7 @@
 
 namespace AronEngine
 {
-    uint32_t Object::s_nextInstanceID = 1;
+    std::atomic<uint32_t> Object::s_nextInstanceID{ 1 };
 
     Object::Object()
         : instanceID(s_nextInstanceID++)
@@ -18,4 +18,11 @@ namespace AronEngine
         , isActive(true)
     {
     }
+
+    Object::Object(const Object& other)
+        : instanceID(s_nextInstanceID++)
+        , name(other.name)
+        , isActive(other.isActive)
+    {
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "framework.h"
+#include <atomic>
 #include <typeindex>
 
 namespace AronEngine
@@ -7,7 +8,7 @@ namespace AronEngine
     class Object
     {
     private:
-        static uint32_t s_nextInstanceID;
+        static std::atomic<uint32_t> s_nextInstanceID;    // scenes can be built on a loader thread
         uint32_t instanceID;
         std::string name;
         bool isActive;
@@ -15,6 +16,9 @@ namespace AronEngine
     public:
         Object();
         Object(const std::string& name);
+        // Copies get their own instance ID; used to clone prefab prototypes
+        Object(const Object& other);
+        Object& operator=(const Object&) = delete;
         virtual ~Object() = default;
 
         uint32_t GetInstanceID() const { return instanceID; }
@@ -22,7 +26,12 @@ namespace AronEngine
         void SetName(const std::string& name) { this->name = name; }
 
         bool IsActive() const { return isActive; }
-        void SetActive(bool active) { isActive = active; }
+        void SetActive(bool active)
+        {
+            if (isActive == active) return;
+            isActive = active;
+            OnActiveChanged();
+        }
 
         virtual std::type_index GetType() const = 0;
         
@@ -47,6 +56,9 @@ namespace AronEngine
                 return static_cast<const T*>(this);
             return nullptr;
         }
+
+    protected:
+        virtual void OnActiveChanged() {}
     };
 
     #define DECLARE_OBJECT_TYPE(className) \
@@ -0,0 +1,176 @@
+#include "framework.h"
+#include "ObjectPools.h"
+#include "GameObject.h"
+#include "../Components/ComponentRegistry.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        // About 64 KB per chunk, never fewer than 16 blocks
+        size_t BlocksPerChunk(size_t blockSize)
+        {
+            return (std::max)(static_cast<size_t>(16), static_cast<size_t>(64 * 1024) / blockSize);
+        }
+
+        size_t GetSizeClass(size_t size)
+        {
+            return (size + ObjectPools::kSizeClassGranularity - 1) / ObjectPools::kSizeClassGranularity - 1;
+        }
+
+        struct PoolState
+        {
+            std::atomic<bool> enabled{ true };
+            PoolAllocator gameObjects{ "GameObject", sizeof(GameObject), BlocksPerChunk(sizeof(GameObject)) };
+            PoolAllocator transforms{ "Transform", sizeof(Transform), BlocksPerChunk(sizeof(Transform)) };
+
+            std::mutex componentMutex;
+            std::atomic<PoolAllocator*> components[ObjectPools::kSizeClassCount] = {};
+
+            PoolAllocator* GetComponentPool(size_t sizeClass, bool create)
+            {
+                PoolAllocator* pool = components[sizeClass].load(std::memory_order_acquire);
+                if (pool || !create) return pool;
+
+                std::lock_guard<std::mutex> lock(componentMutex);
+                pool = components[sizeClass].load(std::memory_order_relaxed);
+                if (!pool)
+                {
+                    const size_t blockSize = (sizeClass + 1) * ObjectPools::kSizeClassGranularity;
+                    pool = new PoolAllocator("Components " + std::to_string(blockSize) + " B", blockSize, BlocksPerChunk(blockSize));
+                    components[sizeClass].store(pool, std::memory_order_release);
+                }
+                return pool;
+            }
+        };
+
+        // Never destroyed: objects in static storage may still be released during shutdown
+        PoolState& GetState()
+        {
+            static PoolState* state = new PoolState();
+            return *state;
+        }
+    }
+
+    void ObjectPools::SetEnabled(bool enable)
+    {
+        GetState().enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    bool ObjectPools::IsEnabled()
+    {
+        return GetState().enabled.load(std::memory_order_relaxed);
+    }
+
+    void* ObjectPools::AllocateGameObject(size_t size)
+    {
+        PoolState& state = GetState();
+        // Classes derived from GameObject inherit the operator but not the size
+        if (size != sizeof(GameObject) || !state.enabled.load(std::memory_order_relaxed))
+        {
+            return ::operator new(size);
+        }
+        return state.gameObjects.Allocate();
+    }
+
+    void ObjectPools::FreeGameObject(void* block, size_t size)
+    {
+        if (!block) return;
+
+        PoolState& state = GetState();
+        if (state.gameObjects.Owns(block))
+        {
+            state.gameObjects.Free(block);
+        }
+        else
+        {
+            ::operator delete(block);
+        }
+    }
+
+    void* ObjectPools::AllocateTransform(size_t size)
+    {
+        PoolState& state = GetState();
+        if (size != sizeof(Transform) || !state.enabled.load(std::memory_order_relaxed))
+        {
+            return AllocateComponent(size);
+        }
+        return state.transforms.Allocate();
+    }
+
+    void ObjectPools::FreeTransform(void* block, size_t size)
+    {
+        if (!block) return;
+
+        PoolState& state = GetState();
+        if (state.transforms.Owns(block))
+        {
+            state.transforms.Free(block);
+        }
+        else
+        {
+            FreeComponent(block, size);
+        }
+    }
+
+    void* ObjectPools::AllocateComponent(size_t size)
+    {
+        PoolState& state = GetState();
+        if (size == 0 || size > kMaxPooledComponentSize || !state.enabled.load(std::memory_order_relaxed))
+        {
+            return ::operator new(size);
+        }
+        return state.GetComponentPool(GetSizeClass(size), true)->Allocate();
+    }
+
+    void ObjectPools::FreeComponent(void* block, size_t size)
+    {
+        if (!block) return;
+
+        PoolState& state = GetState();
+        PoolAllocator* pool = size > 0 && size <= kMaxPooledComponentSize ? state.GetComponentPool(GetSizeClass(size), false) : nullptr;
+        if (pool && pool->Owns(block))
+        {
+            pool->Free(block);
+        }
+        else
+        {
+            ::operator delete(block);
+        }
+    }
+
+    std::vector<PoolStats> ObjectPools::GetStats()
+    {
+        PoolState& state = GetState();
+
+        std::vector<PoolStats> stats;
+        stats.push_back(state.gameObjects.GetStats());
+        stats.push_back(state.transforms.GetStats());
+
+        std::string typeNames[kSizeClassCount];
+        const uint32_t typeCount = ComponentRegistry::GetTypeCount();
+        for (uint32_t i = 0; i < typeCount; ++i)
+        {
+            const ComponentTypeInfo* type = ComponentRegistry::GetType(i);
+            if (!type || type->size == 0 || type->size > kMaxPooledComponentSize) continue;
+
+            std::string& names = typeNames[GetSizeClass(type->size)];
+            if (!names.empty()) names += ", ";
+            names += type->name;
+        }
+
+        for (size_t i = 0; i < kSizeClassCount; ++i)
+        {
+            PoolAllocator* pool = state.GetComponentPool(i, false);
+            if (!pool) continue;
+
+            PoolStats poolStats = pool->GetStats();
+            if (!typeNames[i].empty())
+            {
+                poolStats.name += " (" + typeNames[i] + ")";
+            }
+            stats.push_back(poolStats);
+        }
+        return stats;
+    }
+}
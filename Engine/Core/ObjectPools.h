@@ -0,0 +1,34 @@
+#pragma once
+#include "framework.h"
+#include "../Utils/PoolAllocator.h"
+
+namespace AronEngine
+{
+    // Backing store for GameObject, Transform and Component allocations (their class operator
+    // new/delete route here). GameObjects and Transforms get their own pools; other components
+    // share pools per 16-byte size class up to kMaxPooledComponentSize, larger ones use the heap.
+    // Memory tracking sees the pool chunks, not the individual objects.
+    class ObjectPools
+    {
+    public:
+        static constexpr size_t kSizeClassGranularity = PoolAllocator::kAlignment;
+        static constexpr size_t kMaxPooledComponentSize = 1024;
+        static constexpr size_t kSizeClassCount = kMaxPooledComponentSize / kSizeClassGranularity;
+
+        // Off: new objects come from the heap (for comparison). Safe to flip at any time; each
+        // block goes back to wherever it came from.
+        static void SetEnabled(bool enable);
+        static bool IsEnabled();
+
+        static void* AllocateGameObject(size_t size);
+        static void FreeGameObject(void* block, size_t size);
+        static void* AllocateTransform(size_t size);
+        static void FreeTransform(void* block, size_t size);
+        static void* AllocateComponent(size_t size);
+        static void FreeComponent(void* block, size_t size);
+
+        // GameObject, Transform, then every component size class in use. Component pools are
+        // named after the registered types that fall in their size class.
+        static std::vector<PoolStats> GetStats();
+    };
+}
@@ -0,0 +1,231 @@
+#include "framework.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include <iomanip>
+
+namespace AronEngine
+{
+    namespace
+    {
+        thread_local Profiler::ThreadBuffer* t_threadBuffer = nullptr;
+
+        // Zone names are identifiers or __FUNCTION__, but keep the JSON valid regardless
+        void WriteJsonString(std::ofstream& out, const char* text)
+        {
+            out << '"';
+            for (const char* c = text; *c; ++c)
+            {
+                if (*c == '"' || *c == '\\') out << '\\';
+                if (static_cast<unsigned char>(*c) >= 0x20) out << *c;
+            }
+            out << '"';
+        }
+    }
+
+    Profiler::Profiler()
+        : enabled(true)
+        , paused(false)
+        , historyHead(0)
+        , frameIndex(0)
+        , frameStart(Now())
+    {
+        MEMORY_TAG(Profiling);
+        history.reserve(kHistoryFrames);
+    }
+
+    int64_t Profiler::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+    {
+        if (!t_threadBuffer)
+        {
+            MEMORY_TAG(Profiling);
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->index = static_cast<uint16_t>(threads.size());
+            buffer->name = "Thread " + std::to_string(threads.size());
+            buffer->openZones.reserve(64);
+            t_threadBuffer = buffer.get();
+            threads.push_back(std::move(buffer));
+        }
+        return *t_threadBuffer;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        Profiler& profiler = GetInstance();
+        ThreadBuffer& buffer = profiler.GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(profiler.threadsMutex);
+        buffer.name = name;
+    }
+
+    uint16_t Profiler::GetCurrentThreadIndex()
+    {
+        return GetInstance().GetThreadBuffer().index;
+    }
+
+    void Profiler::Record(const char* name, bool isEnd)
+    {
+        // A full ring drops the event; DrainThread tolerates unmatched begins and ends
+        GetThreadBuffer().events.Push(Event{ name, Now(), isEnd ? 1u : 0u });
+    }
+
+    void Profiler::DrainThread(ThreadBuffer& buffer, ProfileFrame& frame)
+    {
+        Event event;
+        while (buffer.events.Pop(event))
+        {
+            if (!event.isEnd)
+            {
+                buffer.openZones.push_back(event);
+                continue;
+            }
+
+            // Match the innermost open zone of the same name; anything above it lost its end
+            for (size_t i = buffer.openZones.size(); i-- > 0;)
+            {
+                if (buffer.openZones[i].name != event.name) continue;
+
+                ProfileZone zone;
+                zone.name = event.name;
+                zone.start = buffer.openZones[i].timestamp;
+                zone.end = event.timestamp;
+                zone.depth = static_cast<uint16_t>(i);
+                zone.thread = buffer.index;
+                frame.zones.push_back(zone);
+
+                buffer.openZones.resize(i);
+                break;
+            }
+        }
+    }
+
+    void Profiler::EndFrame()
+    {
+        const int64_t now = Now();
+
+        pending.index = frameIndex++;
+        pending.start = frameStart;
+        pending.end = now;
+        pending.zones.clear();
+        frameStart = now;
+
+        {
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            for (auto& buffer : threads)
+            {
+                DrainThread(*buffer, pending);
+            }
+        }
+
+        // Zones close innermost-first; reorder so each thread reads as a pre-order tree
+        std::sort(pending.zones.begin(), pending.zones.end(),
+            [](const ProfileZone& a, const ProfileZone& b)
+            {
+                if (a.thread != b.thread) return a.thread < b.thread;
+                if (a.start != b.start) return a.start < b.start;
+                return a.depth < b.depth;
+            });
+
+        if (paused) return;
+
+        if (history.size() < kHistoryFrames)
+        {
+            history.push_back(ProfileFrame());
+            std::swap(history.back(), pending);
+            historyHead = 0;
+        }
+        else
+        {
+            // Swap so the evicted frame's zone storage is reused next time
+            std::swap(history[historyHead], pending);
+            historyHead = (historyHead + 1) % kHistoryFrames;
+        }
+    }
+
+    std::vector<const ProfileFrame*> Profiler::GetHistory() const
+    {
+        std::vector<const ProfileFrame*> frames;
+        frames.reserve(history.size());
+
+        const size_t start = history.size() < kHistoryFrames ? 0 : historyHead;
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            frames.push_back(&history[(start + i) % history.size()]);
+        }
+        return frames;
+    }
+
+    const ProfileFrame* Profiler::GetLastFrame() const
+    {
+        if (history.empty()) return nullptr;
+        if (history.size() < kHistoryFrames) return &history.back();
+        return &history[(historyHead + kHistoryFrames - 1) % kHistoryFrames];
+    }
+
+    std::vector<std::string> Profiler::GetThreadNames()
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        std::vector<std::string> names;
+        names.reserve(threads.size());
+        for (const auto& buffer : threads)
+        {
+            names.push_back(buffer->name);
+        }
+        return names;
+    }
+
+    bool Profiler::ExportChromeTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath, std::ios::trunc);
+        if (!out.is_open())
+        {
+            DEBUG_LOG("Failed to open profiler trace: " + filePath);
+            return false;
+        }
+
+        const auto frames = GetHistory();
+        const auto threadNames = GetThreadNames();
+        const int64_t origin = frames.empty() ? 0 : frames.front()->start;
+
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+        bool first = true;
+        for (size_t t = 0; t < threadNames.size(); ++t)
+        {
+            out << (first ? "" : ",\n");
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t << ",\"args\":{\"name\":";
+            WriteJsonString(out, threadNames[t].c_str());
+            out << "}}";
+            first = false;
+        }
+
+        size_t zoneCount = 0;
+        for (const ProfileFrame* frame : frames)
+        {
+            for (const ProfileZone& zone : frame->zones)
+            {
+                out << (first ? "" : ",\n");
+                out << "{\"name\":";
+                WriteJsonString(out, zone.name);
+                out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread
+                    << ",\"ts\":" << (zone.start - origin) * 1e-3
+                    << ",\"dur\":" << (zone.end - zone.start) * 1e-3
+                    << ",\"args\":{\"frame\":" << frame->index << "}}";
+                first = false;
+                ++zoneCount;
+            }
+        }
+
+        out << "\n]}\n";
+
+        DEBUG_LOG("Profiler trace written: " + filePath + " (" + std::to_string(frames.size()) + " frames, "
+            + std::to_string(zoneCount) + " zones)");
+        return true;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include "framework.h"
+#include "Singleton.h"
+#include "../Utils/SpscRing.h"
+#include <atomic>
+#include <mutex>
+
+// Set AE_PROFILE to 0 to compile all zones out
+#ifndef AE_PROFILE
+#define AE_PROFILE 1
+#endif
+
+#define AE_PROFILE_CONCAT_INNER(a, b) a##b
+#define AE_PROFILE_CONCAT(a, b) AE_PROFILE_CONCAT_INNER(a, b)
+
+#if AE_PROFILE
+// name must outlive the profiler (string literal)
+#define PROFILE_SCOPE(name) ::AronEngine::ProfileScope AE_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#endif
+
+namespace AronEngine
+{
+    // Closed zone, depth relative to the thread's outermost zone
+    struct ProfileZone
+    {
+        const char* name;
+        int64_t start;          // nanoseconds, steady clock
+        int64_t end;
+        uint16_t depth;
+        uint16_t thread;        // index into Profiler::GetThreadNames()
+    };
+
+    struct ProfileFrame
+    {
+        uint64_t index;
+        int64_t start;
+        int64_t end;
+        std::vector<ProfileZone> zones;     // sorted by thread, then start time
+
+        double GetDurationMs() const { return (end - start) * 1e-6; }
+    };
+
+    class Profiler : public Singleton<Profiler>
+    {
+        friend class Singleton<Profiler>;
+
+    public:
+        static constexpr size_t kEventCapacity = 1 << 16;   // per thread, drained every frame
+        static constexpr size_t kHistoryFrames = 300;
+
+        struct Event
+        {
+            const char* name;
+            int64_t timestamp;
+            uint32_t isEnd;
+        };
+
+        // One per thread that ever records a zone; owned by the profiler so it outlives the thread
+        struct ThreadBuffer
+        {
+            SpscRing<Event, kEventCapacity> events;
+            std::string name;
+            uint16_t index = 0;
+
+            // Consumer side: begin events still waiting for their end
+            std::vector<Event> openZones;
+        };
+
+    private:
+        std::atomic<bool> enabled;
+        bool paused;
+
+        std::mutex threadsMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> threads;
+
+        std::vector<ProfileFrame> history;      // ring of kHistoryFrames
+        size_t historyHead;
+        ProfileFrame pending;                   // frame being built; swapped into history
+        uint64_t frameIndex;
+        int64_t frameStart;
+
+    protected:
+        Profiler();
+        virtual ~Profiler() = default;
+
+    public:
+        // Main thread, once per frame: drains every thread's events into the frame history
+        void EndFrame();
+
+        void SetEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+        bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+        // Paused keeps draining buffers but stops replacing history, so a hitch can be inspected
+        void SetPaused(bool pause) { paused = pause; }
+        bool IsPaused() const { return paused; }
+
+        static void SetThreadName(const std::string& name);
+        // ProfileZone::thread value for zones recorded by the calling thread
+        static uint16_t GetCurrentThreadIndex();
+
+        // Oldest first; up to kHistoryFrames
+        std::vector<const ProfileFrame*> GetHistory() const;
+        const ProfileFrame* GetLastFrame() const;
+        std::vector<std::string> GetThreadNames();
+
+        // Chrome trace event JSON (chrome://tracing, Perfetto) of the frames in history
+        bool ExportChromeTrace(const std::string& filePath);
+
+        static int64_t Now();
+
+        // Called by ProfileScope
+        void Record(const char* name, bool isEnd);
+
+    private:
+        ThreadBuffer& GetThreadBuffer();
+        void DrainThread(ThreadBuffer& buffer, ProfileFrame& frame);
+    };
+
+    class ProfileScope
+    {
+    private:
+        const char* name;
+        bool recorded;
+
+    public:
+        explicit ProfileScope(const char* zoneName)
+            : name(zoneName)
+            , recorded(Profiler::GetInstance().IsEnabled())
+        {
+            if (recorded)
+            {
+                Profiler::GetInstance().Record(name, false);
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if (recorded)
+            {
+                Profiler::GetInstance().Record(name, true);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+}
@@ -0,0 +1,314 @@
+#include "framework.h"
+#include "RenderCapture.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr uint64_t kHashSeed = 14695981039346656037ull;     // FNV-1a 64
+        constexpr uint64_t kHashPrime = 1099511628211ull;
+
+        const char* kCommandNames[] = {
+            "Clear", "SetTransform", "PushClip", "PopClip", "DrawBitmap", "DrawLine", "DrawRectangle",
+            "FillRectangle", "DrawEllipse", "FillEllipse", "DrawText", "Callback"
+        };
+
+        uint64_t Mix(uint64_t hash, const void* data, size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * kHashPrime;
+            }
+            return hash;
+        }
+
+        template<typename T>
+        uint64_t Mix(uint64_t hash, const T& value)
+        {
+            return Mix(hash, &value, sizeof(T));
+        }
+
+        // Field by field, so struct padding never reaches the hash
+        uint64_t MixCall(uint64_t hash, const CapturedDrawCall& call)
+        {
+            hash = Mix(hash, call.type);
+            hash = Mix(hash, call.texture);
+            hash = Mix(hash, call.transform);
+            hash = Mix(hash, call.rect);
+            hash = Mix(hash, call.source);
+            hash = Mix(hash, call.color);
+            hash = Mix(hash, call.width);
+            return Mix(hash, call.text);
+        }
+
+        // Name of the first field that differs, nullptr when the calls are equal
+        const char* FirstDifferentField(const CapturedDrawCall& a, const CapturedDrawCall& b)
+        {
+            if (a.type != b.type) return "type";
+            if (a.texture != b.texture) return "texture";
+            if (std::memcmp(&a.transform, &b.transform, sizeof(a.transform)) != 0) return "transform";
+            if (std::memcmp(&a.rect, &b.rect, sizeof(a.rect)) != 0) return "rect";
+            if (std::memcmp(&a.source, &b.source, sizeof(a.source)) != 0) return "source";
+            if (std::memcmp(&a.color, &b.color, sizeof(a.color)) != 0) return "color";
+            if (a.width != b.width) return "width";
+            if (a.text != b.text) return "text";
+            return nullptr;
+        }
+    }
+
+    RenderCapture::RenderCapture(bool keepCallsValue)
+        : keepCalls(keepCallsValue)
+    {
+    }
+
+    void RenderCapture::CaptureFrame(const RenderCommandBuffer& buffer)
+    {
+        Frame frame{ kHashSeed, static_cast<uint32_t>(calls.size()), 0 };
+        D2D1_MATRIX_3X2_F transform = D2D1::Matrix3x2F::Identity();
+
+        for (const RenderCommand& command : buffer.GetCommands())
+        {
+            if (command.type == RenderCommandType::SetTransform)
+            {
+                transform = command.transform;
+                continue;
+            }
+
+            CapturedDrawCall call;
+            std::memset(&call, 0, sizeof(call));
+            call.type = command.type;
+            call.transform = D2D1::Matrix3x2F::Identity();
+
+            switch (command.type)
+            {
+            case RenderCommandType::Clear:
+                call.color = command.clear;
+                break;
+
+            case RenderCommandType::PushClip:
+                call.rect = command.clip;
+                break;
+
+            case RenderCommandType::DrawBitmap:
+                call.texture = command.bitmap.textureId;
+                call.transform = transform;
+                call.rect = command.bitmap.dest;
+                call.source = command.bitmap.source;
+                call.color = D2D1::ColorF(
+                    static_cast<float>(command.bitmap.tint & 0xFF) / 255.0f,
+                    static_cast<float>((command.bitmap.tint >> 8) & 0xFF) / 255.0f,
+                    static_cast<float>((command.bitmap.tint >> 16) & 0xFF) / 255.0f,
+                    static_cast<float>(command.bitmap.tint >> 24) / 255.0f);
+                call.width = command.bitmap.opacity;
+                break;
+
+            case RenderCommandType::DrawLine:
+            case RenderCommandType::DrawRectangle:
+            case RenderCommandType::FillRectangle:
+            case RenderCommandType::DrawEllipse:
+            case RenderCommandType::FillEllipse:
+                call.transform = transform;
+                call.rect = command.shape.rect;
+                call.color = command.shape.color;
+                call.width = command.shape.strokeWidth;
+                break;
+
+            case RenderCommandType::DrawText:
+            {
+                const D2D1_POINT_2F& position = command.text.position;
+                call.transform = transform;
+                call.rect = D2D1::RectF(position.x, position.y, position.x, position.y);
+                call.color = command.text.color;
+                call.width = command.text.fontSize;
+                call.text = Mix(kHashSeed, buffer.GetText(command.text.textOffset), command.text.textLength * sizeof(wchar_t));
+                call.text = Mix(call.text, buffer.GetText(command.text.fontOffset), command.text.fontLength * sizeof(wchar_t));
+                break;
+            }
+
+            default:
+                // PopClip, and callbacks, whose function and data are addresses
+                break;
+            }
+
+            frame.hash = MixCall(frame.hash, call);
+            ++frame.callCount;
+            if (keepCalls)
+            {
+                calls.push_back(call);
+            }
+        }
+
+        frames.push_back(frame);
+    }
+
+    void RenderCapture::Clear()
+    {
+        calls.clear();
+        frames.clear();
+    }
+
+    const CapturedDrawCall* RenderCapture::GetCalls(size_t frameIndex) const
+    {
+        return keepCalls ? calls.data() + frames[frameIndex].firstCall : nullptr;
+    }
+
+    uint64_t RenderCapture::GetRunHash() const
+    {
+        uint64_t hash = kHashSeed;
+        for (const Frame& frame : frames)
+        {
+            hash = Mix(hash, frame.hash);
+        }
+        return hash;
+    }
+
+    RenderCapture::Difference RenderCapture::Compare(const RenderCapture& other) const
+    {
+        Difference difference = Compare(other.frames);
+        if (difference.frame < 0 || !keepCalls || !other.keepCalls)
+            return difference;
+
+        const size_t frameIndex = static_cast<size_t>(difference.frame);
+        if (frameIndex >= frames.size() || frameIndex >= other.frames.size())
+            return difference;
+
+        // Same frame in both: name the first call and field that differ
+        const CapturedDrawCall* mine = GetCalls(frameIndex);
+        const CapturedDrawCall* theirs = other.GetCalls(frameIndex);
+        const uint32_t count = (std::min)(frames[frameIndex].callCount, other.frames[frameIndex].callCount);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (const char* field = FirstDifferentField(mine[i], theirs[i]))
+            {
+                difference.call = static_cast<int>(i);
+                difference.description = "frame " + std::to_string(frameIndex) + ", call " + std::to_string(i)
+                    + " (" + kCommandNames[static_cast<int>(mine[i].type)] + "): " + field + " differs";
+                return difference;
+            }
+        }
+
+        difference.call = static_cast<int>(count);
+        return difference;
+    }
+
+    RenderCapture::Difference RenderCapture::Compare(const std::vector<Frame>& golden) const
+    {
+        Difference difference;
+        const size_t count = (std::min)(frames.size(), golden.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (frames[i].hash != golden[i].hash || frames[i].callCount != golden[i].callCount)
+            {
+                difference.frame = static_cast<int>(i);
+                difference.description = "frame " + std::to_string(i) + ": " + (frames[i].callCount == golden[i].callCount
+                    ? std::string("hash differs")
+                    : std::to_string(frames[i].callCount) + " calls vs " + std::to_string(golden[i].callCount));
+                return difference;
+            }
+        }
+
+        if (frames.size() != golden.size())
+        {
+            difference.frame = static_cast<int>(count);
+            difference.description = std::to_string(frames.size()) + " frames vs " + std::to_string(golden.size());
+        }
+        return difference;
+    }
+
+    bool RenderCapture::SaveHashes(const std::string& filepath) const
+    {
+        std::ofstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+        {
+            DEBUG_LOG("Failed to open render hash file for writing: " + filepath);
+            return false;
+        }
+
+        JsonWriter writer(file);
+        writer.BeginObject();
+        writer.BeginArray("frames");
+        for (const Frame& frame : frames)
+        {
+            char hash[17];
+            std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(frame.hash));
+
+            writer.BeginObject();
+            writer.Write("hash", hash);
+            writer.Write("calls", static_cast<int>(frame.callCount));
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        writer.Flush();
+        return writer.Good();
+    }
+
+    bool RenderCapture::LoadHashes(const std::string& filepath, std::vector<Frame>& outFrames)
+    {
+        outFrames.clear();
+
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+        {
+            DEBUG_LOG("Failed to open render hash file: " + filepath);
+            return false;
+        }
+
+        JsonReader reader(file);
+        std::string_view key;
+        if (!reader.BeginObject())
+            return false;
+
+        while (reader.NextKey(key))
+        {
+            if (key != "frames")
+            {
+                if (!reader.SkipValue()) break;
+                continue;
+            }
+
+            if (!reader.BeginArray()) break;
+            while (reader.NextElement())
+            {
+                Frame frame{ 0, 0, 0 };
+                if (!reader.BeginObject()) break;
+                while (reader.NextKey(key))
+                {
+                    if (key == "hash")
+                    {
+                        std::string_view hash;
+                        if (!reader.ReadString(hash)) break;
+                        frame.hash = std::strtoull(std::string(hash).c_str(), nullptr, 16);
+                    }
+                    else if (key == "calls")
+                    {
+                        int callCount = 0;
+                        if (!reader.Read(callCount)) break;
+                        frame.callCount = static_cast<uint32_t>(callCount);
+                    }
+                    else if (!reader.SkipValue())
+                    {
+                        break;
+                    }
+                }
+                outFrames.push_back(frame);
+            }
+        }
+
+        if (reader.HasError())
+        {
+            DEBUG_LOG("Failed to read render hash file " + filepath + ": " + reader.GetError());
+            outFrames.clear();
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "framework.h"
+#include "RenderCommandBuffer.h"
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    // One played-back command with the transform it was drawn under folded in. Textures are
+    // Texture::id and strings are hashed, so two runs drawing the same thing capture equal
+    // records whatever their allocation addresses.
+    struct CapturedDrawCall
+    {
+        RenderCommandType type;
+        uint32_t texture;                   // DrawBitmap only: Texture::id or Texture2D::GetId()
+        D2D1_MATRIX_3X2_F transform;        // identity for Clear, clips and callbacks
+        D2D1_RECT_F rect;                   // dest, shape, clip; line ends and ellipse centre/radii as recorded
+        D2D1_RECT_F source;                 // DrawBitmap only
+        D2D1_COLOR_F color;                 // bitmaps: the tint, at 8 bits per channel
+        float width;                        // stroke width, font size or bitmap opacity
+        uint64_t text;                      // DrawText: hash of the string and the font name
+    };
+
+    // Recording backend for Renderer (Renderer::SetCapture). Every frame the renderer plays
+    // back is kept as a list of CapturedDrawCall plus a 64-bit hash, so runs can be compared
+    // frame by frame in memory or against golden hashes saved by an earlier run. Frames are
+    // captured on the thread that plays them; read after Renderer::WaitForIdle.
+    class RenderCapture
+    {
+    public:
+        struct Frame
+        {
+            uint64_t hash;
+            uint32_t firstCall;             // into the kept calls
+            uint32_t callCount;
+        };
+
+        struct Difference
+        {
+            int frame = -1;                 // -1 when the runs match
+            int call = -1;                  // first differing call, -1 when only counts/hashes are known
+            std::string description;
+        };
+
+    private:
+        std::vector<CapturedDrawCall> calls;
+        std::vector<Frame> frames;
+        bool keepCalls;
+
+    public:
+        // Without kept calls only the per-frame hashes are stored, for long runs
+        explicit RenderCapture(bool keepCallsValue = true);
+
+        void CaptureFrame(const RenderCommandBuffer& buffer);
+        void Clear();
+
+        size_t GetFrameCount() const { return frames.size(); }
+        const Frame& GetFrame(size_t index) const { return frames[index]; }
+        // Null when calls aren't kept
+        const CapturedDrawCall* GetCalls(size_t frameIndex) const;
+        bool KeepsCalls() const { return keepCalls; }
+        // Hash of every frame hash in order
+        uint64_t GetRunHash() const;
+
+        Difference Compare(const RenderCapture& other) const;
+        Difference Compare(const std::vector<Frame>& golden) const;
+
+        // {"frames": [{"hash": "<16 hex digits>", "calls": N}, ...]}
+        bool SaveHashes(const std::string& filepath) const;
+        static bool LoadHashes(const std::string& filepath, std::vector<Frame>& outFrames);
+    };
+}
@@ -0,0 +1,133 @@
+#include "framework.h"
+#include "RenderCommandBuffer.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        D2D1_COLOR_F ToColorF(const Color& color)
+        {
+            return D2D1::ColorF(color.r, color.g, color.b, color.a);
+        }
+
+        uint32_t PackColor(const Color& color)
+        {
+            const auto channel = [](float value) { return static_cast<uint32_t>((std::min)((std::max)(value, 0.0f), 1.0f) * 255.0f + 0.5f); };
+            return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+        }
+    }
+
+    RenderCommandBuffer::~RenderCommandBuffer()
+    {
+        Reset();
+    }
+
+    void RenderCommandBuffer::Reset()
+    {
+        for (ID2D1Bitmap* bitmap : heldBitmaps)
+        {
+            bitmap->Release();
+        }
+        heldBitmaps.clear();
+        commands.clear();
+        text.clear();
+    }
+
+    void RenderCommandBuffer::Clear(const Color& color)
+    {
+        Append(RenderCommandType::Clear).clear = ToColorF(color);
+    }
+
+    void RenderCommandBuffer::SetTransform(const D2D1_MATRIX_3X2_F& transform)
+    {
+        Append(RenderCommandType::SetTransform).transform = transform;
+    }
+
+    void RenderCommandBuffer::PushClip(const D2D1_RECT_F& rect)
+    {
+        Append(RenderCommandType::PushClip).clip = rect;
+    }
+
+    void RenderCommandBuffer::PopClip()
+    {
+        Append(RenderCommandType::PopClip);
+    }
+
+    void RenderCommandBuffer::DrawBitmap(ID2D1Bitmap* bitmap, uint32_t textureId, const D2D1_RECT_F& dest,
+        const D2D1_RECT_F& source, float opacity, const Color& tint)
+    {
+        // Sprites come sorted, so runs of one texture are common; one reference per run
+        if (bitmap && (heldBitmaps.empty() || heldBitmaps.back() != bitmap))
+        {
+            bitmap->AddRef();
+            heldBitmaps.push_back(bitmap);
+        }
+
+        RenderCommand& command = Append(RenderCommandType::DrawBitmap);
+        command.bitmap.bitmap = bitmap;
+        command.bitmap.textureId = textureId;
+        command.bitmap.dest = dest;
+        command.bitmap.source = source;
+        command.bitmap.opacity = opacity;
+        command.bitmap.tint = PackColor(tint);
+    }
+
+    void RenderCommandBuffer::DrawLine(const Vector2& start, const Vector2& end, const Color& color, float strokeWidth)
+    {
+        DrawShape(RenderCommandType::DrawLine, D2D1::RectF(start.x, start.y, end.x, end.y), color, strokeWidth);
+    }
+
+    void RenderCommandBuffer::DrawShape(RenderCommandType type, const D2D1_RECT_F& rect, const Color& color, float strokeWidth)
+    {
+        RenderCommand& command = Append(type);
+        command.shape.color = ToColorF(color);
+        command.shape.rect = rect;
+        command.shape.strokeWidth = strokeWidth;
+    }
+
+    void RenderCommandBuffer::DrawText(const std::wstring& value, const Vector2& position, const Color& color,
+        const std::wstring& fontName, float fontSize)
+    {
+        const uint32_t textOffset = AppendText(value);
+        const uint32_t fontOffset = AppendText(fontName);
+
+        RenderCommand& command = Append(RenderCommandType::DrawText);
+        command.text.color = ToColorF(color);
+        command.text.position = D2D1::Point2F(position.x, position.y);
+        command.text.fontSize = fontSize;
+        command.text.textOffset = textOffset;
+        command.text.textLength = static_cast<uint32_t>(value.size());
+        command.text.fontOffset = fontOffset;
+        command.text.fontLength = static_cast<uint32_t>(fontName.size());
+    }
+
+    void RenderCommandBuffer::Callback(void (*function)(void*), void* data)
+    {
+        RenderCommand& command = Append(RenderCommandType::Callback);
+        command.callback.function = function;
+        command.callback.data = data;
+    }
+
+    size_t RenderCommandBuffer::GetMemoryBytes() const
+    {
+        return commands.capacity() * sizeof(RenderCommand) + text.capacity() * sizeof(wchar_t)
+            + heldBitmaps.capacity() * sizeof(ID2D1Bitmap*);
+    }
+
+    RenderCommand& RenderCommandBuffer::Append(RenderCommandType type)
+    {
+        commands.emplace_back();
+        RenderCommand& command = commands.back();
+        command.type = type;
+        return command;
+    }
+
+    uint32_t RenderCommandBuffer::AppendText(const std::wstring& value)
+    {
+        // Null-terminated, so font names can go straight to DirectWrite
+        const uint32_t offset = static_cast<uint32_t>(text.size());
+        text.insert(text.end(), value.begin(), value.end());
+        text.push_back(L'\0');
+        return offset;
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "framework.h"
+#include "../Utils/Vector2.h"
+#include "../Utils/Color.h"
+#include "../Utils/Matrix3x2.h"
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace AronEngine
+{
+    enum class RenderCommandType : uint8_t
+    {
+        Clear,
+        SetTransform,
+        PushClip,
+        PopClip,
+        DrawBitmap,
+        DrawLine,
+        DrawRectangle,
+        FillRectangle,
+        DrawEllipse,
+        FillEllipse,
+        DrawText,
+        Callback,           // runs on the thread that executes the buffer, in order
+    };
+
+    // One fixed-size, trivially copyable record; strings live in the buffer's text arena
+    struct RenderCommand
+    {
+        RenderCommandType type;
+        union
+        {
+            D2D1_COLOR_F clear;
+            D2D1_MATRIX_3X2_F transform;
+            D2D1_RECT_F clip;               // target pixels
+            struct
+            {
+                ID2D1Bitmap* bitmap;        // referenced by the buffer until Reset; null without a device
+                uint32_t textureId;         // Texture::id or Texture2D::GetId()
+                D2D1_RECT_F dest;
+                D2D1_RECT_F source;
+                float opacity;
+                uint32_t tint;              // RGBA8, R in the low byte; captured, not drawn
+            } bitmap;
+            struct
+            {
+                D2D1_COLOR_F color;
+                D2D1_RECT_F rect;           // line: start in left/top, end in right/bottom
+                float strokeWidth;
+            } shape;
+            struct
+            {
+                D2D1_COLOR_F color;
+                D2D1_POINT_2F position;
+                float fontSize;
+                uint32_t textOffset;
+                uint32_t textLength;
+                uint32_t fontOffset;
+                uint32_t fontLength;
+            } text;
+            struct
+            {
+                void (*function)(void* data);
+                void* data;
+            } callback;
+        };
+    };
+
+    static_assert(std::is_trivially_copyable<RenderCommand>::value, "RenderCommand must stay POD");
+
+    // A frame of drawing recorded on the game thread and played back by Renderer, possibly on
+    // its render thread while the next frame is being recorded. Bitmaps are AddRef'd when
+    // recorded, so a texture released by the game in the meantime is still valid to draw.
+    class RenderCommandBuffer
+    {
+    private:
+        std::vector<RenderCommand> commands;
+        std::vector<wchar_t> text;
+        std::vector<ID2D1Bitmap*> heldBitmaps;
+
+    public:
+        RenderCommandBuffer() = default;
+        ~RenderCommandBuffer();
+
+        RenderCommandBuffer(const RenderCommandBuffer&) = delete;
+        RenderCommandBuffer& operator=(const RenderCommandBuffer&) = delete;
+
+        // Drops the commands and the bitmap references; capacity is kept for the next frame
+        void Reset();
+
+        void Clear(const Color& color);
+        void SetTransform(const D2D1_MATRIX_3X2_F& transform);
+        void PushClip(const D2D1_RECT_F& rect);
+        void PopClip();
+        void DrawBitmap(ID2D1Bitmap* bitmap, uint32_t textureId, const D2D1_RECT_F& dest, const D2D1_RECT_F& source,
+            float opacity, const Color& tint);
+        void DrawLine(const Vector2& start, const Vector2& end, const Color& color, float strokeWidth);
+        void DrawShape(RenderCommandType type, const D2D1_RECT_F& rect, const Color& color, float strokeWidth);
+        void DrawText(const std::wstring& value, const Vector2& position, const Color& color,
+            const std::wstring& fontName, float fontSize);
+        void Callback(void (*function)(void*), void* data);
+
+        const std::vector<RenderCommand>& GetCommands() const { return commands; }
+        const wchar_t* GetText(uint32_t offset) const { return text.data() + offset; }
+        bool IsEmpty() const { return commands.empty(); }
+        size_t GetMemoryBytes() const;
+
+    private:
+        RenderCommand& Append(RenderCommandType type);
+        uint32_t AppendText(const std::wstring& value);
+    };
+}
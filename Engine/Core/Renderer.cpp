@@ -1,5 +1,9 @@
 #include "framework.h"
 #include "Renderer.h"
+#include "Profiler.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
+#include "RenderCapture.h"
 #include "../Resources/Texture2D.h"
 
 namespace AronEngine
@@ -8,6 +12,14 @@ namespace AronEngine
         : hWnd(nullptr)
         , width(0)
         , height(0)
+        , vsync(true)
+        , recordIndex(0)
+        , currentTransform(Matrix3x2::Identity())
+        , boundTexture(nullptr)
+        , isNullBackend(false)
+        , capture(nullptr)
+        , pendingFrame(nullptr)
+        , renderThreadRunning(false)
     {
     }
 
@@ -18,14 +30,16 @@ namespace AronEngine
 
     bool Renderer::Initialize(HWND hWnd, int width, int height)
     {
+        MEMORY_TAG(Rendering);
+
         this->hWnd = hWnd;
         this->width = width;
         this->height = height;
 
         HRESULT hr = S_OK;
 
-        // Create D2D factory
-        hr = D2D1CreateFactory(D2D1_FACTORY_TYPE_SINGLE_THREADED, d2dFactory.GetAddressOf());
+        // Multi-threaded: textures are created on the game thread while the render thread draws
+        hr = D2D1CreateFactory(D2D1_FACTORY_TYPE_MULTI_THREADED, d2dFactory.GetAddressOf());
         if (FAILED(hr))
         {
             DEBUG_LOG("Failed to create D2D factory");
@@ -63,9 +77,28 @@ namespace AronEngine
         return true;
     }
 
+    bool Renderer::InitializeNull(int width, int height)
+    {
+        this->width = width;
+        this->height = height;
+        isNullBackend = true;
+
+        DEBUG_LOG("Renderer running with the null backend");
+        return true;
+    }
+
     void Renderer::Shutdown()
     {
-        ReleaseRenderTarget();
+        SetRenderThreadEnabled(false);
+        frameBuffers[0].Reset();
+        frameBuffers[1].Reset();
+        textFormats.clear();
+        solidBrush.Reset();
+
+        if (d2dContext)
+        {
+            ReleaseRenderTarget();
+        }
         targetBitmap.Reset();
         swapChain.Reset();
         dxgiBackBuffer.Reset();
@@ -80,6 +113,8 @@ namespace AronEngine
 
     void Renderer::Resize(int width, int height)
     {
+        WaitForIdle();
+
         this->width = width;
         this->height = height;
 
@@ -119,6 +154,14 @@ namespace AronEngine
             featureLevels, ARRAYSIZE(featureLevels), D3D11_SDK_VERSION,
             d3dDevice.GetAddressOf(), &featureLevel, d3dContext.GetAddressOf());
 
+        // Software fallback for machines without a usable GPU (CI, remote sessions)
+        if (FAILED(hr))
+        {
+            hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, creationFlags,
+                featureLevels, ARRAYSIZE(featureLevels), D3D11_SDK_VERSION,
+                d3dDevice.GetAddressOf(), &featureLevel, d3dContext.GetAddressOf());
+        }
+
         if (FAILED(hr))
         {
             DEBUG_LOG("Failed to create D3D device");
@@ -222,48 +265,125 @@ namespace AronEngine
         dxgiBackBuffer.Reset();
     }
 
+
+    void Renderer::SetRenderThreadEnabled(bool enable)
+    {
+        if (enable == renderThread.joinable())
+            return;
+
+        if (enable)
+        {
+            renderThreadRunning = true;
+            renderThread = std::thread(&Renderer::RenderThreadMain, this);
+            return;
+        }
+
+        // The thread finishes any submitted frame before it sees the stop
+        {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            renderThreadRunning = false;
+        }
+        frameSubmitted.notify_one();
+        renderThread.join();
+    }
+
+    void Renderer::WaitForIdle()
+    {
+        std::unique_lock<std::mutex> lock(renderMutex);
+        frameFinished.wait(lock, [this]() { return pendingFrame == nullptr; });
+    }
+
+    void Renderer::RenderThreadMain()
+    {
+        MEMORY_TAG(Rendering);
+        Profiler::SetThreadName("Render");
+
+        std::unique_lock<std::mutex> lock(renderMutex);
+        while (true)
+        {
+            frameSubmitted.wait(lock, [this]() { return pendingFrame != nullptr || !renderThreadRunning; });
+            if (!pendingFrame)
+                break;
+
+            RenderCommandBuffer* frame = pendingFrame;
+            lock.unlock();
+            Execute(*frame);
+            lock.lock();
+
+            pendingFrame = nullptr;
+            frameFinished.notify_all();
+        }
+    }
+
     void Renderer::BeginDraw()
     {
-        d2dContext->BeginDraw();
+        // The other buffer may still be playing; this one was presented before it was submitted
+        Recording().Reset();
+        currentTransform = Matrix3x2::Identity();
+        boundTexture = nullptr;
     }
 
     void Renderer::EndDraw()
     {
-        HRESULT hr = d2dContext->EndDraw();
-        if (SUCCEEDED(hr))
+        if (!renderThread.joinable())
+        {
+            Execute(Recording());
+            return;
+        }
+
         {
-            swapChain->Present(1, 0);
+            PROFILE_SCOPE("Renderer::WaitForRenderThread");
+            std::unique_lock<std::mutex> lock(renderMutex);
+            frameFinished.wait(lock, [this]() { return pendingFrame == nullptr; });
+            pendingFrame = &Recording();
         }
+        frameSubmitted.notify_one();
+        recordIndex ^= 1;
     }
 
     void Renderer::Clear(const Color& color)
     {
-        d2dContext->Clear(D2D1::ColorF(color.r, color.g, color.b, color.a));
+        Recording().Clear(color);
+    }
+
+    void Renderer::RecordCallback(void (*function)(void*), void* data)
+    {
+        Recording().Callback(function, data);
+    }
+
+    void Renderer::SetCapture(RenderCapture* newCapture)
+    {
+        WaitForIdle();
+        capture = newCapture;
     }
 
     void Renderer::SetTransform(const Matrix3x2& transform)
     {
-        d2dContext->SetTransform(D2D1::Matrix3x2F(
+        currentTransform = transform;
+        Recording().SetTransform(D2D1::Matrix3x2F(
             transform.m11, transform.m12,
             transform.m21, transform.m22,
             transform.m31, transform.m32
         ));
     }
 
-    Matrix3x2 Renderer::GetTransform() const
+    void Renderer::SetTransform(const D2D1_MATRIX_3X2_F& transform)
     {
-        D2D1_MATRIX_3X2_F d2dMatrix;
-        d2dContext->GetTransform(&d2dMatrix);
-        return Matrix3x2(
-            d2dMatrix._11, d2dMatrix._12,
-            d2dMatrix._21, d2dMatrix._22,
-            d2dMatrix._31, d2dMatrix._32
+        currentTransform = Matrix3x2(
+            transform._11, transform._12,
+            transform._21, transform._22,
+            transform._31, transform._32
         );
+        Recording().SetTransform(transform);
+    }
+
+    Matrix3x2 Renderer::GetTransform() const
+    {
+        return currentTransform;
     }
 
     void Renderer::PushTransform(const Matrix3x2& transform)
     {
-        auto currentTransform = GetTransform();
         SetTransform(currentTransform * transform);
     }
 
@@ -272,57 +392,59 @@ namespace AronEngine
         SetTransform(Matrix3x2::Identity());
     }
 
+    void Renderer::PushClip(const D2D1_RECT_F& rect)
+    {
+        Recording().PushClip(rect);
+    }
+
+    void Renderer::PopClip()
+    {
+        Recording().PopClip();
+    }
+
     void Renderer::DrawLine(const Vector2& start, const Vector2& end, const Color& color, float strokeWidth)
     {
-        auto brush = CreateSolidBrush(color);
-        d2dContext->DrawLine(
-            D2D1::Point2F(start.x, start.y),
-            D2D1::Point2F(end.x, end.y),
-            brush.Get(),
-            strokeWidth
-        );
+        CountDraw(nullptr);
+        Recording().DrawLine(start, end, color, strokeWidth);
     }
 
     void Renderer::DrawRectangle(const Vector2& position, const Vector2& size, const Color& color, float strokeWidth)
     {
-        auto brush = CreateSolidBrush(color);
         D2D1_RECT_F rect = D2D1::RectF(position.x, position.y, position.x + size.x, position.y + size.y);
-        d2dContext->DrawRectangle(rect, brush.Get(), strokeWidth);
+        CountDraw(nullptr);
+        Recording().DrawShape(RenderCommandType::DrawRectangle, rect, color, strokeWidth);
     }
 
     void Renderer::FillRectangle(const Vector2& position, const Vector2& size, const Color& color)
     {
-        auto brush = CreateSolidBrush(color);
         D2D1_RECT_F rect = D2D1::RectF(position.x, position.y, position.x + size.x, position.y + size.y);
-        d2dContext->FillRectangle(rect, brush.Get());
+        CountDraw(nullptr);
+        Recording().DrawShape(RenderCommandType::FillRectangle, rect, color, 0.0f);
     }
 
     void Renderer::DrawCircle(const Vector2& center, float radius, const Color& color, float strokeWidth)
     {
-        auto brush = CreateSolidBrush(color);
-        D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius, radius);
-        d2dContext->DrawEllipse(ellipse, brush.Get(), strokeWidth);
+        DrawEllipse(center, Vector2(radius, radius), color, strokeWidth);
     }
 
     void Renderer::FillCircle(const Vector2& center, float radius, const Color& color)
     {
-        auto brush = CreateSolidBrush(color);
-        D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius, radius);
-        d2dContext->FillEllipse(ellipse, brush.Get());
+        FillEllipse(center, Vector2(radius, radius), color);
     }
 
+    // Ellipses are recorded as centre (left/top) and radii (right/bottom)
     void Renderer::DrawEllipse(const Vector2& center, const Vector2& radius, const Color& color, float strokeWidth)
     {
-        auto brush = CreateSolidBrush(color);
-        D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius.x, radius.y);
-        d2dContext->DrawEllipse(ellipse, brush.Get(), strokeWidth);
+        CountDraw(nullptr);
+        Recording().DrawShape(RenderCommandType::DrawEllipse, D2D1::RectF(center.x, center.y, radius.x, radius.y),
+            color, strokeWidth);
     }
 
     void Renderer::FillEllipse(const Vector2& center, const Vector2& radius, const Color& color)
     {
-        auto brush = CreateSolidBrush(color);
-        D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius.x, radius.y);
-        d2dContext->FillEllipse(ellipse, brush.Get());
+        CountDraw(nullptr);
+        Recording().DrawShape(RenderCommandType::FillEllipse, D2D1::RectF(center.x, center.y, radius.x, radius.y),
+            color, 0.0f);
     }
 
     void Renderer::DrawTexture(Texture2D* texture, const Vector2& position, const Vector2& size,
@@ -331,14 +453,12 @@ namespace AronEngine
         if (!texture || !texture->GetBitmap())
             return;
 
+        ID2D1Bitmap* bitmap = texture->GetBitmap();
+        const D2D1_SIZE_F bitmapSize = bitmap->GetSize();
         D2D1_RECT_F destRect = D2D1::RectF(position.x, position.y, position.x + size.x, position.y + size.y);
-        
-        d2dContext->DrawBitmap(
-            texture->GetBitmap(),
-            destRect,
-            opacity,
-            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR
-        );
+
+        CountDraw(bitmap);
+        Recording().DrawBitmap(bitmap, texture->GetId(), destRect, D2D1::RectF(0.0f, 0.0f, bitmapSize.width, bitmapSize.height), opacity, tint);
     }
 
     void Renderer::DrawTextureRect(Texture2D* texture, const Vector2& position, const Vector2& size,
@@ -350,69 +470,18 @@ namespace AronEngine
 
         D2D1_RECT_F destRect = D2D1::RectF(position.x, position.y, position.x + size.x, position.y + size.y);
         D2D1_RECT_F srcRect = D2D1::RectF(sourcePos.x, sourcePos.y, sourcePos.x + sourceSize.x, sourcePos.y + sourceSize.y);
-        
-        d2dContext->DrawBitmap(
-            texture->GetBitmap(),
-            destRect,
-            opacity,
-            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-            &srcRect
-        );
+
+        CountDraw(texture->GetBitmap());
+        Recording().DrawBitmap(texture->GetBitmap(), texture->GetId(), destRect, srcRect, opacity, tint);
     }
 
     void Renderer::DrawText(const std::wstring& text, const Vector2& position, const Color& color,
                            const std::wstring& fontName, float fontSize)
     {
-        auto brush = CreateSolidBrush(color);
-        auto textFormat = CreateTextFormat(fontName, fontSize);
-        
-        if (textFormat)
-        {
-            D2D1_RECT_F layoutRect = D2D1::RectF(position.x, position.y, position.x + 1000, position.y + 1000);
-            d2dContext->DrawText(
-                text.c_str(),
-                static_cast<UINT32>(text.length()),
-                textFormat.Get(),
-                layoutRect,
-                brush.Get()
-            );
-        }
-    }
-
-    ComPtr<ID2D1SolidColorBrush> Renderer::CreateSolidBrush(const Color& color)
-    {
-        ComPtr<ID2D1SolidColorBrush> brush;
-        d2dContext->CreateSolidColorBrush(
-            D2D1::ColorF(color.r, color.g, color.b, color.a),
-            brush.GetAddressOf()
-        );
-        return brush;
+        CountDraw(nullptr);
+        Recording().DrawText(text, position, color, fontName, fontSize);
     }
 
-    ComPtr<IDWriteTextFormat> Renderer::CreateTextFormat(const std::wstring& fontName, float fontSize)
-    {
-        ComPtr<IDWriteTextFormat> textFormat;
-        dwriteFactory->CreateTextFormat(
-            fontName.c_str(),
-            nullptr,
-            DWRITE_FONT_WEIGHT_REGULAR,
-            DWRITE_FONT_STYLE_NORMAL,
-            DWRITE_FONT_STRETCH_NORMAL,
-            fontSize,
-            L"en-us",
-            textFormat.GetAddressOf()
-        );
-        return textFormat;
-    }
-    
-    void Renderer::SetTransform(const D2D1_MATRIX_3X2_F& transform)
-    {
-        if (d2dContext)
-        {
-            d2dContext->SetTransform(transform);
-        }
-    }
-    
     void Renderer::DrawSprite(Texture2D* texture, const D2D1_RECT_F& destRect, const D2D1_RECT_F& sourceRect, const Color& tint, float opacity)
     {
         if (!d2dContext || !texture)
@@ -422,18 +491,14 @@ namespace AronEngine
         if (!bitmap)
             return;
             
-        d2dContext->DrawBitmap(
-            bitmap,
-            &destRect,
-            opacity * tint.a,
-            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-            &sourceRect
-        );
+        CountDraw(bitmap);
+        Recording().DrawBitmap(bitmap, texture->GetId(), destRect, sourceRect, opacity * tint.a, tint);
     }
     
-    void Renderer::DrawTexture(std::shared_ptr<Texture> texture, const Vector2& position, const Vector2& size, const Color& tint, float opacity)
+    void Renderer::DrawTexture(const std::shared_ptr<Texture>& texture, const Vector2& position, const Vector2& size, const Color& tint, float opacity)
     {
-        if (!d2dContext || !texture || !texture->bitmap)
+        // Placeholder textures have no bitmap; the null backend records them all the same
+        if (!texture || !(texture->bitmap || isNullBackend))
             return;
 
         D2D1_RECT_F destRect = D2D1::RectF(
@@ -451,19 +516,15 @@ namespace AronEngine
         );
 
         // 색상 팅트를 적용하고 싶다면 여기서 처리
-        d2dContext->DrawBitmap(
-            texture->bitmap,
-            &destRect,
-            opacity * tint.a,
-            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-            &sourceRect
-        );
+        CountDraw(texture.get());
+        Recording().DrawBitmap(texture->bitmap, texture->id, destRect, sourceRect, opacity * tint.a, tint);
     }
 
-    void Renderer::DrawTextureRect(std::shared_ptr<Texture> texture, const Vector2& position, const Vector2& size, 
+    void Renderer::DrawTextureRect(const std::shared_ptr<Texture>& texture, const Vector2& position, const Vector2& size, 
                                  const D2D1_RECT_F& sourceRect, const Color& tint, float opacity)
     {
-        if (!d2dContext || !texture || !texture->bitmap)
+        // Placeholder textures have no bitmap; the null backend records them all the same
+        if (!texture || !(texture->bitmap || isNullBackend))
             return;
 
         D2D1_RECT_F destRect = D2D1::RectF(
@@ -473,12 +534,156 @@ namespace AronEngine
             position.y + size.y
         );
 
-        d2dContext->DrawBitmap(
-            texture->bitmap,
-            &destRect,
-            opacity * tint.a,
-            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-            &sourceRect
-        );
+        CountDraw(texture.get());
+        Recording().DrawBitmap(texture->bitmap, texture->id, destRect, sourceRect, opacity * tint.a, tint);
+    }
+
+    void Renderer::Execute(const RenderCommandBuffer& buffer)
+    {
+        PROFILE_SCOPE("Renderer::Execute");
+
+        if (capture)
+        {
+            capture->CaptureFrame(buffer);
+        }
+
+        if (!d2dContext)
+            return;
+
+        if (!solidBrush)
+        {
+            d2dContext->CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::White), solidBrush.GetAddressOf());
+        }
+
+        d2dContext->BeginDraw();
+        d2dContext->SetTransform(D2D1::Matrix3x2F::Identity());
+
+        for (const RenderCommand& command : buffer.GetCommands())
+        {
+            switch (command.type)
+            {
+            case RenderCommandType::Clear:
+                d2dContext->Clear(command.clear);
+                break;
+
+            case RenderCommandType::SetTransform:
+                d2dContext->SetTransform(command.transform);
+                break;
+
+            case RenderCommandType::PushClip:
+            {
+                D2D1_MATRIX_3X2_F current;
+                d2dContext->GetTransform(&current);
+                d2dContext->SetTransform(D2D1::Matrix3x2F::Identity());
+                d2dContext->PushAxisAlignedClip(command.clip, D2D1_ANTIALIAS_MODE_ALIASED);
+                d2dContext->SetTransform(current);
+                break;
+            }
+
+            case RenderCommandType::PopClip:
+                d2dContext->PopAxisAlignedClip();
+                break;
+
+            case RenderCommandType::DrawBitmap:
+                d2dContext->DrawBitmap(command.bitmap.bitmap, &command.bitmap.dest, command.bitmap.opacity,
+                    D2D1_BITMAP_INTERPOLATION_MODE_LINEAR, &command.bitmap.source);
+                break;
+
+            case RenderCommandType::DrawLine:
+                solidBrush->SetColor(command.shape.color);
+                d2dContext->DrawLine(
+                    D2D1::Point2F(command.shape.rect.left, command.shape.rect.top),
+                    D2D1::Point2F(command.shape.rect.right, command.shape.rect.bottom),
+                    solidBrush.Get(), command.shape.strokeWidth);
+                break;
+
+            case RenderCommandType::DrawRectangle:
+                solidBrush->SetColor(command.shape.color);
+                d2dContext->DrawRectangle(command.shape.rect, solidBrush.Get(), command.shape.strokeWidth);
+                break;
+
+            case RenderCommandType::FillRectangle:
+                solidBrush->SetColor(command.shape.color);
+                d2dContext->FillRectangle(command.shape.rect, solidBrush.Get());
+                break;
+
+            case RenderCommandType::DrawEllipse:
+            case RenderCommandType::FillEllipse:
+            {
+                const D2D1_RECT_F& shape = command.shape.rect;
+                const D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(shape.left, shape.top), shape.right, shape.bottom);
+                solidBrush->SetColor(command.shape.color);
+                if (command.type == RenderCommandType::DrawEllipse)
+                {
+                    d2dContext->DrawEllipse(ellipse, solidBrush.Get(), command.shape.strokeWidth);
+                }
+                else
+                {
+                    d2dContext->FillEllipse(ellipse, solidBrush.Get());
+                }
+                break;
+            }
+
+            case RenderCommandType::DrawText:
+            {
+                IDWriteTextFormat* textFormat = GetTextFormat(buffer.GetText(command.text.fontOffset), command.text.fontSize);
+                if (textFormat)
+                {
+                    const D2D1_POINT_2F& position = command.text.position;
+                    D2D1_RECT_F layoutRect = D2D1::RectF(position.x, position.y, position.x + 1000, position.y + 1000);
+                    solidBrush->SetColor(command.text.color);
+                    d2dContext->DrawText(buffer.GetText(command.text.textOffset), command.text.textLength,
+                        textFormat, layoutRect, solidBrush.Get());
+                }
+                break;
+            }
+
+            case RenderCommandType::Callback:
+                // Whatever the callback draws with D3D must land on top of the batched D2D work
+                d2dContext->Flush();
+                command.callback.function(command.callback.data);
+                break;
+            }
+        }
+
+        HRESULT hr = d2dContext->EndDraw();
+        if (SUCCEEDED(hr))
+        {
+            PROFILE_SCOPE("Renderer::Present");
+            swapChain->Present(vsync ? 1 : 0, 0);
+        }
+    }
+
+    IDWriteTextFormat* Renderer::GetTextFormat(const wchar_t* fontName, float fontSize)
+    {
+        ComPtr<IDWriteTextFormat>& textFormat = textFormats[std::make_pair(std::wstring(fontName), fontSize)];
+        if (!textFormat)
+        {
+            dwriteFactory->CreateTextFormat(
+                fontName,
+                nullptr,
+                DWRITE_FONT_WEIGHT_REGULAR,
+                DWRITE_FONT_STYLE_NORMAL,
+                DWRITE_FONT_STRETCH_NORMAL,
+                fontSize,
+                L"en-us",
+                textFormat.GetAddressOf()
+            );
+        }
+        return textFormat.Get();
+    }
+
+    void Renderer::CountDraw(const void* texture)
+    {
+        EngineStats::Add(StatCounter::DrawCalls);
+        if (!texture || texture != boundTexture)
+        {
+            EngineStats::Add(StatCounter::Batches);
+            if (texture)
+            {
+                EngineStats::Add(StatCounter::TexturesBound);
+            }
+        }
+        boundTexture = texture;
     }
-}
\ No newline at end of file
+}
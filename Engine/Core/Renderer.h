@@ -4,10 +4,17 @@
 #include "../Utils/Color.h"
 #include "../Utils/Matrix3x2.h"
 #include "TextureManager.h"
+#include "RenderCommandBuffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
 
 namespace AronEngine
 {
     class Texture2D;
+    class RenderCapture;
 
     class Renderer
     {
@@ -28,25 +35,73 @@ namespace AronEngine
         HWND hWnd;
         int width;
         int height;
+        std::atomic<bool> vsync;
+
+        // Draw calls record into frameBuffers[recordIndex]; EndDraw hands the frame to Execute,
+        // on the render thread when it runs, and the next frame records into the other buffer
+        RenderCommandBuffer frameBuffers[2];
+        int recordIndex;
+        Matrix3x2 currentTransform;             // as recorded, for GetTransform on the game thread
+
+        // Last texture drawn this frame, for the batch / texture-bind counters
+        const void* boundTexture;
+
+        bool isNullBackend;                     // no device: frames are recorded and captured only
+        RenderCapture* capture;
+
+        std::thread renderThread;
+        std::mutex renderMutex;
+        std::condition_variable frameSubmitted;
+        std::condition_variable frameFinished;
+        RenderCommandBuffer* pendingFrame;      // submitted and not yet presented
+        bool renderThreadRunning;
+
+        // Owned by whichever thread executes
+        ComPtr<ID2D1SolidColorBrush> solidBrush;
+        std::map<std::pair<std::wstring, float>, ComPtr<IDWriteTextFormat>> textFormats;
 
     public:
         Renderer();
         ~Renderer();
 
         bool Initialize(HWND hWnd, int width, int height);
+        // Null backend: no graphics API at all. Draw calls are recorded, counted and handed to
+        // the capture as usual, but nothing is rasterized or presented; GetD2DContext is null.
+        bool InitializeNull(int width, int height);
         void Shutdown();
         void Resize(int width, int height);
 
+        // Drawing between these is recorded, then played back and presented by EndDraw; with
+        // the render thread on, that happens while the caller goes on to the next frame
         void BeginDraw();
         void EndDraw();
         void Clear(const Color& color);
 
+        // Off by default. Anything touching the D2D/D3D context directly (ImGui, resizing)
+        // must call WaitForIdle first while it is on.
+        void SetRenderThreadEnabled(bool enable);
+        bool IsRenderThreadEnabled() const { return renderThread.joinable(); }
+        // Blocks until the last submitted frame has been presented
+        void WaitForIdle();
+        // Records a call made at this point of playback, on the thread that executes the frame
+        void RecordCallback(void (*function)(void*), void* data);
+
+        // Every frame played back from now on is also captured, on the thread playing it;
+        // nullptr stops. Not owned.
+        void SetCapture(RenderCapture* newCapture);
+        RenderCapture* GetCapture() const { return capture; }
+        bool IsNullBackend() const { return isNullBackend; }
+
         void SetTransform(const Matrix3x2& transform);
         void SetTransform(const D2D1_MATRIX_3X2_F& transform);
         Matrix3x2 GetTransform() const;
         void PushTransform(const Matrix3x2& transform);
         void PopTransform();
 
+        // Axis-aligned in target pixels, whatever the current transform; pairs must nest
+        void PushClip(const D2D1_RECT_F& rect);
+        void PopClip();
+
         void DrawLine(const Vector2& start, const Vector2& end, const Color& color, float strokeWidth = 1.0f);
         void DrawRectangle(const Vector2& position, const Vector2& size, const Color& color, float strokeWidth = 1.0f);
         void FillRectangle(const Vector2& position, const Vector2& size, const Color& color);
@@ -65,15 +120,19 @@ namespace AronEngine
                        const Color& tint = Color::White, float opacity = 1.0f);
                        
         // 새로운 텍스처 시스템용 렌더링 메소드들
-        void DrawTexture(std::shared_ptr<Texture> texture, const Vector2& position, const Vector2& size, 
+        void DrawTexture(const std::shared_ptr<Texture>& texture, const Vector2& position, const Vector2& size, 
                         const Color& tint = Color::White, float opacity = 1.0f);
-        void DrawTextureRect(std::shared_ptr<Texture> texture, const Vector2& position, const Vector2& size,
+        void DrawTextureRect(const std::shared_ptr<Texture>& texture, const Vector2& position, const Vector2& size,
                            const D2D1_RECT_F& sourceRect, const Color& tint = Color::White, float opacity = 1.0f);
 
         void DrawText(const std::wstring& text, const Vector2& position, const Color& color,
                      const std::wstring& fontName = L"Arial", float fontSize = 16.0f);
 
         ID2D1DeviceContext6* GetD2DContext() const { return d2dContext.Get(); }
+
+        // Off for benchmarks so Present doesn't wait for the display
+        void SetVSync(bool enable) { vsync = enable; }
+        bool GetVSync() const { return vsync.load(); }
         IDWriteFactory7* GetDWriteFactory() const { return dwriteFactory.Get(); }
         IWICImagingFactory2* GetWICFactory() const { return wicFactory.Get(); }
 
@@ -85,7 +144,13 @@ namespace AronEngine
         bool CreateRenderTarget();
         void ReleaseRenderTarget();
         
-        ComPtr<ID2D1SolidColorBrush> CreateSolidBrush(const Color& color);
-        ComPtr<IDWriteTextFormat> CreateTextFormat(const std::wstring& fontName, float fontSize);
+        RenderCommandBuffer& Recording() { return frameBuffers[recordIndex]; }
+        void RenderThreadMain();
+        // Plays a recorded frame on the device context and presents it
+        void Execute(const RenderCommandBuffer& buffer);
+        IDWriteTextFormat* GetTextFormat(const wchar_t* fontName, float fontSize);
+
+        // texture is nullptr for shapes and text, which always break a batch
+        void CountDraw(const void* texture);
     };
 }
\ No newline at end of file
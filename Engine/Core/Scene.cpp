@@ -1,19 +1,460 @@
 #include "framework.h"
 #include "Scene.h"
 #include "GameObject.h"
+#include "../Components/ComponentRegistry.h"
+#include "../Components/Transform.h"
+#include "../Components/SpriteRenderer.h"
+#include "../Components/Collider.h"
+#include "../Components/Rigidbody.h"
+#include "../Components/Animator.h"
+#include "../Components/AudioSource.h"
+#include "../Components/AudioListener.h"
+#include "../Components/UI/Canvas.h"
+#include "../Components/UI/UIButton.h"
+#include "../Components/Camera.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include "../Utils/BinaryWriter.h"
+#include "../Utils/BinaryReader.h"
+#include "../Utils/MappedFile.h"
+#include "Profiler.h"
+#include "EngineStats.h"
+#include "MemoryTracker.h"
 #include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace AronEngine
 {
+    namespace
+    {
+        constexpr int kSceneFileVersion = 1;
+
+        // Binary layout, all offsets from the start of the file:
+        //   header | string offsets (count + 1) | string bytes | object records | block records | block data
+        // Each block holds every component of one type: the owning object indices, then the
+        // components' WriteBinary output back to back.
+        constexpr char kBinaryMagic[4] = { 'A', 'S', 'C', 'N' };
+        constexpr uint32_t kBinaryVersion = 2;
+
+        struct BinaryHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t sceneName;         // string index
+            uint32_t objectCount;
+            uint32_t stringCount;
+            uint32_t blockCount;
+            uint32_t reserved;
+            uint64_t stringOffsets;     // uint32_t[stringCount + 1] into the string bytes
+            uint64_t stringData;
+            uint64_t objects;           // BinaryObject[objectCount]
+            uint64_t blocks;            // BinaryBlock[blockCount]
+        };
+
+        struct BinaryObject
+        {
+            uint32_t name;
+            uint32_t tag;
+            int32_t layer;
+            int32_t parent;             // earlier object index, -1 for roots
+            float position[2];          // local
+            float rotation;
+            float scale[2];
+            uint32_t flags;
+            uint64_t stableId;          // version 2
+        };
+
+        // Version 1 records stop before stableId
+        constexpr size_t kBinaryObjectSizeV1 = offsetof(BinaryObject, stableId);
+
+        struct BinaryBlock
+        {
+            uint32_t typeName;
+            uint32_t count;
+            uint64_t offset;            // uint32_t owners[count], then the component data
+            uint64_t size;
+        };
+
+        constexpr uint32_t kObjectActive = 1u << 0;
+
+        // Find only sees types registered through Get, and a freshly started program may not
+        // have created any component yet
+        void RegisterBuiltInComponents()
+        {
+            static const bool registered = []
+            {
+                ComponentRegistry::Get<SpriteRenderer>();
+                ComponentRegistry::Get<BoxCollider>();
+                ComponentRegistry::Get<CircleCollider>();
+                ComponentRegistry::Get<Rigidbody>();
+                ComponentRegistry::Get<Animator>();
+                ComponentRegistry::Get<AudioSource>();
+                ComponentRegistry::Get<AudioListener>();
+                ComponentRegistry::Get<Canvas>();
+                ComponentRegistry::Get<UIButton>();
+                ComponentRegistry::Get<Camera>();
+                return true;
+            }();
+            (void)registered;
+        }
+
+        std::string FormatStableId(uint64_t id)
+        {
+            char text[17];
+            std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(id));
+            return text;
+        }
+
+        bool ParseStableId(const std::string& text, uint64_t& id)
+        {
+            if (text.empty() || text.size() > 16) return false;
+            char* end = nullptr;
+            id = std::strtoull(text.c_str(), &end, 16);
+            return end == text.c_str() + text.size();
+        }
+
+        void WriteGameObject(JsonWriter& writer, const GameObject* gameObject, int parentIndex)
+        {
+            writer.BeginObject();
+            writer.Write("name", gameObject->GetName());
+            writer.Write("active", gameObject->IsActive());
+            if (gameObject->GetTag() != "Untagged") writer.Write("tag", gameObject->GetTag());
+            if (gameObject->GetLayer() != 0) writer.Write("layer", gameObject->GetLayer());
+            if (parentIndex >= 0) writer.Write("parent", parentIndex);
+            // Hex string: JSON numbers can't hold 64 bits exactly
+            if (gameObject->GetStableId() != 0) writer.Write("id", FormatStableId(gameObject->GetStableId()));
+
+            const Transform* transform = gameObject->GetTransform();
+            writer.BeginObject("transform");
+            writer.Write("position", transform->GetLocalPosition());
+            writer.Write("rotation", transform->GetLocalRotation());
+            writer.Write("scale", transform->GetLocalScale());
+            writer.EndObject();
+
+            writer.BeginObject("components");
+            for (const auto& component : gameObject->GetAllComponents())
+            {
+                // Types the loader cannot construct by name would only be skipped on the way back in
+                const ComponentTypeInfo* type = component->GetTypeInfo();
+                if (!type || !type->create) continue;
+
+                writer.BeginObject(type->name);
+                component->Serialize(writer);
+                writer.EndObject();
+            }
+            writer.EndObject();
+
+            writer.EndObject();
+        }
+
+        struct SavedObject
+        {
+            const GameObject* gameObject;
+            int parent;     // index into the save order, -1 for roots
+        };
+
+        // Depth-first from each root so every parent is written before its children
+        std::vector<SavedObject> CollectSaveOrder(const std::vector<GameObject*>& objects)
+        {
+            std::unordered_set<const GameObject*> saved;
+            saved.reserve(objects.size());
+            for (const GameObject* go : objects)
+            {
+                if (go && !go->GetPool()) saved.insert(go);
+            }
+
+            std::vector<SavedObject> order;
+            order.reserve(saved.size());
+            std::vector<SavedObject> stack;
+            for (const GameObject* go : objects)
+            {
+                if (!go || !saved.count(go)) continue;
+                if (go->GetParent() && saved.count(go->GetParent())) continue;
+
+                stack.push_back({ go, -1 });
+                while (!stack.empty())
+                {
+                    const SavedObject item = stack.back();
+                    stack.pop_back();
+                    const int index = static_cast<int>(order.size());
+                    order.push_back(item);
+
+                    const std::vector<GameObject*>& children = item.gameObject->GetChildren();
+                    for (auto it = children.rbegin(); it != children.rend(); ++it)
+                    {
+                        if (saved.count(*it)) stack.push_back({ *it, index });
+                    }
+                }
+            }
+            return order;
+        }
+
+        bool ReadTransform(JsonReader& reader, Vector2& position, float& rotation, Vector2& scale)
+        {
+            if (!reader.BeginObject()) return false;
+
+            std::string_view key;
+            while (reader.NextKey(key))
+            {
+                bool ok;
+                if (key == "position") ok = reader.Read(position);
+                else if (key == "rotation") ok = reader.Read(rotation);
+                else if (key == "scale") ok = reader.Read(scale);
+                else ok = reader.SkipValue();
+                if (!ok) return false;
+            }
+            return !reader.HasError();
+        }
+
+        bool ReadComponentProperties(JsonReader& reader, Component* component)
+        {
+            if (!reader.BeginObject()) return false;
+
+            std::string_view key;
+            while (reader.NextKey(key))
+            {
+                // Unknown keys are skipped so files from newer builds still load
+                if (!component->DeserializeProperty(key, reader))
+                {
+                    if (reader.HasError() || !reader.SkipValue()) return false;
+                }
+            }
+            return !reader.HasError();
+        }
+
+        class SceneFileReader
+        {
+        private:
+            JsonReader& reader;
+            const Scene::CreateFunction& create;
+            std::string* sceneName;
+            std::vector<GameObject*> created;
+            std::string typeName;
+
+        public:
+            SceneFileReader(JsonReader& reader, const Scene::CreateFunction& create, std::string* sceneName)
+                : reader(reader)
+                , create(create)
+                , sceneName(sceneName)
+            {
+            }
+
+            bool ReadScene()
+            {
+                if (!reader.BeginObject()) return false;
+
+                std::string_view key;
+                while (reader.NextKey(key))
+                {
+                    if (key == "version")
+                    {
+                        int version = 0;
+                        if (!reader.Read(version)) return false;
+                        if (version > kSceneFileVersion) return reader.Fail("scene file version is newer than this build");
+                    }
+                    else if (key == "name" && sceneName)
+                    {
+                        if (!reader.Read(*sceneName)) return false;
+                    }
+                    else if (key == "gameObjects")
+                    {
+                        if (!reader.BeginArray()) return false;
+                        while (reader.NextElement())
+                        {
+                            if (!ReadGameObject()) return false;
+                        }
+                        if (reader.HasError()) return false;
+                    }
+                    else if (!reader.SkipValue())
+                    {
+                        return false;
+                    }
+                }
+                if (reader.HasError()) return false;
+                return reader.AtEnd() || reader.Fail("unexpected data after the scene");
+            }
+
+        private:
+            bool ReadGameObject()
+            {
+                if (!reader.BeginObject()) return false;
+
+                GameObject* gameObject = nullptr;
+                int parentIndex = -1;
+                Vector2 position(0, 0);
+                float rotation = 0.0f;
+                Vector2 scale(1, 1);
+                std::string value;
+
+                std::string_view key;
+                while (reader.NextKey(key))
+                {
+                    // "name" comes first in saved files; without it the object takes a default
+                    if (!gameObject)
+                    {
+                        std::string name = "GameObject";
+                        if (key == "name")
+                        {
+                            if (!reader.Read(name)) return false;
+                        }
+                        gameObject = create(name);
+                        if (!gameObject) return reader.Fail("could not create game object");
+                        if (key == "name") continue;
+                    }
+
+                    bool ok = true;
+                    if (key == "name")
+                    {
+                        ok = reader.Read(value);
+                        if (ok) gameObject->SetName(value);
+                    }
+                    else if (key == "active")
+                    {
+                        bool active = true;
+                        ok = reader.Read(active);
+                        if (ok) gameObject->SetActive(active);
+                    }
+                    else if (key == "tag")
+                    {
+                        ok = reader.Read(value);
+                        if (ok) gameObject->SetTag(value);
+                    }
+                    else if (key == "layer")
+                    {
+                        int layer = 0;
+                        ok = reader.Read(layer);
+                        if (ok) gameObject->SetLayer(layer);
+                    }
+                    else if (key == "id")
+                    {
+                        uint64_t id = 0;
+                        ok = reader.Read(value);
+                        if (ok && !ParseStableId(value, id)) return reader.Fail("id must be a hex string");
+                        if (ok) gameObject->SetStableId(id);
+                    }
+                    else if (key == "parent")
+                    {
+                        ok = reader.Read(parentIndex);
+                        if (ok && (parentIndex < -1 || parentIndex >= static_cast<int>(created.size())))
+                        {
+                            return reader.Fail("parent must refer to an earlier game object");
+                        }
+                    }
+                    else if (key == "transform")
+                    {
+                        ok = ReadTransform(reader, position, rotation, scale);
+                    }
+                    else if (key == "components")
+                    {
+                        ok = ReadComponents(gameObject);
+                    }
+                    else if (key == "spriteRenderer")
+                    {
+                        // Older files stored the one sprite directly on the object
+                        std::unique_ptr<Component> renderer(new SpriteRenderer());
+                        ok = ReadComponentProperties(reader, renderer.get());
+                        if (ok) gameObject->AttachComponent(std::move(renderer), ComponentRegistry::Get<SpriteRenderer>());
+                    }
+                    else
+                    {
+                        ok = reader.SkipValue();
+                    }
+                    if (!ok) return false;
+                }
+                if (reader.HasError()) return false;
+
+                if (!gameObject)
+                {
+                    gameObject = create("GameObject");
+                    if (!gameObject) return reader.Fail("could not create game object");
+                }
+
+                // Parenting keeps the world position, so the saved local values go on afterwards
+                if (parentIndex >= 0)
+                {
+                    gameObject->SetParent(created[parentIndex]);
+                }
+                Transform* transform = gameObject->GetTransform();
+                transform->SetLocalPosition(position);
+                transform->SetLocalRotation(rotation);
+                transform->SetLocalScale(scale);
+
+                created.push_back(gameObject);
+                return true;
+            }
+
+            bool ReadComponents(GameObject* gameObject)
+            {
+                if (!reader.BeginObject()) return false;
+
+                std::string_view key;
+                while (reader.NextKey(key))
+                {
+                    // The key view dies with the next read
+                    typeName.assign(key.data(), key.size());
+                    const ComponentTypeInfo* type = ComponentRegistry::Find(typeName);
+                    if (!type || !type->create)
+                    {
+                        DEBUG_LOG("Scene file: skipping unknown component type '" + typeName + "'");
+                        if (!reader.SkipValue()) return false;
+                        continue;
+                    }
+
+                    std::unique_ptr<Component> component(type->create());
+                    if (!ReadComponentProperties(reader, component.get())) return false;
+                    gameObject->AttachComponent(std::move(component), type);
+                }
+                return !reader.HasError();
+            }
+        };
+
+        struct BinaryBlockBuilder
+        {
+            const ComponentTypeInfo* type;
+            std::vector<uint32_t> owners;
+            std::unique_ptr<BinaryWriter> data;
+        };
+
+        bool InFile(uint64_t offset, uint64_t count, uint64_t elementSize, size_t fileSize)
+        {
+            if (offset > fileSize) return false;
+            return elementSize == 0 || count <= (fileSize - offset) / elementSize;
+        }
+
+        bool FailBinary(std::string* error, const std::string& message)
+        {
+            if (error) *error = message;
+            return false;
+        }
+
+        void WritePadding(std::ostream& output, uint64_t& position)
+        {
+            static const char kZeros[8] = {};
+            const uint64_t padding = (8 - position % 8) % 8;
+            output.write(kZeros, static_cast<std::streamsize>(padding));
+            position += padding;
+        }
+    }
+
     Scene::Scene()
         : Object("Scene")
+        , iteratingUpdateLists(false)
         , isLoaded(false)
+        , staged(false)
     {
     }
 
     Scene::Scene(const std::string& name)
         : Object(name)
+        , iteratingUpdateLists(false)
         , isLoaded(false)
+        , staged(false)
     {
     }
 
@@ -21,6 +462,7 @@ namespace AronEngine
     {
         gameObjects.clear();
         gameObjectsToDestroy.clear();
+        pools.clear();
     }
 
     GameObject* Scene::CreateGameObject(const std::string& name)
@@ -59,6 +501,12 @@ namespace AronEngine
         return result;
     }
 
+    GameObject* Scene::FindGameObjectByStableId(uint64_t id) const
+    {
+        auto it = objectsByStableId.find(id);
+        return it != objectsByStableId.end() ? it->second : nullptr;
+    }
+
     void Scene::DestroyGameObject(GameObject* gameObject)
     {
         if (!gameObject)
@@ -76,11 +524,21 @@ namespace AronEngine
         if (!gameObject)
             return;
 
-        gameObjects.erase(
-            std::remove_if(gameObjects.begin(), gameObjects.end(),
-                [gameObject](const std::unique_ptr<GameObject>& go) { return go.get() == gameObject; }),
-            gameObjects.end()
-        );
+        if (GameObjectPool* pool = gameObject->GetPool())
+        {
+            auto queued = std::find(gameObjectsToDestroy.begin(), gameObjectsToDestroy.end(), gameObject);
+            if (queued != gameObjectsToDestroy.end())
+            {
+                gameObjectsToDestroy.erase(queued);
+            }
+            pool->Release(gameObject);
+            return;
+        }
+
+        auto removed = std::remove_if(gameObjects.begin(), gameObjects.end(),
+            [gameObject](const std::unique_ptr<GameObject>& go) { return go.get() == gameObject; });
+        EngineStats::Add(StatCounter::GameObjectsDestroyed, std::distance(removed, gameObjects.end()));
+        gameObjects.erase(removed, gameObjects.end());
 
         auto it = std::find(gameObjectsToDestroy.begin(), gameObjectsToDestroy.end(), gameObject);
         if (it != gameObjectsToDestroy.end())
@@ -89,6 +547,39 @@ namespace AronEngine
         }
     }
 
+    void Scene::DestroyGameObjects(const std::vector<GameObject*>& gameObjects)
+    {
+        // Duplicates are dropped when the queue is processed
+        gameObjectsToDestroy.reserve(gameObjectsToDestroy.size() + gameObjects.size());
+        for (GameObject* go : gameObjects)
+        {
+            if (go) gameObjectsToDestroy.push_back(go);
+        }
+    }
+
+    GameObjectPool* Scene::CreatePool(const std::string& name, GameObjectPool::BuildFunction build, int prewarm)
+    {
+        MEMORY_TAG(Scene);
+
+        pools.push_back(std::make_unique<GameObjectPool>(this, name, std::move(build)));
+        GameObjectPool* pool = pools.back().get();
+        if (prewarm > 0)
+        {
+            pool->Prewarm(prewarm);
+        }
+        return pool;
+    }
+
+    GameObjectPool* Scene::FindPool(const std::string& name) const
+    {
+        for (const auto& pool : pools)
+        {
+            if (pool->GetName() == name)
+                return pool.get();
+        }
+        return nullptr;
+    }
+
     void Scene::Start()
     {
         for (auto& go : gameObjects)
@@ -102,71 +593,658 @@ namespace AronEngine
 
     void Scene::Update(float deltaTime)
     {
+        PROFILE_SCOPE("Scene::Update");
+
         ProcessDestroyQueue();
 
-        for (auto& go : gameObjects)
+        RunPhase(ComponentPhase::Update, deltaTime);
+    }
+
+    void Scene::LateUpdate(float deltaTime)
+    {
+        RunPhase(ComponentPhase::LateUpdate, deltaTime);
+    }
+
+    void Scene::FixedUpdate(float fixedDeltaTime)
+    {
+        RunPhase(ComponentPhase::FixedUpdate, fixedDeltaTime);
+    }
+
+    void Scene::RunPhase(ComponentPhase phase, float deltaTime)
+    {
+        std::vector<ComponentUpdateList>& lists = updateLists[static_cast<size_t>(phase)];
+        int64_t updated = 0;
+
+        // Components added mid-phase (new types included) start next frame; removed ones leave holes
+        iteratingUpdateLists = true;
+        const size_t typeCount = lists.size();
+        for (size_t t = 0; t < typeCount; ++t)
         {
-            if (go->IsActive())
+            const size_t count = lists[t].components.size();
+            if (count == 0) continue;
+
+            PROFILE_SCOPE(lists[t].type->name.c_str());
+            for (size_t i = 0; i < count; ++i)
             {
-                go->Update(deltaTime);
+                Component* component = lists[t].components[i];
+                if (!component) continue;
+
+                switch (phase)
+                {
+                case ComponentPhase::Update: component->OnUpdate(deltaTime); break;
+                case ComponentPhase::LateUpdate: component->OnLateUpdate(deltaTime); break;
+                default: component->OnFixedUpdate(deltaTime); break;
+                }
+                ++updated;
             }
         }
-    }
+        iteratingUpdateLists = false;
 
-    void Scene::LateUpdate(float deltaTime)
-    {
-        for (auto& go : gameObjects)
+        // Components disabled or destroyed during the phase may sit in any phase's lists
+        for (size_t p = 0; p < kComponentPhaseCount; ++p)
         {
-            if (go->IsActive())
+            for (auto& list : updateLists[p])
             {
-                go->LateUpdate(deltaTime);
+                if (!list.hasHoles) continue;
+
+                size_t write = 0;
+                for (Component* component : list.components)
+                {
+                    if (!component) continue;
+                    component->phaseSlots[p] = static_cast<int32_t>(write);
+                    list.components[write++] = component;
+                }
+                list.components.resize(write);
+                list.hasHoles = false;
             }
         }
+
+        if (phase == ComponentPhase::Update)
+        {
+            EngineStats::Add(StatCounter::ComponentsUpdated, updated);
+        }
     }
 
-    void Scene::FixedUpdate(float fixedDeltaTime)
+    void Scene::RefreshComponentUpdates(Component* component)
     {
-        for (auto& go : gameObjects)
+        const ComponentTypeInfo* type = component ? component->typeInfo : nullptr;
+        if (!type) return;
+
+        GameObject* gameObject = component->GetGameObject();
+        const bool wanted = component->IsEnabled() && gameObject && gameObject->IsActive() && gameObject->GetScene() == this;
+
+        for (size_t p = 0; p < kComponentPhaseCount; ++p)
         {
-            if (go->IsActive())
+            const ComponentPhase phase = static_cast<ComponentPhase>(p);
+            if (!type->Overrides(phase)) continue;
+
+            const bool listed = component->phaseSlots[p] >= 0;
+            if (wanted && !listed) AddToUpdateList(component, phase);
+            else if (!wanted && listed) RemoveFromUpdateList(component, phase);
+        }
+    }
+
+    void Scene::RemoveComponentUpdates(Component* component)
+    {
+        if (!component) return;
+
+        for (size_t p = 0; p < kComponentPhaseCount; ++p)
+        {
+            if (component->phaseSlots[p] >= 0)
             {
-                go->FixedUpdate(fixedDeltaTime);
+                RemoveFromUpdateList(component, static_cast<ComponentPhase>(p));
             }
         }
     }
 
+    int Scene::GetUpdateListedCount(ComponentPhase phase) const
+    {
+        size_t count = 0;
+        for (const auto& list : updateLists[static_cast<size_t>(phase)])
+        {
+            count += list.components.size();
+        }
+        return static_cast<int>(count);
+    }
+
+    void Scene::AddToUpdateList(Component* component, ComponentPhase phase)
+    {
+        std::vector<ComponentUpdateList>& lists = updateLists[static_cast<size_t>(phase)];
+        const ComponentTypeInfo* type = component->typeInfo;
+        if (lists.size() <= type->id)
+        {
+            MEMORY_TAG(Scene);
+            lists.resize(type->id + 1);
+        }
+
+        ComponentUpdateList& list = lists[type->id];
+        list.type = type;
+        component->phaseSlots[static_cast<size_t>(phase)] = static_cast<int32_t>(list.components.size());
+        list.components.push_back(component);
+    }
+
+    void Scene::RemoveFromUpdateList(Component* component, ComponentPhase phase)
+    {
+        const size_t p = static_cast<size_t>(phase);
+        ComponentUpdateList& list = updateLists[p][component->typeInfo->id];
+        const int32_t slot = component->phaseSlots[p];
+        component->phaseSlots[p] = -1;
+
+        if (iteratingUpdateLists)
+        {
+            // Order must hold until the phase finishes
+            list.components[slot] = nullptr;
+            list.hasHoles = true;
+            return;
+        }
+
+        Component* last = list.components.back();
+        if (last != component)
+        {
+            list.components[slot] = last;
+            last->phaseSlots[p] = slot;
+        }
+        list.components.pop_back();
+    }
+
     bool Scene::Save(const std::string& filePath)
     {
+        PROFILE_SCOPE("Scene::Save");
+
+        std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            DEBUG_LOG("Failed to open scene file for writing: " + filePath);
+            return false;
+        }
+
+        std::vector<GameObject*> objects;
+        objects.reserve(gameObjects.size());
+        for (const auto& go : gameObjects)
+        {
+            objects.push_back(go.get());
+        }
+
+        const bool json = filePath.size() >= 5 && filePath.compare(filePath.size() - 5, 5, ".json") == 0;
+        const bool written = json ? Serialize(file, GetName(), objects) : SerializeBinary(file, GetName(), objects);
+        if (!written)
+        {
+            DEBUG_LOG("Failed to write scene file: " + filePath);
+            return false;
+        }
+
         scenePath = filePath;
         return true;
     }
 
     bool Scene::Load(const std::string& filePath)
     {
+        return LoadFile(filePath, nullptr);
+    }
+
+    bool Scene::Convert(const std::string& sourcePath, const std::string& destinationPath)
+    {
+        Scene scene;
+        std::string sceneName;
+        if (!scene.LoadFile(sourcePath, &sceneName))
+            return false;
+
+        scene.SetName(sceneName);
+        return scene.Save(destinationPath);
+    }
+
+    bool Scene::LoadFile(const std::string& filePath, std::string* sceneName, std::atomic<float>* progress)
+    {
+        PROFILE_SCOPE("Scene::Load");
+
+        MappedFile mapped;
+        std::ifstream stream;
+        if (!mapped.Open(filePath))
+        {
+            stream.open(filePath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                DEBUG_LOG("Failed to open scene file: " + filePath);
+                return false;
+            }
+        }
+
+        // Objects go before pools, as in the destructor
+        gameObjectsToDestroy.clear();
+        gameObjects.clear();
+        pools.clear();
+        isLoaded = false;
+
+        const bool binary = mapped.IsOpen() && IsBinarySceneData(mapped.GetData(), mapped.GetSize());
+
+        // Progress is a rough fraction: bytes consumed for JSON; for binary, objects created,
+        // which covers the first half since components are attached type by type afterwards
+        uint64_t progressTotal = 0;
+        if (progress)
+        {
+            BinaryHeader header = {};
+            if (binary && mapped.GetSize() >= sizeof(header)) std::memcpy(&header, mapped.GetData(), sizeof(header));
+            progressTotal = binary ? header.objectCount : (mapped.IsOpen() ? mapped.GetSize() : 0);
+        }
+
+        uint64_t created = 0;
+        const auto create = [this, progress, progressTotal, binary, &created, &stream](const std::string& name)
+        {
+            if (progress && progressTotal > 0 && (++created & 255) == 0)
+            {
+                const double done = binary ? 0.5 * created : (std::max)(0.0, static_cast<double>(stream.tellg()));
+                progress->store(static_cast<float>((std::min)(1.0, done / progressTotal)), std::memory_order_relaxed);
+            }
+            return CreateGameObjectInternal(name);
+        };
+
+        std::string error;
+        bool loaded;
+        if (binary)
+        {
+            loaded = DeserializeBinary(mapped.GetData(), mapped.GetSize(), create, &error, sceneName);
+        }
+        else
+        {
+            // JSON streams through its own window; the mapping was only needed to sniff the header
+            mapped.Close();
+            if (!stream.is_open())
+            {
+                stream.open(filePath, std::ios::binary);
+            }
+            loaded = stream.is_open() && Deserialize(stream, create, &error, sceneName);
+        }
+
+        if (!loaded)
+        {
+            DEBUG_LOG("Failed to load scene " + filePath + ": " + error);
+            gameObjects.clear();
+            return false;
+        }
+
+        if (progress) progress->store(1.0f, std::memory_order_relaxed);
         scenePath = filePath;
         isLoaded = true;
         return true;
     }
 
+    void Scene::FinishStaging()
+    {
+        staged = false;
+        for (auto& go : gameObjects)
+        {
+            if (go->IsActive())
+            {
+                go->OnEnable();
+            }
+        }
+    }
+
+    void Scene::MoveGameObjectsTo(Scene& target)
+    {
+        const size_t first = target.gameObjects.size();
+        target.gameObjects.reserve(first + gameObjects.size());
+        for (auto& go : gameObjects)
+        {
+            go->SetScene(&target);
+            target.gameObjects.push_back(std::move(go));
+        }
+        gameObjects.clear();
+
+        if (target.isLoaded)
+        {
+            for (size_t i = first; i < target.gameObjects.size(); ++i)
+            {
+                if (target.gameObjects[i]->IsActive())
+                {
+                    target.gameObjects[i]->Start();
+                }
+            }
+        }
+    }
+
+    bool Scene::Serialize(std::ostream& output, const std::string& sceneName, const std::vector<GameObject*>& objects)
+    {
+        JsonWriter writer(output);
+        writer.BeginObject();
+        writer.Write("version", kSceneFileVersion);
+        writer.Write("name", sceneName);
+        writer.BeginArray("gameObjects");
+        for (const SavedObject& saved : CollectSaveOrder(objects))
+        {
+            WriteGameObject(writer, saved.gameObject, saved.parent);
+        }
+        writer.EndArray();
+        writer.EndObject();
+        writer.Flush();
+        return writer.Good();
+    }
+
+    bool Scene::Deserialize(std::istream& input, const CreateFunction& create, std::string* error, std::string* sceneName)
+    {
+        RegisterBuiltInComponents();
+
+        JsonReader reader(input);
+        SceneFileReader sceneReader(reader, create, sceneName);
+        if (sceneReader.ReadScene())
+            return true;
+
+        if (error)
+        {
+            *error = reader.HasError() ? reader.GetError() : "malformed scene file";
+        }
+        return false;
+    }
+
+    bool Scene::SerializeBinary(std::ostream& output, const std::string& sceneName, const std::vector<GameObject*>& objects)
+    {
+        const std::vector<SavedObject> order = CollectSaveOrder(objects);
+
+        BinaryStringTable strings;
+        BinaryHeader header = {};
+        std::memcpy(header.magic, kBinaryMagic, sizeof(kBinaryMagic));
+        header.version = kBinaryVersion;
+        header.sceneName = strings.Add(sceneName);
+        header.objectCount = static_cast<uint32_t>(order.size());
+
+        std::vector<BinaryObject> records(order.size());
+        std::vector<BinaryBlockBuilder> blocks;
+        std::unordered_map<const ComponentTypeInfo*, size_t> blockIndices;
+
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            const GameObject* go = order[i].gameObject;
+            const Transform* transform = go->GetTransform();
+
+            BinaryObject& record = records[i];
+            record.name = strings.Add(go->GetName());
+            record.tag = strings.Add(go->GetTag());
+            record.layer = go->GetLayer();
+            record.parent = order[i].parent;
+            record.position[0] = transform->GetLocalPosition().x;
+            record.position[1] = transform->GetLocalPosition().y;
+            record.rotation = transform->GetLocalRotation();
+            record.scale[0] = transform->GetLocalScale().x;
+            record.scale[1] = transform->GetLocalScale().y;
+            record.flags = go->IsActive() ? kObjectActive : 0;
+            record.stableId = go->GetStableId();
+
+            for (const auto& component : go->GetAllComponents())
+            {
+                // Types the loader cannot construct by name would only be skipped on the way back in
+                const ComponentTypeInfo* type = component->GetTypeInfo();
+                if (!type || !type->create) continue;
+
+                // Blocks are ordered by first use, which keeps each object's component order
+                // for the usual case of objects sharing a layout
+                auto found = blockIndices.emplace(type, blocks.size());
+                if (found.second)
+                {
+                    blocks.push_back({ type, {}, std::make_unique<BinaryWriter>(strings) });
+                }
+
+                BinaryBlockBuilder& block = blocks[found.first->second];
+                block.owners.push_back(static_cast<uint32_t>(i));
+                component->WriteBinary(*block.data);
+            }
+        }
+
+        std::vector<BinaryBlock> blockRecords(blocks.size());
+        for (size_t b = 0; b < blocks.size(); ++b)
+        {
+            blockRecords[b].typeName = strings.Add(blocks[b].type->name);
+        }
+
+        // Every string is interned by now, so the layout is fixed
+        std::vector<uint32_t> stringOffsets(strings.GetCount() + 1);
+        for (uint32_t s = 0; s < strings.GetCount(); ++s)
+        {
+            stringOffsets[s + 1] = stringOffsets[s] + static_cast<uint32_t>(strings.Get(s).size());
+        }
+
+        header.stringCount = static_cast<uint32_t>(strings.GetCount());
+        header.blockCount = static_cast<uint32_t>(blocks.size());
+
+        uint64_t position = sizeof(BinaryHeader);
+        header.stringOffsets = position;
+        position += stringOffsets.size() * sizeof(uint32_t);
+        header.stringData = position;
+        position += stringOffsets.back();
+        position += (8 - position % 8) % 8;
+        header.objects = position;
+        position += records.size() * sizeof(BinaryObject);
+        header.blocks = position;
+        position += blockRecords.size() * sizeof(BinaryBlock);
+        for (size_t b = 0; b < blocks.size(); ++b)
+        {
+            position += (8 - position % 8) % 8;
+            blockRecords[b].offset = position;
+            blockRecords[b].count = static_cast<uint32_t>(blocks[b].owners.size());
+            blockRecords[b].size = blocks[b].owners.size() * sizeof(uint32_t) + blocks[b].data->GetSize();
+            position += blockRecords[b].size;
+        }
+
+        position = 0;
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(stringOffsets.data()), static_cast<std::streamsize>(stringOffsets.size() * sizeof(uint32_t)));
+        for (uint32_t s = 0; s < strings.GetCount(); ++s)
+        {
+            output.write(strings.Get(s).data(), static_cast<std::streamsize>(strings.Get(s).size()));
+        }
+        position = header.stringData + stringOffsets.back();
+        WritePadding(output, position);
+
+        output.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(BinaryObject)));
+        output.write(reinterpret_cast<const char*>(blockRecords.data()), static_cast<std::streamsize>(blockRecords.size() * sizeof(BinaryBlock)));
+        position = header.blocks + blockRecords.size() * sizeof(BinaryBlock);
+
+        for (size_t b = 0; b < blocks.size(); ++b)
+        {
+            WritePadding(output, position);
+            const std::vector<uint32_t>& owners = blocks[b].owners;
+            const std::vector<char>& data = blocks[b].data->GetBuffer();
+            output.write(reinterpret_cast<const char*>(owners.data()), static_cast<std::streamsize>(owners.size() * sizeof(uint32_t)));
+            output.write(data.data(), static_cast<std::streamsize>(data.size()));
+            position += blockRecords[b].size;
+        }
+
+        output.flush();
+        return output.good();
+    }
+
+    bool Scene::IsBinarySceneData(const char* data, size_t size)
+    {
+        return data && size >= sizeof(kBinaryMagic) && std::memcmp(data, kBinaryMagic, sizeof(kBinaryMagic)) == 0;
+    }
+
+    bool Scene::DeserializeBinary(const char* data, size_t size, const CreateFunction& create, std::string* error, std::string* sceneName)
+    {
+        RegisterBuiltInComponents();
+
+        BinaryHeader header;
+        if (!IsBinarySceneData(data, size) || size < sizeof(header))
+            return FailBinary(error, "not a binary scene file");
+
+        std::memcpy(&header, data, sizeof(header));
+        if (header.version > kBinaryVersion)
+            return FailBinary(error, "scene file version is newer than this build");
+
+        const size_t objectSize = header.version >= 2 ? sizeof(BinaryObject) : kBinaryObjectSizeV1;
+        if (!InFile(header.stringOffsets, static_cast<uint64_t>(header.stringCount) + 1, sizeof(uint32_t), size)
+            || !InFile(header.objects, header.objectCount, objectSize, size)
+            || !InFile(header.blocks, header.blockCount, sizeof(BinaryBlock), size))
+        {
+            return FailBinary(error, "truncated scene file");
+        }
+
+        // Views straight into the mapping; only object names and tags get copied out
+        std::vector<std::string_view> strings(header.stringCount);
+        {
+            std::vector<uint32_t> offsets(header.stringCount + 1);
+            std::memcpy(offsets.data(), data + header.stringOffsets, offsets.size() * sizeof(uint32_t));
+            if (!InFile(header.stringData, offsets.back(), 1, size))
+                return FailBinary(error, "truncated string table");
+
+            for (uint32_t s = 0; s < header.stringCount; ++s)
+            {
+                if (offsets[s] > offsets[s + 1] || offsets[s + 1] > offsets.back())
+                    return FailBinary(error, "corrupt string table");
+                strings[s] = std::string_view(data + header.stringData + offsets[s], offsets[s + 1] - offsets[s]);
+            }
+        }
+        if (header.sceneName >= header.stringCount)
+            return FailBinary(error, "corrupt scene name");
+        if (sceneName) sceneName->assign(strings[header.sceneName].data(), strings[header.sceneName].size());
+
+        std::vector<GameObject*> created(header.objectCount);
+        std::string text;
+        for (uint32_t i = 0; i < header.objectCount; ++i)
+        {
+            BinaryObject record = {};
+            std::memcpy(&record, data + header.objects + i * objectSize, objectSize);
+            if (record.name >= header.stringCount || record.tag >= header.stringCount)
+                return FailBinary(error, "object " + std::to_string(i) + ": bad string index");
+            if (record.parent < -1 || record.parent >= static_cast<int32_t>(i))
+                return FailBinary(error, "object " + std::to_string(i) + ": parent must refer to an earlier game object");
+
+            text.assign(strings[record.name].data(), strings[record.name].size());
+            GameObject* go = create(text);
+            if (!go)
+                return FailBinary(error, "could not create game object");
+            created[i] = go;
+
+            text.assign(strings[record.tag].data(), strings[record.tag].size());
+            go->SetTag(text);
+            go->SetLayer(record.layer);
+            go->SetActive((record.flags & kObjectActive) != 0);
+            go->SetStableId(record.stableId);
+
+            // Parenting keeps the world position, so the saved local values go on afterwards
+            if (record.parent >= 0)
+            {
+                go->SetParent(created[record.parent]);
+            }
+            Transform* transform = go->GetTransform();
+            transform->SetLocalPosition(Vector2(record.position[0], record.position[1]));
+            transform->SetLocalRotation(record.rotation);
+            transform->SetLocalScale(Vector2(record.scale[0], record.scale[1]));
+        }
+
+        for (uint32_t b = 0; b < header.blockCount; ++b)
+        {
+            BinaryBlock block;
+            std::memcpy(&block, data + header.blocks + b * sizeof(BinaryBlock), sizeof(block));
+            if (block.typeName >= header.stringCount || !InFile(block.offset, block.size, 1, size)
+                || static_cast<uint64_t>(block.count) * sizeof(uint32_t) > block.size)
+            {
+                return FailBinary(error, "block " + std::to_string(b) + ": corrupt block record");
+            }
+
+            const std::string typeName(strings[block.typeName]);
+            const ComponentTypeInfo* type = ComponentRegistry::Find(typeName);
+            if (!type || !type->create)
+            {
+                DEBUG_LOG("Scene file: skipping unknown component type '" + typeName + "'");
+                continue;
+            }
+
+            const char* owners = data + block.offset;
+            const size_t ownersSize = block.count * sizeof(uint32_t);
+            BinaryReader reader(owners + ownersSize, static_cast<size_t>(block.size) - ownersSize, strings.data(), strings.size());
+            for (uint32_t c = 0; c < block.count; ++c)
+            {
+                uint32_t owner = 0;
+                std::memcpy(&owner, owners + c * sizeof(uint32_t), sizeof(owner));
+                if (owner >= header.objectCount)
+                    return FailBinary(error, typeName + ": bad owner index");
+
+                // One allocation and a field-by-field copy per component; see DeserializeBinary in Scene.h
+                std::unique_ptr<Component> component(type->create());
+                if (!component->ReadBinary(reader))
+                    return FailBinary(error, typeName + ": component data is truncated or corrupt");
+                created[owner]->AttachComponent(std::move(component), type);
+            }
+
+            // A leftover means the writer had more fields than this build reads
+            if (reader.GetRemaining() != 0)
+                return FailBinary(error, typeName + ": component data does not match this build");
+        }
+
+        return true;
+    }
+
     void Scene::ProcessDestroyQueue()
     {
         if (gameObjectsToDestroy.empty())
             return;
 
-        for (auto* go : gameObjectsToDestroy)
+        // Detached so destroy hooks that queue more objects land in next frame's batch
+        std::vector<GameObject*> queue;
+        queue.swap(gameObjectsToDestroy);
+
+        if (queue.size() == 1)
         {
-            DestroyGameObjectImmediate(go);
+            DestroyGameObjectImmediate(queue.front());
+        }
+        else
+        {
+            // One sweep of the object list for the whole batch instead of one per object
+            std::unordered_set<GameObject*> doomed;
+            doomed.reserve(queue.size());
+            for (auto* go : queue)
+            {
+                if (GameObjectPool* pool = go->GetPool())
+                {
+                    pool->Release(go);
+                }
+                else
+                {
+                    doomed.insert(go);
+                }
+            }
+
+            if (!doomed.empty())
+            {
+                auto removed = std::remove_if(gameObjects.begin(), gameObjects.end(),
+                    [&doomed](const std::unique_ptr<GameObject>& go) { return doomed.count(go.get()) != 0; });
+                EngineStats::Add(StatCounter::GameObjectsDestroyed, std::distance(removed, gameObjects.end()));
+                gameObjects.erase(removed, gameObjects.end());
+            }
+        }
+
+        // Hand the storage back so a steady stream of destroys doesn't reallocate every frame
+        if (gameObjectsToDestroy.empty())
+        {
+            queue.clear();
+            gameObjectsToDestroy.swap(queue);
+        }
+    }
+
+    void Scene::RegisterStableId(GameObject* gameObject)
+    {
+        objectsByStableId[gameObject->GetStableId()] = gameObject;
+    }
+
+    void Scene::UnregisterStableId(GameObject* gameObject)
+    {
+        auto it = objectsByStableId.find(gameObject->GetStableId());
+        if (it != objectsByStableId.end() && it->second == gameObject)
+        {
+            objectsByStableId.erase(it);
         }
-        gameObjectsToDestroy.clear();
     }
 
     GameObject* Scene::CreateGameObjectInternal(const std::string& name)
     {
+        MEMORY_TAG(Scene);
+
         auto gameObject = std::make_unique<GameObject>(name);
         gameObject->SetScene(this);
         
         GameObject* ptr = gameObject.get();
         gameObjects.push_back(std::move(gameObject));
+
+        EngineStats::Add(StatCounter::GameObjectsCreated);
         
         return ptr;
     }
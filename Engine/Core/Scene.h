@@ -1,22 +1,51 @@
 #pragma once
 #include "framework.h"
 #include "Object.h"
+#include "../Components/Component.h"
+#include "GameObjectPool.h"
+#include <atomic>
+#include <functional>
+#include <iosfwd>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
 namespace AronEngine
 {
     class GameObject;
+    struct ComponentTypeInfo;
+    class SceneLoadOperation;
+    class SceneManager;
+    class WorldPartition;
 
     class Scene : public Object
     {
         DECLARE_OBJECT_TYPE(Scene)
 
+        friend class SceneLoadOperation;
+        friend class SceneManager;
+        friend class WorldPartition;
+        friend class GameObject;
+
     private:
+        // Enabled components of one type that override one phase's hook
+        struct ComponentUpdateList
+        {
+            const ComponentTypeInfo* type = nullptr;
+            std::vector<Component*> components;     // null holes while iterating, compacted after
+            bool hasHoles = false;
+        };
+
         std::vector<std::unique_ptr<GameObject>> gameObjects;
         std::vector<GameObject*> gameObjectsToDestroy;
+        std::unordered_map<uint64_t, GameObject*> objectsByStableId;
+        std::vector<std::unique_ptr<GameObjectPool>> pools;
+        // Indexed by ComponentTypeInfo::id, walked type by type
+        std::vector<ComponentUpdateList> updateLists[kComponentPhaseCount];
+        bool iteratingUpdateLists;
         bool isLoaded;
+        bool staged;    // being built by a loader thread; components hold off OnEnable
         std::string scenePath;
 
     public:
@@ -28,9 +57,20 @@ namespace AronEngine
         GameObject* FindGameObject(const std::string& name) const;
         GameObject* FindGameObjectWithTag(const std::string& tag) const;
         std::vector<GameObject*> FindGameObjectsWithTag(const std::string& tag) const;
+        // Objects with a stable ID are indexed as they join the scene. IDs are meant to be
+        // unique; if two objects share one, the later arrival is found.
+        GameObject* FindGameObjectByStableId(uint64_t id) const;
 
+        // Pooled instances are released to their pool instead of destroyed
         void DestroyGameObject(GameObject* gameObject);
         void DestroyGameObjectImmediate(GameObject* gameObject);
+        // Queues many at once, e.g. a streamed-out cell; the queue is processed in one pass
+        void DestroyGameObjects(const std::vector<GameObject*>& gameObjects);
+
+        // The pool lives as long as the scene; prewarm builds that many inactive instances now
+        GameObjectPool* CreatePool(const std::string& name, GameObjectPool::BuildFunction build, int prewarm = 0);
+        GameObjectPool* FindPool(const std::string& name) const;
+        const std::vector<std::unique_ptr<GameObjectPool>>& GetPools() const { return pools; }
 
         const std::vector<std::unique_ptr<GameObject>>& GetGameObjects() const { return gameObjects; }
         int GetGameObjectCount() const { return static_cast<int>(gameObjects.size()); }
@@ -40,17 +80,61 @@ namespace AronEngine
         void LateUpdate(float deltaTime);
         void FixedUpdate(float fixedDeltaTime);
 
+        // Adds or removes the component from the per-type lists to match its enabled/active state
+        void RefreshComponentUpdates(Component* component);
+        void RemoveComponentUpdates(Component* component);
+        // Components currently listed for phase, across all types
+        int GetUpdateListedCount(ComponentPhase phase) const;
+
         bool IsLoaded() const { return isLoaded; }
+        // Built off the main thread and not yet handed to the SceneManager
+        bool IsStaged() const { return staged; }
         void SetLoaded(bool loaded) { isLoaded = loaded; }
 
         const std::string& GetScenePath() const { return scenePath; }
         void SetScenePath(const std::string& path) { scenePath = path; }
 
+        // Scene files hold a flat object list, parents before children, each with its transform
+        // and components keyed by registered type name. Paths ending in .json are written as
+        // JSON; anything else gets the binary format, which holds the same data.
         bool Save(const std::string& filePath);
+        // Replaces this scene's objects and pools; the format is detected from the file itself.
+        // On failure the scene is left empty.
         bool Load(const std::string& filePath);
+        // Rewrites a scene file, converting by the destination's extension. Goes through a
+        // temporary scene, so the engine systems must be up as for Load.
+        static bool Convert(const std::string& sourcePath, const std::string& destinationPath);
+
+        // The file formats on their own, for the editor's objects that live outside a scene.
+        // Objects owned by a GameObjectPool are runtime state and are not written.
+        using CreateFunction = std::function<GameObject*(const std::string& name)>;
+        static bool Serialize(std::ostream& output, const std::string& sceneName, const std::vector<GameObject*>& objects);
+        static bool Deserialize(std::istream& input, const CreateFunction& create, std::string* error = nullptr,
+            std::string* sceneName = nullptr);
+        static bool SerializeBinary(std::ostream& output, const std::string& sceneName, const std::vector<GameObject*>& objects);
+        // data is the whole file, usually a MappedFile view. Records and component blocks are
+        // read in place, but components are not bulk-constructed from their block: each one is
+        // still create()d on the heap and fills itself with ReadBinary. Components are polymorphic
+        // and hold strings and shared resources, so a block's bytes can't simply become objects.
+        // ReadBinary does no text parsing or key lookup, just one bounds-checked copy per field,
+        // so what each component still costs is an allocation, a virtual call and those copies.
+        static bool DeserializeBinary(const char* data, size_t size, const CreateFunction& create, std::string* error = nullptr,
+            std::string* sceneName = nullptr);
+        static bool IsBinarySceneData(const char* data, size_t size);
 
     private:
+        // progress, when given, gets a rough 0..1 fraction as objects are read
+        bool LoadFile(const std::string& filePath, std::string* sceneName, std::atomic<float>* progress = nullptr);
+        // Main thread, once the loader thread is done: runs the OnEnable calls staging skipped
+        void FinishStaging();
+        // Hands every object to target (additive loading), starting them if target already runs
+        void MoveGameObjectsTo(Scene& target);
         void ProcessDestroyQueue();
+        void RunPhase(ComponentPhase phase, float deltaTime);
+        void AddToUpdateList(Component* component, ComponentPhase phase);
+        void RemoveFromUpdateList(Component* component, ComponentPhase phase);
         GameObject* CreateGameObjectInternal(const std::string& name);
+        void RegisterStableId(GameObject* gameObject);
+        void UnregisterStableId(GameObject* gameObject);
     };
 }
\ No newline at end of file
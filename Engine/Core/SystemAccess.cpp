@@ -0,0 +1,134 @@
+#include "framework.h"
+#include "SystemAccess.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        struct RegistryState
+        {
+            std::mutex mutex;
+            std::string names[AccessTypeRegistry::kMaxTypes];
+            std::atomic<uint32_t> count{ 0 };
+        };
+
+        RegistryState& GetRegistry()
+        {
+            static RegistryState registry;
+            return registry;
+        }
+
+        // "class AronEngine::Transform" -> "Transform"
+        std::string TrimTypeName(const char* name)
+        {
+            std::string trimmed = name;
+            const size_t space = trimmed.rfind(' ');
+            if (space != std::string::npos) trimmed = trimmed.substr(space + 1);
+            const size_t scope = trimmed.rfind("::");
+            if (scope != std::string::npos) trimmed = trimmed.substr(scope + 2);
+            return trimmed;
+        }
+
+        struct ThreadContext
+        {
+            const char* system = nullptr;
+            const SystemAccess* access = nullptr;
+        };
+
+        thread_local ThreadContext t_context;
+    }
+
+    std::atomic<bool> SystemAccessValidator::s_enabled{ false };
+    std::mutex SystemAccessValidator::s_mutex;
+    std::vector<SystemAccessViolation> SystemAccessValidator::s_violations;
+
+    uint32_t AccessTypeRegistry::Register(const char* name)
+    {
+        RegistryState& registry = GetRegistry();
+        const std::string trimmed = TrimTypeName(name);
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const uint32_t count = registry.count.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (registry.names[i] == trimmed) return i;
+        }
+
+        if (count >= kMaxTypes)
+        {
+            DEBUG_LOG("Too many system access types, sharing a bit: " + trimmed);
+            return kMaxTypes - 1;
+        }
+
+        registry.names[count] = trimmed;
+        registry.count.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    const char* AccessTypeRegistry::GetName(uint32_t id)
+    {
+        RegistryState& registry = GetRegistry();
+        return id < registry.count.load(std::memory_order_acquire) ? registry.names[id].c_str() : "Unknown";
+    }
+
+    uint32_t AccessTypeRegistry::GetCount()
+    {
+        return GetRegistry().count.load(std::memory_order_acquire);
+    }
+
+    std::string AccessTypeRegistry::Describe(AccessMask mask)
+    {
+        std::string text;
+        for (uint32_t i = 0; i < kMaxTypes; ++i)
+        {
+            if (!(mask & (AccessMask(1) << i))) continue;
+            if (!text.empty()) text += ", ";
+            text += GetName(i);
+        }
+        return text;
+    }
+
+    void SystemAccessValidator::Enter(const char* system, const SystemAccess* access)
+    {
+        t_context.system = system;
+        t_context.access = access;
+    }
+
+    void SystemAccessValidator::Exit()
+    {
+        t_context = ThreadContext();
+    }
+
+    void SystemAccessValidator::CheckSlow(uint32_t typeId, bool write)
+    {
+        // Outside any scheduled system everything is allowed
+        const ThreadContext& context = t_context;
+        if (!context.access || context.access->Allows(typeId, write)) return;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (auto& violation : s_violations)
+        {
+            if (violation.typeId == typeId && violation.write == write && violation.system == context.system)
+            {
+                ++violation.count;
+                return;
+            }
+        }
+
+        s_violations.push_back({ context.system, typeId, write, 1 });
+        DEBUG_LOG(std::string("System '") + context.system + "' " + (write ? "wrote " : "read ")
+            + AccessTypeRegistry::GetName(typeId) + " without declaring it");
+    }
+
+    std::vector<SystemAccessViolation> SystemAccessValidator::GetViolations()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        return s_violations;
+    }
+
+    void SystemAccessValidator::ClearViolations()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_violations.clear();
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include "framework.h"
+#include <atomic>
+#include <mutex>
+#include <typeinfo>
+
+// Set AE_SYSTEM_VALIDATION to 0 to compile the access checks out of component accessors
+#ifndef AE_SYSTEM_VALIDATION
+#define AE_SYSTEM_VALIDATION 1
+#endif
+
+#if AE_SYSTEM_VALIDATION
+// Reports the access if the running scheduled system didn't declare it (validation mode only)
+#define SYSTEM_ACCESS_READ(Type) ::AronEngine::SystemAccessValidator::Check(::AronEngine::GetAccessTypeId<Type>(), false)
+#define SYSTEM_ACCESS_WRITE(Type) ::AronEngine::SystemAccessValidator::Check(::AronEngine::GetAccessTypeId<Type>(), true)
+#else
+#define SYSTEM_ACCESS_READ(Type)
+#define SYSTEM_ACCESS_WRITE(Type)
+#endif
+
+namespace AronEngine
+{
+    // One bit per registered component type or named resource
+    using AccessMask = uint64_t;
+
+    class AccessTypeRegistry
+    {
+    public:
+        static constexpr uint32_t kMaxTypes = 64;
+
+        // Same name, same id. Past kMaxTypes every name shares the last bit.
+        static uint32_t Register(const char* name);
+        static const char* GetName(uint32_t id);
+        static uint32_t GetCount();
+
+        // Comma-separated names of the set bits
+        static std::string Describe(AccessMask mask);
+    };
+
+    // Component types are keyed by their unqualified class name
+    template<typename T>
+    uint32_t GetAccessTypeId()
+    {
+        static const uint32_t id = AccessTypeRegistry::Register(typeid(T).name());
+        return id;
+    }
+
+    // What a scheduled system touches. Two systems conflict when one writes what the other
+    // reads or writes; conflicting systems keep their registration order.
+    // Transform rebuilds its world matrix lazily on read, so parallel readers of a dirty
+    // Transform still race; declare Write<Transform> if a system may be the first reader.
+    struct SystemAccess
+    {
+        AccessMask reads = 0;
+        AccessMask writes = 0;
+        bool exclusive = false;     // conflicts with every other system (user callbacks, scene updates)
+        bool mainThread = false;    // never moved to a worker thread
+
+        template<typename T> SystemAccess& Read() { reads |= AccessMask(1) << GetAccessTypeId<T>(); return *this; }
+        template<typename T> SystemAccess& Write() { writes |= AccessMask(1) << GetAccessTypeId<T>(); return *this; }
+        // Shared state that isn't a component, e.g. "RenderQueue"
+        SystemAccess& Read(const char* resource) { reads |= AccessMask(1) << AccessTypeRegistry::Register(resource); return *this; }
+        SystemAccess& Write(const char* resource) { writes |= AccessMask(1) << AccessTypeRegistry::Register(resource); return *this; }
+        SystemAccess& Exclusive() { exclusive = true; return *this; }
+        SystemAccess& MainThread() { mainThread = true; return *this; }
+
+        bool ConflictsWith(const SystemAccess& other) const
+        {
+            if (exclusive || other.exclusive) return true;
+            return (writes & (other.reads | other.writes)) != 0 || (other.writes & reads) != 0;
+        }
+
+        bool Allows(uint32_t typeId, bool write) const
+        {
+            if (exclusive) return true;
+            const AccessMask bit = AccessMask(1) << typeId;
+            return write ? (writes & bit) != 0 : ((reads | writes) & bit) != 0;
+        }
+    };
+
+    struct SystemAccessViolation
+    {
+        std::string system;
+        uint32_t typeId;
+        bool write;
+        uint64_t count;
+    };
+
+    // Validation mode: while a scheduled system runs, component accessors compare what they touch
+    // against its declaration and record anything undeclared. Off by default.
+    class SystemAccessValidator
+    {
+    private:
+        static std::atomic<bool> s_enabled;
+        static std::mutex s_mutex;
+        static std::vector<SystemAccessViolation> s_violations;
+
+    public:
+        static void SetEnabled(bool enable) { s_enabled.store(enable, std::memory_order_relaxed); }
+        static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+        static void Check(uint32_t typeId, bool write)
+        {
+            if (IsEnabled()) CheckSlow(typeId, write);
+        }
+
+        // Scheduler only: marks the calling thread as running the named system
+        static void Enter(const char* system, const SystemAccess* access);
+        static void Exit();
+
+        static std::vector<SystemAccessViolation> GetViolations();
+        static void ClearViolations();
+
+    private:
+        static void CheckSlow(uint32_t typeId, bool write);
+    };
+}
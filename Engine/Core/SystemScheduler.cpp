@@ -0,0 +1,222 @@
+#include "framework.h"
+#include "SystemScheduler.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <chrono>
+#include <unordered_set>
+
+namespace AronEngine
+{
+    namespace
+    {
+        const char* InternName(const std::string& name)
+        {
+            static std::mutex mutex;
+            static std::unordered_set<std::string> names;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            return names.insert(name).first->c_str();
+        }
+    }
+
+    SystemScheduler::SystemScheduler()
+        : levelCount(0)
+        , parallel(true)
+        , frameDeltaTime(0.0f)
+        , frameCounter(nullptr)
+        , remaining(0)
+    {
+    }
+
+    SystemScheduler::~SystemScheduler()
+    {
+    }
+
+    int SystemScheduler::AddSystem(const std::string& name, const SystemAccess& access, UpdateFunction update)
+    {
+        auto system = std::make_unique<SystemInfo>();
+        system->name = name;
+        system->profileName = InternName(name);
+        system->access = access;
+        system->update = std::move(update);
+        systems.push_back(std::move(system));
+        return static_cast<int>(systems.size()) - 1;
+    }
+
+    void SystemScheduler::SetSystemEnabled(const std::string& name, bool enabled)
+    {
+        for (auto& system : systems)
+        {
+            if (system->name == name)
+            {
+                system->enabled = enabled;
+                return;
+            }
+        }
+        DEBUG_LOG("Unknown system: " + name);
+    }
+
+    void SystemScheduler::Update(float deltaTime)
+    {
+        PROFILE_SCOPE("SystemScheduler::Update");
+
+        BuildGraph();
+
+        frameDeltaTime = deltaTime;
+        if (parallel && JobSystem::GetInstance().GetThreadCount() > 1 && JobSystem::GetCurrentWorkerIndex() == 0)
+        {
+            RunParallel();
+        }
+        else
+        {
+            RunSequential();
+        }
+    }
+
+    void SystemScheduler::BuildGraph()
+    {
+        edges.clear();
+        levelCount = 0;
+
+        for (size_t i = 0; i < systems.size(); ++i)
+        {
+            SystemInfo& system = *systems[i];
+            system.successors.clear();
+            system.dependencyCount = 0;
+            system.level = 0;
+            system.lastThread = -1;
+            if (!system.enabled) continue;
+
+            for (size_t j = 0; j < i; ++j)
+            {
+                SystemInfo& earlier = *systems[j];
+                if (!earlier.enabled || !earlier.access.ConflictsWith(system.access)) continue;
+
+                Edge edge;
+                edge.from = static_cast<int>(j);
+                edge.to = static_cast<int>(i);
+                edge.conflict = (earlier.access.writes & (system.access.reads | system.access.writes))
+                    | (system.access.writes & earlier.access.reads);
+                edges.push_back(edge);
+
+                earlier.successors.push_back(static_cast<int>(i));
+                ++system.dependencyCount;
+                system.level = (std::max)(system.level, earlier.level + 1);
+            }
+
+            levelCount = (std::max)(levelCount, system.level + 1);
+        }
+    }
+
+    void SystemScheduler::RunSequential()
+    {
+        for (size_t i = 0; i < systems.size(); ++i)
+        {
+            if (systems[i]->enabled)
+            {
+                RunSystem(static_cast<int>(i));
+            }
+        }
+    }
+
+    void SystemScheduler::RunParallel()
+    {
+        JobSystem& jobs = JobSystem::GetInstance();
+        JobCounter counter;
+        frameCounter = &counter;
+
+        int enabledCount = 0;
+        for (auto& system : systems)
+        {
+            if (!system->enabled) continue;
+            system->pending.store(system->dependencyCount, std::memory_order_relaxed);
+            ++enabledCount;
+        }
+        remaining.store(enabledCount, std::memory_order_release);
+
+        for (size_t i = 0; i < systems.size(); ++i)
+        {
+            if (systems[i]->enabled && systems[i]->dependencyCount == 0)
+            {
+                Launch(static_cast<int>(i));
+            }
+        }
+
+        // The calling thread runs the main-thread systems and helps with the rest
+        while (remaining.load(std::memory_order_acquire) > 0)
+        {
+            int index = -1;
+            {
+                std::lock_guard<std::mutex> lock(mainThreadMutex);
+                if (!mainThreadReady.empty())
+                {
+                    index = mainThreadReady.back();
+                    mainThreadReady.pop_back();
+                }
+            }
+
+            if (index >= 0)
+            {
+                RunSystem(index);
+                CompleteSystem(index);
+            }
+            else if (!jobs.ExecuteOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        jobs.Wait(counter);
+        frameCounter = nullptr;
+    }
+
+    void SystemScheduler::Launch(int index)
+    {
+        if (systems[index]->access.mainThread)
+        {
+            std::lock_guard<std::mutex> lock(mainThreadMutex);
+            mainThreadReady.push_back(index);
+            return;
+        }
+
+        JobSystem::GetInstance().Run(&SystemScheduler::SystemJob, this,
+            static_cast<uint32_t>(index), static_cast<uint32_t>(index) + 1, frameCounter);
+    }
+
+    void SystemScheduler::SystemJob(void* data, uint32_t begin, uint32_t end)
+    {
+        SystemScheduler* scheduler = static_cast<SystemScheduler*>(data);
+        const int index = static_cast<int>(begin);
+        scheduler->RunSystem(index);
+        scheduler->CompleteSystem(index);
+    }
+
+    void SystemScheduler::RunSystem(int index)
+    {
+        SystemInfo& system = *systems[index];
+        if (!system.update) return;
+
+        PROFILE_SCOPE(system.profileName);
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        SystemAccessValidator::Enter(system.name.c_str(), &system.access);
+        system.update(frameDeltaTime);
+        SystemAccessValidator::Exit();
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        system.lastMs = std::chrono::duration<float, std::milli>(end - start).count();
+        system.lastThread = JobSystem::GetCurrentWorkerIndex();
+    }
+
+    void SystemScheduler::CompleteSystem(int index)
+    {
+        for (int successor : systems[index]->successors)
+        {
+            if (systems[successor]->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Launch(successor);
+            }
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "framework.h"
+#include "SystemAccess.h"
+#include <functional>
+
+namespace AronEngine
+{
+    struct JobCounter;
+
+    // Runs per-frame systems from their declared component access. Every frame it links each
+    // system to the earlier systems it conflicts with and launches a system on the job system
+    // as soon as those have finished, so independent systems overlap.
+    class SystemScheduler
+    {
+    public:
+        using UpdateFunction = std::function<void(float deltaTime)>;
+
+        struct SystemInfo
+        {
+            std::string name;
+            const char* profileName = nullptr;  // interned; profiler zones outlive the scheduler
+            SystemAccess access;
+            UpdateFunction update;
+            bool enabled = true;
+
+            // Graph, rebuilt every frame
+            std::vector<int> successors;
+            int dependencyCount = 0;
+            int level = 0;              // longest dependency chain from a root
+
+            // Last frame
+            std::atomic<int> pending{ 0 };
+            float lastMs = 0.0f;
+            int lastThread = -1;        // job worker index, -1 when not run
+        };
+
+        struct Edge
+        {
+            int from;
+            int to;
+            AccessMask conflict;        // types both touch with at least one write; 0 if exclusive
+        };
+
+    private:
+        std::vector<std::unique_ptr<SystemInfo>> systems;
+        std::vector<Edge> edges;
+        int levelCount;
+        bool parallel;
+
+        // Per-frame run state
+        float frameDeltaTime;
+        JobCounter* frameCounter;
+        std::atomic<int> remaining;
+        std::mutex mainThreadMutex;
+        std::vector<int> mainThreadReady;
+
+    public:
+        SystemScheduler();
+        ~SystemScheduler();
+
+        // Registration order is the order conflicting systems run in. Returns the system index.
+        int AddSystem(const std::string& name, const SystemAccess& access, UpdateFunction update);
+        void SetSystemEnabled(const std::string& name, bool enabled);
+
+        void Update(float deltaTime);
+
+        // Off: every system runs on the calling thread in registration order
+        void SetParallel(bool enable) { parallel = enable; }
+        bool IsParallel() const { return parallel; }
+
+        int GetSystemCount() const { return static_cast<int>(systems.size()); }
+        const SystemInfo& GetSystem(int index) const { return *systems[index]; }
+        const std::vector<Edge>& GetEdges() const { return edges; }
+        int GetLevelCount() const { return levelCount; }
+
+    private:
+        void BuildGraph();
+        void RunSequential();
+        void RunParallel();
+        void Launch(int index);
+        void RunSystem(int index);
+        void CompleteSystem(int index);
+
+        static void SystemJob(void* data, uint32_t begin, uint32_t end);
+    };
+}
@@ -1,5 +1,6 @@
 #include "TextureManager.h"
 #include "framework.h"
+#include "Profiler.h"
 #include <algorithm>
 
 namespace AronEngine
@@ -40,11 +41,15 @@ namespace AronEngine
         }
         
         renderTarget = nullptr;
+        nextTextureId = 1;
         DEBUG_LOG("TextureManager shutdown");
     }
 
     std::shared_ptr<Texture> TextureManager::LoadTexture(const std::string& filepath)
     {
+        PROFILE_SCOPE("TextureManager::LoadTexture");
+        MEMORY_TAG(Textures);
+
         auto it = loadedTextures.find(filepath);
         if (it != loadedTextures.end()) {
             DEBUG_LOG("Texture already loaded: " + filepath);
@@ -66,7 +71,10 @@ namespace AronEngine
         }
 
         texture->size = texture->bitmap->GetPixelSize();
+        texture->id = nextTextureId++;
         loadedTextures[filepath] = texture;
+
+        MemoryTracker::TrackPayload(MemoryTag::Textures, texture->GetPayloadBytes());
         
         DEBUG_LOG("Texture loaded successfully: " + filepath + 
                   " (" + std::to_string(texture->size.width) + "x" + std::to_string(texture->size.height) + ")");
@@ -118,11 +126,13 @@ namespace AronEngine
                                                                    int width, int height, 
                                                                    const Color& color)
     {
-        if (!renderTarget) {
+        if (!wicFactory) {
             DEBUG_LOG("TextureManager not initialized");
             return nullptr;
         }
 
+        MEMORY_TAG(Textures);
+
         auto it = loadedTextures.find(name);
         if (it != loadedTextures.end()) {
             return it->second;
@@ -132,6 +142,12 @@ namespace AronEngine
         texture->filepath = name;
         texture->size = D2D1::SizeU(width, height);
 
+        if (!renderTarget) {
+            texture->id = nextTextureId++;
+            loadedTextures[name] = texture;
+            return texture;
+        }
+
         D2D1_BITMAP_PROPERTIES bitmapProps = D2D1::BitmapProperties(
             D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
             96.0f,
@@ -160,7 +176,9 @@ namespace AronEngine
             return nullptr;
         }
 
+        texture->id = nextTextureId++;
         loadedTextures[name] = texture;
+        MemoryTracker::TrackPayload(MemoryTag::Textures, texture->GetPayloadBytes());
         
         DEBUG_LOG("Created solid color texture: " + name + 
                   " (" + std::to_string(width) + "x" + std::to_string(height) + ")");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "framework.h"
+#include "MemoryTracker.h"
 #include <wincodec.h>
 #include <unordered_map>
 #include <memory>
@@ -11,12 +12,20 @@ namespace AronEngine
 {
     struct Texture
     {
-        ID2D1Bitmap* bitmap = nullptr;
+        ID2D1Bitmap* bitmap = nullptr;      // null for placeholders made without a render target
         D2D1_SIZE_U size = { 0, 0 };
         std::string filepath = "";
+        uint32_t id = 0;                    // creation order, so identical runs number textures alike
         
+        // 32bpp PBGRA, charged to MemoryTag::Textures while the bitmap is alive
+        int64_t GetPayloadBytes() const { return static_cast<int64_t>(size.width) * size.height * 4; }
+
         ~Texture()
         {
+            if (bitmap)
+            {
+                MemoryTracker::UntrackPayload(MemoryTag::Textures, GetPayloadBytes());
+            }
             SafeRelease(&bitmap);
         }
     };
@@ -27,6 +36,7 @@ namespace AronEngine
         std::unordered_map<std::string, std::shared_ptr<Texture>> loadedTextures;
         ID2D1RenderTarget* renderTarget = nullptr;
         IWICImagingFactory* wicFactory = nullptr;
+        uint32_t nextTextureId = 1;
 
         TextureManager() = default;
         ~TextureManager() = default;
@@ -40,6 +50,8 @@ namespace AronEngine
     public:
         static TextureManager& GetInstance();
         
+        // renderTarget may be null (null renderer): solid colour textures are then size-only
+        // placeholders, which the renderer records but cannot draw, and files don't load
         bool Initialize(ID2D1RenderTarget* renderTarget);
         void Shutdown();
         
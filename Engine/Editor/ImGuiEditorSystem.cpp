@@ -4,8 +4,19 @@
 #include "../Core/Scene.h"
 #include "../Core/GameObject.h"
 #include "../Core/TextureManager.h"
+#include "../Core/Profiler.h"
+#include "../Core/EngineApp.h"
+#include "../Core/EngineTime.h"
+#include "../Core/EngineStats.h"
+#include "../Core/MemoryTracker.h"
+#include "../Core/SystemScheduler.h"
+#include "../Core/JobSystem.h"
+#include "../Core/ObjectPools.h"
 #include "../Components/Transform.h"
 #include "../Components/SpriteRenderer.h"
+#include "../Components/ComponentRegistry.h"
+#include "../Systems/RenderSystem.h"
+#include "../Resources/Prefab.h"
 #include "KoreanStrings.h"
 
 // ImGui includes  
@@ -24,6 +35,21 @@
 
 namespace AronEngine
 {
+    namespace
+    {
+        // Recorded into the frame by EndFrame, so it runs wherever the renderer plays it back
+        void RenderImGuiDrawData(void* context)
+        {
+            ImGui::SetCurrentContext(static_cast<ImGuiContext*>(context));
+            ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+            if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+            {
+                ImGui::RenderPlatformWindowsDefault();
+            }
+        }
+    }
+
     ImGuiEditorSystem::ImGuiEditorSystem()
         : hWnd(nullptr)
         , renderer(nullptr)
@@ -35,11 +61,17 @@ namespace AronEngine
         , showAssetBrowser(true)
         , showGameView(false)
         , showSceneView(true)
+        , showProfiler(false)
+        , showFrameStats(false)
+        , showEngineStats(false)
+        , showMemory(false)
+        , showSystemSchedule(false)
         , imguiContext(nullptr)
         , d3d11Device(nullptr)
         , d3d11Context(nullptr)
         , selectedObject(nullptr)
         , currentScene(nullptr)
+        , profilerSelectedFrame(-1)
         , isDockingEnabled(true)
         , isViewportsEnabled(false)
     {
@@ -123,6 +155,12 @@ namespace AronEngine
     {
         if (imguiContext)
         {
+            // A submitted frame may still hold a draw callback into this context
+            if (renderer)
+            {
+                renderer->WaitForIdle();
+            }
+
             ImGui_ImplDX11_Shutdown();
             ImGui_ImplWin32_Shutdown();
             ImGui::DestroyContext(imguiContext);
@@ -148,6 +186,12 @@ namespace AronEngine
     {
         if (!isEnabled || !imguiContext) return;
 
+        // The render thread may still be drawing last frame's draw data, which NewFrame reuses
+        if (renderer)
+        {
+            renderer->WaitForIdle();
+        }
+
         ImGui::SetCurrentContext(imguiContext);
         
         // Start the Dear ImGui frame
@@ -169,14 +213,21 @@ namespace AronEngine
         
         // Rendering
         ImGui::Render();
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
 
-        // Update and Render additional Platform Windows
+        // Update additional Platform Windows here; they are drawn with the main draw data
         ImGuiIO& io = ImGui::GetIO();
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
         {
             ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
+        }
+
+        if (renderer)
+        {
+            renderer->RecordCallback(&RenderImGuiDrawData, imguiContext);
+        }
+        else
+        {
+            RenderImGuiDrawData(imguiContext);
         }
     }
 
@@ -192,6 +243,8 @@ namespace AronEngine
 
         ImGui::SetCurrentContext(imguiContext);
 
+        PROFILE_SCOPE("ImGuiEditorSystem::Render");
+
         // Main menu bar
         RenderMainMenuBar();
 
@@ -219,6 +272,21 @@ namespace AronEngine
 
         if (showGameView)
             RenderGameView();
+
+        if (showProfiler)
+            RenderProfiler();
+
+        if (showFrameStats)
+            RenderFrameStatsOverlay();
+
+        if (showEngineStats)
+            RenderEngineStats();
+
+        if (showMemory)
+            RenderMemory();
+
+        if (showSystemSchedule)
+            RenderSystemSchedule();
     }
 
     void ImGuiEditorSystem::RenderMainMenuBar()
@@ -289,6 +357,11 @@ namespace AronEngine
                 ImGui::MenuItem(Korean::WIN_ASSET_BROWSER, nullptr, &showAssetBrowser);
                 ImGui::MenuItem(Korean::WIN_SCENE_VIEW, nullptr, &showSceneView);
                 ImGui::MenuItem(Korean::WIN_GAME_VIEW, nullptr, &showGameView);
+                ImGui::MenuItem(Korean::WIN_PROFILER, nullptr, &showProfiler);
+                ImGui::MenuItem(Korean::WIN_FRAME_STATS, nullptr, &showFrameStats);
+                ImGui::MenuItem(Korean::WIN_ENGINE_STATS, nullptr, &showEngineStats);
+                ImGui::MenuItem(Korean::WIN_MEMORY, nullptr, &showMemory);
+                ImGui::MenuItem(Korean::WIN_SYSTEM_SCHEDULE, nullptr, &showSystemSchedule);
                 ImGui::Separator();
                 ImGui::MenuItem(Korean::WIN_DEMO, nullptr, &showDemoWindow);
                 ImGui::EndMenu();
@@ -300,6 +373,12 @@ namespace AronEngine
                 ImGui::EndMenu();
             }
 
+            EngineApp& app = EngineApp::GetInstance();
+            if (ImGui::MenuItem(app.IsPlaying() ? Korean::MENU_STOP : Korean::MENU_PLAY))
+            {
+                app.SetPlaying(!app.IsPlaying());
+            }
+
             ImGui::EndMainMenuBar();
         }
     }
@@ -498,10 +577,25 @@ namespace AronEngine
             ImGui::Text("Viewport: %.0fx%.0f", viewportSize.x, viewportSize.y);
             ImGui::Button("Viewport Area", viewportSize);
 
-            // Handle viewport input
-            if (ImGui::IsItemHovered())
+            // Click to select: the area stands for the whole render target, so scale the mouse
+            // into target pixels and ask the render system's spatial index what is drawn there
+            if (ImGui::IsItemHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && renderer)
             {
-                // Handle mouse input for scene navigation
+                RenderSystem* renderSystem = EngineApp::GetInstance().GetRenderSystem();
+                const ImVec2 itemMin = ImGui::GetItemRectMin();
+                const ImVec2 itemSize = ImGui::GetItemRectSize();
+                const ImVec2 mouse = ImGui::GetMousePos();
+                const float targetWidth = static_cast<float>(renderer->GetWidth());
+                const float targetHeight = static_cast<float>(renderer->GetHeight());
+
+                if (renderSystem && itemSize.x > 0.0f && itemSize.y > 0.0f)
+                {
+                    const Vector2 targetPoint(
+                        (mouse.x - itemMin.x) / itemSize.x * targetWidth,
+                        (mouse.y - itemMin.y) / itemSize.y * targetHeight);
+                    SpriteRenderer* picked = renderSystem->PickSpriteOnScreen(targetPoint, targetWidth, targetHeight);
+                    selectedObject = picked ? picked->GetGameObject() : nullptr;
+                }
             }
         }
         ImGui::End();
@@ -521,6 +615,587 @@ namespace AronEngine
         ImGui::End();
     }
 
+    void ImGuiEditorSystem::RenderProfiler()
+    {
+        if (ImGui::Begin("Profiler", &showProfiler))
+        {
+            Profiler& profiler = Profiler::GetInstance();
+            const auto frames = profiler.GetHistory();
+            const auto threadNames = profiler.GetThreadNames();
+
+            bool paused = profiler.IsPaused();
+            if (ImGui::Checkbox("Pause", &paused))
+            {
+                profiler.SetPaused(paused);
+                if (!paused) profilerSelectedFrame = -1;
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Export Chrome Trace"))
+            {
+                profiler.ExportChromeTrace("profile_trace.json");
+            }
+
+            if (frames.empty())
+            {
+                ImGui::TextDisabled("No frames captured yet");
+                ImGui::End();
+                return;
+            }
+
+            if (profilerSelectedFrame >= static_cast<int>(frames.size()))
+            {
+                profilerSelectedFrame = -1;
+            }
+            const int selected = profilerSelectedFrame < 0 ? static_cast<int>(frames.size()) - 1 : profilerSelectedFrame;
+            const ProfileFrame& frame = *frames[selected];
+
+            // Frame time history; clicking a bar pauses capture and inspects that frame
+            std::vector<float> frameTimes(frames.size());
+            float maxFrameTime = 1.0f;
+            for (size_t i = 0; i < frames.size(); ++i)
+            {
+                frameTimes[i] = static_cast<float>(frames[i]->GetDurationMs());
+                maxFrameTime = (std::max)(maxFrameTime, frameTimes[i]);
+            }
+
+            char overlay[64];
+            snprintf(overlay, sizeof(overlay), "Frame %llu: %.2f ms", static_cast<unsigned long long>(frame.index), frame.GetDurationMs());
+            ImGui::PlotHistogram("##FrameTimes", frameTimes.data(), static_cast<int>(frameTimes.size()), 0,
+                overlay, 0.0f, maxFrameTime, ImVec2(ImGui::GetContentRegionAvail().x, 60.0f));
+
+            if (ImGui::IsItemHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+            {
+                const float t = (ImGui::GetMousePos().x - ImGui::GetItemRectMin().x) / ImGui::GetItemRectSize().x;
+                profilerSelectedFrame = (std::min)(static_cast<int>(t * frames.size()), static_cast<int>(frames.size()) - 1);
+                profiler.SetPaused(true);
+            }
+
+            ImGui::Separator();
+
+            // Flame graph, one lane per thread, scaled to the frame
+            const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+            const double frameDuration = static_cast<double>((std::max)(frame.end - frame.start, static_cast<int64_t>(1)));
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+            const ProfileZone* hoveredZone = nullptr;
+
+            size_t zoneIndex = 0;
+            while (zoneIndex < frame.zones.size())
+            {
+                const uint16_t thread = frame.zones[zoneIndex].thread;
+                size_t laneEnd = zoneIndex;
+                int maxDepth = 0;
+                while (laneEnd < frame.zones.size() && frame.zones[laneEnd].thread == thread)
+                {
+                    maxDepth = (std::max)(maxDepth, static_cast<int>(frame.zones[laneEnd].depth));
+                    ++laneEnd;
+                }
+
+                ImGui::TextUnformatted(thread < threadNames.size() ? threadNames[thread].c_str() : "Thread");
+
+                const ImVec2 origin = ImGui::GetCursorScreenPos();
+                const float width = ImGui::GetContentRegionAvail().x;
+                const float height = (maxDepth + 1) * rowHeight;
+                ImGui::PushID(thread);
+                ImGui::InvisibleButton("##Lane", ImVec2((std::max)(width, 1.0f), height));
+                const bool laneHovered = ImGui::IsItemHovered();
+                ImGui::PopID();
+                const ImVec2 mouse = ImGui::GetMousePos();
+
+                drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 30, 255));
+
+                for (size_t i = zoneIndex; i < laneEnd; ++i)
+                {
+                    const ProfileZone& zone = frame.zones[i];
+
+                    // Zones from other threads may straddle the frame boundary
+                    const double x0 = (std::max)(0.0, (zone.start - frame.start) / frameDuration);
+                    const double x1 = (std::min)(1.0, (zone.end - frame.start) / frameDuration);
+                    if (x1 <= x0) continue;
+
+                    const ImVec2 minPos(origin.x + static_cast<float>(x0 * width), origin.y + zone.depth * rowHeight);
+                    const ImVec2 maxPos((std::max)(minPos.x + 1.0f, origin.x + static_cast<float>(x1 * width)), minPos.y + rowHeight - 1.0f);
+
+                    // Stable colour per zone name
+                    const ImU32 hash = ImHashStr(zone.name);
+                    const ImU32 color = IM_COL32(90 + (hash & 0x7F), 90 + ((hash >> 8) & 0x7F), 90 + ((hash >> 16) & 0x7F), 255);
+                    drawList->AddRectFilled(minPos, maxPos, color);
+
+                    if (maxPos.x - minPos.x > 30.0f)
+                    {
+                        drawList->PushClipRect(minPos, maxPos, true);
+                        drawList->AddText(ImVec2(minPos.x + 2.0f, minPos.y + 2.0f), IM_COL32(0, 0, 0, 255), zone.name);
+                        drawList->PopClipRect();
+                    }
+
+                    if (laneHovered && mouse.x >= minPos.x && mouse.x < maxPos.x && mouse.y >= minPos.y && mouse.y < maxPos.y)
+                    {
+                        hoveredZone = &zone;
+                    }
+                }
+
+                zoneIndex = laneEnd;
+            }
+
+            if (hoveredZone)
+            {
+                ImGui::SetTooltip("%s\n%.3f ms", hoveredZone->name, (hoveredZone->end - hoveredZone->start) * 1e-6);
+            }
+
+            ImGui::Separator();
+
+            // Per-name totals for the selected frame
+            struct ZoneTotal
+            {
+                const char* name;
+                uint16_t thread;
+                int calls;
+                int64_t total;
+            };
+            std::vector<ZoneTotal> totals;
+            for (const ProfileZone& zone : frame.zones)
+            {
+                auto it = std::find_if(totals.begin(), totals.end(),
+                    [&zone](const ZoneTotal& t) { return t.name == zone.name && t.thread == zone.thread; });
+                if (it == totals.end())
+                {
+                    totals.push_back({ zone.name, zone.thread, 1, zone.end - zone.start });
+                }
+                else
+                {
+                    ++it->calls;
+                    it->total += zone.end - zone.start;
+                }
+            }
+            std::sort(totals.begin(), totals.end(),
+                [](const ZoneTotal& a, const ZoneTotal& b) { return a.total > b.total; });
+
+            if (ImGui::BeginTable("##ZoneTotals", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY))
+            {
+                ImGui::TableSetupColumn("Zone");
+                ImGui::TableSetupColumn("Thread");
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableSetupColumn("Total (ms)");
+                ImGui::TableHeadersRow();
+
+                for (const ZoneTotal& total : totals)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(total.name);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(total.thread < threadNames.size() ? threadNames[total.thread].c_str() : "");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", total.calls);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", total.total * 1e-6);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ImGuiEditorSystem::RenderFrameStatsOverlay()
+    {
+        Time* time = EngineApp::GetInstance().GetTime();
+        if (!time) return;
+
+        // Pinned to the top-right corner of the main viewport
+        const ImGuiViewport* viewport = ImGui::GetMainViewport();
+        ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - 10.0f, viewport->WorkPos.y + 10.0f),
+            ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+        ImGui::SetNextWindowBgAlpha(0.75f);
+
+        const ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize
+            | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoDocking;
+
+        if (ImGui::Begin("Frame Stats", &showFrameStats, flags))
+        {
+            const FrameTimeStats& stats = time->GetFrameTimeStats();
+            ImGui::Text("%.1f FPS  (%d frames)", time->GetFPS(), stats.sampleCount);
+            ImGui::Text("avg %.2f  p50 %.2f  p95 %.2f", stats.average, stats.p50, stats.p95);
+            ImGui::Text("p99 %.2f  max %.2f ms", stats.p99, stats.max);
+
+            std::vector<float> history;
+            time->GetFrameTimeHistory(history);
+            const float scaleMax = (std::max)(stats.max, time->GetHitchThreshold());
+            ImGui::PlotLines("##FrameTimes", history.data(), static_cast<int>(history.size()), 0, nullptr, 0.0f, scaleMax, ImVec2(260.0f, 50.0f));
+
+            // 2 ms buckets up to 50 ms; the last one collects anything slower
+            constexpr int kBuckets = 25;
+            int counts[kBuckets];
+            float bucketValues[kBuckets];
+            time->BuildFrameTimeHistogram(counts, kBuckets, 2.0f);
+            for (int i = 0; i < kBuckets; ++i) bucketValues[i] = static_cast<float>(counts[i]);
+            ImGui::PlotHistogram("##FrameHistogram", bucketValues, kBuckets, 0, "0-50 ms", 0.0f, FLT_MAX, ImVec2(260.0f, 40.0f));
+
+            float threshold = time->GetHitchThreshold();
+            ImGui::SetNextItemWidth(120.0f);
+            if (ImGui::DragFloat("Hitch ms", &threshold, 0.5f, 1.0f, 500.0f, "%.1f"))
+            {
+                time->SetHitchThreshold(threshold);
+            }
+
+            const auto& hitches = time->GetHitches();
+            ImGui::Text("Hitches: %llu", static_cast<unsigned long long>(time->GetHitchCount()));
+            for (size_t i = hitches.size(), shown = 0; i-- > 0 && shown < 5; ++shown)
+            {
+                const HitchRecord& hitch = hitches[i];
+                ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.3f, 1.0f), "#%llu %.1f ms  %s %.1f ms (typ %.1f)",
+                    static_cast<unsigned long long>(hitch.frame), hitch.frameMs,
+                    hitch.culprit ? hitch.culprit : "?", hitch.culpritMs, hitch.culpritTypicalMs);
+            }
+
+            if (ImGui::SmallButton("Dump CSV"))
+            {
+                time->DumpFrameStatsCsv("frame_stats.csv");
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Reset"))
+            {
+                time->ClearFrameStats();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ImGuiEditorSystem::RenderEngineStats()
+    {
+        if (ImGui::Begin("Engine Stats", &showEngineStats))
+        {
+            EngineStats& stats = EngineStats::GetInstance();
+            const StatsFrame* lastFrame = stats.GetLastFrame();
+
+            ImGui::Text("Frame %llu  %.2f ms", lastFrame ? static_cast<unsigned long long>(lastFrame->frameIndex) : 0ull,
+                lastFrame ? lastFrame->frameMs : 0.0f);
+            ImGui::SameLine();
+            ImGui::TextDisabled(stats.IsSharedMemoryOpen() ? "(shared memory: on)" : "(shared memory: off)");
+
+            const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+            if (ImGui::BeginTable("##EngineStats", 5, tableFlags))
+            {
+                ImGui::TableSetupColumn("Counter");
+                ImGui::TableSetupColumn("Last");
+                ImGui::TableSetupColumn("Avg");
+                ImGui::TableSetupColumn("Max");
+                ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+                ImGui::TableHeadersRow();
+
+                std::vector<float> history;
+                for (size_t i = 0; i < kStatCounterCount; ++i)
+                {
+                    const StatCounter counter = static_cast<StatCounter>(i);
+                    stats.GetCounterHistory(counter, history);
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(EngineStats::GetCounterName(counter));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%lld", lastFrame ? static_cast<long long>(lastFrame->Get(counter)) : 0ll);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", stats.GetAverage(counter));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%lld", static_cast<long long>(stats.GetMax(counter)));
+                    ImGui::TableNextColumn();
+                    ImGui::PushID(static_cast<int>(i));
+                    ImGui::PlotLines("##History", history.data(), static_cast<int>(history.size()), 0, nullptr,
+                        0.0f, FLT_MAX, ImVec2(-FLT_MIN, 18.0f));
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ImGuiEditorSystem::RenderMemory()
+    {
+        if (ImGui::Begin("Memory", &showMemory))
+        {
+            MemoryTracker& tracker = MemoryTracker::GetInstance();
+            const MemoryTagStats total = MemoryTracker::GetTotalStats();
+
+            ImGui::Text("Heap %.2f MB in %lld blocks  |  Payload %.2f MB", total.bytes / (1024.0 * 1024.0),
+                static_cast<long long>(total.allocations), total.payloadBytes / (1024.0 * 1024.0));
+            if (!MemoryTracker::IsHookEnabled())
+            {
+                ImGui::TextDisabled("Heap hooks disabled (AE_MEMORY_TRACKING=0)");
+            }
+
+            if (ImGui::Button("Mark"))
+            {
+                tracker.Mark("Manual mark");
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Write Report"))
+            {
+                tracker.WriteReport("memory_report.txt");
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("%zu marks", tracker.GetMarks().size());
+
+            const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+            if (ImGui::BeginTable("##MemoryTags", 7, tableFlags))
+            {
+                ImGui::TableSetupColumn("Tag");
+                ImGui::TableSetupColumn("Heap KB");
+                ImGui::TableSetupColumn("Blocks");
+                ImGui::TableSetupColumn("Peak KB");
+                ImGui::TableSetupColumn("Payload KB");
+                ImGui::TableSetupColumn("Budget KB");
+                ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+                ImGui::TableHeadersRow();
+
+                std::vector<float> history;
+                for (size_t i = 0; i < kMemoryTagCount; ++i)
+                {
+                    const MemoryTag tag = static_cast<MemoryTag>(i);
+                    const MemoryTagStats stats = MemoryTracker::GetTagStats(tag);
+                    tracker.GetTagHistory(tag, history);
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    if (tracker.IsOverBudget(tag))
+                        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "%s", MemoryTracker::GetTagName(tag));
+                    else
+                        ImGui::TextUnformatted(MemoryTracker::GetTagName(tag));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", stats.bytes / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%lld", static_cast<long long>(stats.allocations));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", stats.peakBytes / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", stats.payloadBytes / 1024.0);
+
+                    // Budget in KB, edited in place; 0 disables it
+                    ImGui::TableNextColumn();
+                    ImGui::PushID(static_cast<int>(i));
+                    float budgetKb = static_cast<float>(tracker.GetBudget(tag) / 1024.0);
+                    ImGui::SetNextItemWidth(-FLT_MIN);
+                    if (ImGui::DragFloat("##Budget", &budgetKb, 64.0f, 0.0f, 4.0f * 1024.0f * 1024.0f, "%.0f"))
+                    {
+                        tracker.SetBudget(tag, static_cast<int64_t>(budgetKb * 1024.0));
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::PlotLines("##History", history.data(), static_cast<int>(history.size()), 0, nullptr,
+                        FLT_MAX, FLT_MAX, ImVec2(-FLT_MIN, 18.0f));
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+
+            ImGui::Separator();
+            bool pooled = ObjectPools::IsEnabled();
+            if (ImGui::Checkbox("Object pools", &pooled))
+            {
+                ObjectPools::SetEnabled(pooled);
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("GameObject, Transform and component allocations");
+
+            if (ImGui::BeginTable("##ObjectPools", 6, tableFlags))
+            {
+                ImGui::TableSetupColumn("Pool");
+                ImGui::TableSetupColumn("Block");
+                ImGui::TableSetupColumn("Used / Capacity");
+                ImGui::TableSetupColumn("Peak");
+                ImGui::TableSetupColumn("Chunk KB");
+                ImGui::TableSetupColumn("Occupancy", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+                ImGui::TableHeadersRow();
+
+                for (const PoolStats& stats : ObjectPools::GetStats())
+                {
+                    const float occupancy = stats.capacity > 0 ? static_cast<float>(stats.used) / stats.capacity : 0.0f;
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(stats.name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.blockSize);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu / %zu", stats.used, stats.capacity);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.peak);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", stats.capacity * stats.blockSize / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::ProgressBar(occupancy, ImVec2(-FLT_MIN, 0.0f));
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ImGuiEditorSystem::RenderSystemSchedule()
+    {
+        if (ImGui::Begin("System Schedule", &showSystemSchedule))
+        {
+            SystemScheduler* scheduler = EngineApp::GetInstance().GetSystemScheduler();
+            if (!scheduler)
+            {
+                ImGui::TextDisabled("No scheduler");
+                ImGui::End();
+                return;
+            }
+
+            bool parallel = scheduler->IsParallel();
+            if (ImGui::Checkbox("Parallel", &parallel))
+            {
+                scheduler->SetParallel(parallel);
+            }
+            ImGui::SameLine();
+            bool validate = SystemAccessValidator::IsEnabled();
+            if (ImGui::Checkbox("Validate access", &validate))
+            {
+                SystemAccessValidator::SetEnabled(validate);
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("%d systems, %d levels, %zu edges, %u job threads", scheduler->GetSystemCount(),
+                scheduler->GetLevelCount(), scheduler->GetEdges().size(), JobSystem::GetInstance().GetThreadCount());
+
+            // Dependency graph: one column per level, edges from the earlier system to the later one
+            const float nodeWidth = 130.0f;
+            const float nodeHeight = 34.0f;
+            const float columnGap = 50.0f;
+            const float rowGap = 10.0f;
+
+            std::vector<int> rowInLevel(scheduler->GetSystemCount(), 0);
+            std::vector<int> levelRows(static_cast<size_t>((std::max)(scheduler->GetLevelCount(), 1)), 0);
+            int maxRows = 1;
+            for (int i = 0; i < scheduler->GetSystemCount(); ++i)
+            {
+                const auto& system = scheduler->GetSystem(i);
+                if (!system.enabled) continue;
+                rowInLevel[i] = levelRows[system.level]++;
+                maxRows = (std::max)(maxRows, levelRows[system.level]);
+            }
+
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            const float canvasHeight = maxRows * (nodeHeight + rowGap);
+            ImGui::Dummy(ImVec2(levelRows.size() * (nodeWidth + columnGap), canvasHeight));
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+            auto nodeMin = [&](int index)
+            {
+                const auto& system = scheduler->GetSystem(index);
+                return ImVec2(origin.x + system.level * (nodeWidth + columnGap), origin.y + rowInLevel[index] * (nodeHeight + rowGap));
+            };
+
+            for (const auto& edge : scheduler->GetEdges())
+            {
+                const ImVec2 from = nodeMin(edge.from);
+                const ImVec2 to = nodeMin(edge.to);
+                const ImU32 color = edge.conflict ? IM_COL32(200, 200, 120, 160) : IM_COL32(150, 150, 150, 90);
+                drawList->AddLine(ImVec2(from.x + nodeWidth, from.y + nodeHeight * 0.5f), ImVec2(to.x, to.y + nodeHeight * 0.5f), color, 1.5f);
+            }
+
+            for (int i = 0; i < scheduler->GetSystemCount(); ++i)
+            {
+                const auto& system = scheduler->GetSystem(i);
+                if (!system.enabled) continue;
+
+                // Blue: ran on the main thread, green: a worker, grey: skipped
+                const ImVec2 min = nodeMin(i);
+                const ImVec2 max(min.x + nodeWidth, min.y + nodeHeight);
+                const ImU32 fill = system.lastThread == 0 ? IM_COL32(50, 80, 140, 255)
+                    : system.lastThread > 0 ? IM_COL32(50, 120, 70, 255) : IM_COL32(70, 70, 70, 255);
+                drawList->AddRectFilled(min, max, fill, 4.0f);
+                drawList->AddRect(min, max, system.access.exclusive ? IM_COL32(230, 120, 80, 255) : IM_COL32(20, 20, 20, 255), 4.0f);
+
+                char label[96];
+                snprintf(label, sizeof(label), "%s\n%.3f ms", system.name.c_str(), system.lastMs);
+                drawList->AddText(ImVec2(min.x + 6.0f, min.y + 3.0f), IM_COL32_WHITE, label);
+
+                if (ImGui::IsMouseHoveringRect(min, max))
+                {
+                    ImGui::SetTooltip("%s\nReads: %s\nWrites: %s%s%s", system.name.c_str(),
+                        AccessTypeRegistry::Describe(system.access.reads).c_str(),
+                        AccessTypeRegistry::Describe(system.access.writes).c_str(),
+                        system.access.exclusive ? "\nExclusive" : "", system.access.mainThread ? "\nMain thread only" : "");
+                }
+            }
+
+            const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+            if (ImGui::BeginTable("##Systems", 7, tableFlags))
+            {
+                ImGui::TableSetupColumn("On", ImGuiTableColumnFlags_WidthFixed, 24.0f);
+                ImGui::TableSetupColumn("System");
+                ImGui::TableSetupColumn("Level");
+                ImGui::TableSetupColumn("Thread");
+                ImGui::TableSetupColumn("ms");
+                ImGui::TableSetupColumn("Reads");
+                ImGui::TableSetupColumn("Writes");
+                ImGui::TableHeadersRow();
+
+                for (int i = 0; i < scheduler->GetSystemCount(); ++i)
+                {
+                    const auto& system = scheduler->GetSystem(i);
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::PushID(i);
+                    bool enabled = system.enabled;
+                    if (ImGui::Checkbox("##Enabled", &enabled))
+                    {
+                        scheduler->SetSystemEnabled(system.name, enabled);
+                    }
+                    ImGui::PopID();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s%s", system.name.c_str(), system.access.mainThread ? " (main)" : "");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", system.level);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", system.lastThread);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", system.lastMs);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(system.access.exclusive ? "*" : AccessTypeRegistry::Describe(system.access.reads).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(system.access.exclusive ? "*" : AccessTypeRegistry::Describe(system.access.writes).c_str());
+                }
+                ImGui::EndTable();
+            }
+
+            if (ImGui::CollapsingHeader("Edges"))
+            {
+                for (const auto& edge : scheduler->GetEdges())
+                {
+                    ImGui::Text("%s -> %s : %s", scheduler->GetSystem(edge.from).name.c_str(), scheduler->GetSystem(edge.to).name.c_str(),
+                        edge.conflict ? AccessTypeRegistry::Describe(edge.conflict).c_str() : "exclusive");
+                }
+            }
+
+            const std::vector<SystemAccessViolation> violations = SystemAccessValidator::GetViolations();
+            if (ImGui::CollapsingHeader("Access Violations", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                if (!validate)
+                {
+                    ImGui::TextDisabled("Enable validation to check component access against declarations");
+                }
+                else if (violations.empty())
+                {
+                    ImGui::TextDisabled("None");
+                }
+
+                for (const auto& violation : violations)
+                {
+                    ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "%s %s %s without declaring it (x%llu)",
+                        violation.system.c_str(), violation.write ? "wrote" : "read",
+                        AccessTypeRegistry::GetName(violation.typeId), static_cast<unsigned long long>(violation.count));
+                }
+
+                if (!violations.empty() && ImGui::Button("Clear"))
+                {
+                    SystemAccessValidator::ClearViolations();
+                }
+            }
+        }
+        ImGui::End();
+    }
+
     void ImGuiEditorSystem::RenderComponentInspector(GameObject* gameObject)
     {
         if (!gameObject) return;
@@ -536,119 +1211,185 @@ namespace AronEngine
 
         ImGui::Separator();
 
-        // Transform component (always present)
+        // Transform isn't in the component list, so it goes first by hand
         Transform* transform = gameObject->GetComponent<Transform>();
         if (transform && ImGui::CollapsingHeader(Korean::INSPECTOR_TRANSFORM, ImGuiTreeNodeFlags_DefaultOpen))
         {
-            Vector2 pos = transform->GetLocalPosition();
-            float position[2] = {pos.x, pos.y};
-            if (ImGui::DragFloat2(Korean::INSPECTOR_POSITION, position, 0.1f))
-            {
-                transform->SetLocalPosition(Vector2(position[0], position[1]));
-            }
+            RenderReflectedFields(*transform, ComponentRegistry::Get<Transform>());
+        }
 
-            float rotation = transform->GetLocalRotation();
-            if (ImGui::DragFloat(Korean::INSPECTOR_ROTATION, &rotation, 0.1f))
-            {
-                transform->SetLocalRotation(rotation);
-            }
+        // Everything else with an AE_REFLECT list gets generic widgets
+        for (const auto& component : gameObject->GetAllComponents())
+        {
+            const ComponentTypeInfo* type = component->GetTypeInfo();
+            if (!type || type->fieldCount == 0)
+                continue;
 
-            Vector2 scale = transform->GetLocalScale();
-            float scaleArray[2] = {scale.x, scale.y};
-            if (ImGui::DragFloat2(Korean::INSPECTOR_SCALE, scaleArray, 0.01f, 0.01f, 10.0f))
+            const bool isSprite = type == ComponentRegistry::Get<SpriteRenderer>();
+            ImGui::PushID(component.get());
+            if (ImGui::CollapsingHeader(isSprite ? Korean::INSPECTOR_SPRITE_RENDERER : type->name.c_str()))
             {
-                transform->SetLocalScale(Vector2(scaleArray[0], scaleArray[1]));
+                RenderReflectedFields(*component, type);
+                if (isSprite)
+                {
+                    RenderTextureSelector(static_cast<SpriteRenderer*>(component.get()));
+                }
             }
+            ImGui::PopID();
         }
+    }
 
-        // SpriteRenderer component
-        SpriteRenderer* spriteRenderer = gameObject->GetComponent<SpriteRenderer>();
-        if (spriteRenderer && ImGui::CollapsingHeader(Korean::INSPECTOR_SPRITE_RENDERER))
+    void ImGuiEditorSystem::RenderReflectedFields(Component& component, const ComponentTypeInfo* type)
+    {
+        for (uint32_t i = 0; i < type->fieldCount; ++i)
         {
-            Color color = spriteRenderer->GetColor();
-            float colorArray[4] = {color.r, color.g, color.b, color.a};
-            if (ImGui::ColorEdit4(Korean::INSPECTOR_COLOR, colorArray))
+            // Out-of-range edits are clamped by the field's limits or setter on the way in
+            const ReflectedField& field = type->fields[i];
+            switch (field.kind)
             {
-                spriteRenderer->SetColor(Color(colorArray[0], colorArray[1], colorArray[2], colorArray[3]));
+            case FieldKind::Bool:
+            {
+                bool value = false;
+                field.get(component, &value);
+                if (ImGui::Checkbox(field.name, &value)) field.set(component, &value);
+                break;
             }
-            
-            Vector2 size = spriteRenderer->GetSize();
-            float sizeArray[2] = {size.x, size.y};
-            if (ImGui::DragFloat2(Korean::INSPECTOR_SIZE, sizeArray, 1.0f, 1.0f, 1000.0f))
+            case FieldKind::Int:
             {
-                spriteRenderer->SetSize(Vector2(sizeArray[0], sizeArray[1]));
+                int value = 0;
+                field.get(component, &value);
+                if (ImGui::DragInt(field.name, &value)) field.set(component, &value);
+                break;
             }
-            
-            // 텍스처 로딩 섹션
-            ImGui::Separator();
-            
-            // 기본 텍스처 선택
-            ImGui::Text(Korean::INSPECTOR_DEFAULT_TEXTURES);
-            const char* defaultTextures[] = {
-                "없음",
-                "default_white",
-                "default_red", 
-                "default_green",
-                "default_blue",
-                "default_yellow"
-            };
-            
-            static int selectedDefault = 0;
-            if (ImGui::Combo("##DefaultTextures", &selectedDefault, defaultTextures, IM_ARRAYSIZE(defaultTextures)))
-            {
-                if (selectedDefault > 0) {
-                    std::string texName = defaultTextures[selectedDefault];
-                    auto texture = TextureManager::GetInstance().GetTexture(texName);
-                    if (texture) {
-                        auto sprite = std::make_shared<Sprite>(texture, texName);
-                        spriteRenderer->SetSprite(sprite);
-                        DEBUG_LOG("Default texture applied: " + texName);
-                    }
-                } else {
-                    spriteRenderer->SetSprite(nullptr);
-                }
+            case FieldKind::Float:
+            {
+                float value = 0.0f;
+                field.get(component, &value);
+                if (ImGui::DragFloat(field.name, &value, 0.1f)) field.set(component, &value);
+                break;
             }
-            
-            ImGui::Text(Korean::INSPECTOR_TEXTURE_PATH);
-            
-            static char texturePathBuffer[512] = "";
-            std::string currentPath = spriteRenderer->GetTexturePath();
-            if (!currentPath.empty()) {
-                strncpy_s(texturePathBuffer, currentPath.c_str(), sizeof(texturePathBuffer) - 1);
+            case FieldKind::Vector2:
+            {
+                Vector2 value;
+                field.get(component, &value);
+                float values[2] = { value.x, value.y };
+                if (ImGui::DragFloat2(field.name, values, 0.1f))
+                {
+                    value = Vector2(values[0], values[1]);
+                    field.set(component, &value);
+                }
+                break;
             }
-            
-            ImGui::InputText("##TexturePath", texturePathBuffer, sizeof(texturePathBuffer));
-            
-            ImGui::SameLine();
-            if (ImGui::Button(Korean::INSPECTOR_LOAD_TEXTURE))
-            {
-                std::string texturePath(texturePathBuffer);
-                if (!texturePath.empty()) {
-                    if (spriteRenderer->LoadSpriteFromFile(texturePath)) {
-                        DEBUG_LOG("Successfully loaded texture: " + texturePath);
-                    } else {
-                        DEBUG_LOG("Failed to load texture: " + texturePath);
-                    }
+            case FieldKind::Color:
+            {
+                Color value;
+                field.get(component, &value);
+                float values[4] = { value.r, value.g, value.b, value.a };
+                if (ImGui::ColorEdit4(field.name, values))
+                {
+                    value = Color(values[0], values[1], values[2], values[3]);
+                    field.set(component, &value);
                 }
+                break;
             }
-            
-            if (!currentPath.empty()) {
-                ImGui::SameLine();
-                if (ImGui::Button(Korean::INSPECTOR_CLEAR_TEXTURE))
+            case FieldKind::String:
+            {
+                std::string value;
+                field.get(component, &value);
+                char buffer[256];
+                strncpy_s(buffer, value.c_str(), sizeof(buffer) - 1);
+                if (ImGui::InputText(field.name, buffer, sizeof(buffer)))
                 {
-                    spriteRenderer->SetSprite(nullptr);
-                    texturePathBuffer[0] = '\0';
+                    value = buffer;
+                    field.set(component, &value);
                 }
-                
-                // 현재 로드된 텍스처 정보 표시
-                auto sprite = spriteRenderer->GetSprite();
-                if (sprite && sprite->texture) {
-                    ImGui::Text("현재 텍스처: %dx%d", 
-                        sprite->texture->size.width, 
-                        sprite->texture->size.height);
+                break;
+            }
+            case FieldKind::Enum:
+            {
+                int value = 0;
+                field.get(component, &value);
+                const bool changed = field.enumNames
+                    ? ImGui::Combo(field.name, &value, field.enumNames, field.enumCount)
+                    : ImGui::SliderInt(field.name, &value, 0, field.enumCount - 1);
+                if (changed) field.set(component, &value);
+                break;
+            }
+            }
+        }
+    }
+
+    void ImGuiEditorSystem::RenderTextureSelector(SpriteRenderer* spriteRenderer)
+    {
+        // 텍스처 로딩 섹션
+        ImGui::Separator();
+        
+        // 기본 텍스처 선택
+        ImGui::Text(Korean::INSPECTOR_DEFAULT_TEXTURES);
+        const char* defaultTextures[] = {
+            "없음",
+            "default_white",
+            "default_red", 
+            "default_green",
+            "default_blue",
+            "default_yellow"
+        };
+        
+        static int selectedDefault = 0;
+        if (ImGui::Combo("##DefaultTextures", &selectedDefault, defaultTextures, IM_ARRAYSIZE(defaultTextures)))
+        {
+            if (selectedDefault > 0) {
+                std::string texName = defaultTextures[selectedDefault];
+                auto texture = TextureManager::GetInstance().GetTexture(texName);
+                if (texture) {
+                    auto sprite = std::make_shared<Sprite>(texture, texName);
+                    spriteRenderer->SetSprite(sprite);
+                    DEBUG_LOG("Default texture applied: " + texName);
+                }
+            } else {
+                spriteRenderer->SetSprite(nullptr);
+            }
+        }
+        
+        ImGui::Text(Korean::INSPECTOR_TEXTURE_PATH);
+        
+        static char texturePathBuffer[512] = "";
+        std::string currentPath = spriteRenderer->GetTexturePath();
+        if (!currentPath.empty()) {
+            strncpy_s(texturePathBuffer, currentPath.c_str(), sizeof(texturePathBuffer) - 1);
+        }
+        
+        ImGui::InputText("##TexturePath", texturePathBuffer, sizeof(texturePathBuffer));
+        
+        ImGui::SameLine();
+        if (ImGui::Button(Korean::INSPECTOR_LOAD_TEXTURE))
+        {
+            std::string texturePath(texturePathBuffer);
+            if (!texturePath.empty()) {
+                if (spriteRenderer->LoadSpriteFromFile(texturePath)) {
+                    DEBUG_LOG("Successfully loaded texture: " + texturePath);
+                } else {
+                    DEBUG_LOG("Failed to load texture: " + texturePath);
                 }
             }
         }
+        
+        if (!currentPath.empty()) {
+            ImGui::SameLine();
+            if (ImGui::Button(Korean::INSPECTOR_CLEAR_TEXTURE))
+            {
+                spriteRenderer->SetSprite(nullptr);
+                texturePathBuffer[0] = '\0';
+            }
+            
+            // 현재 로드된 텍스처 정보 표시
+            auto sprite = spriteRenderer->GetSprite();
+            if (sprite && sprite->texture) {
+                ImGui::Text("현재 텍스처: %dx%d", 
+                    sprite->texture->size.width, 
+                    sprite->texture->size.height);
+            }
+        }
     }
 
     void ImGuiEditorSystem::SetupImGuiStyle()
@@ -769,11 +1510,9 @@ namespace AronEngine
 
     GameObject* ImGuiEditorSystem::CreateGameObject(const std::string& name)
     {
+        // Every GameObject already owns its Transform
         auto gameObject = std::make_unique<GameObject>(name);
         
-        // Add Transform component (required for all GameObjects)
-        gameObject->AddComponent<Transform>();
-        
         GameObject* ptr = gameObject.get();
         gameObjects.push_back(std::move(gameObject));
         
@@ -794,11 +1533,14 @@ namespace AronEngine
 
     GameObject* ImGuiEditorSystem::CreateSquareObject(const std::string& name)
     {
+        if (!squarePrefab)
+        {
+            squarePrefab = std::make_shared<Prefab>("Square");
+            squarePrefab->AddComponent<SpriteRenderer>()->SetColor(Color::Blue);
+        }
+
         GameObject* obj = CreateGameObject(name);
-        
-        // Add SpriteRenderer for square shape
-        auto spriteRenderer = obj->AddComponent<SpriteRenderer>();
-        spriteRenderer->SetColor(Color::Blue);
+        squarePrefab->AddComponentsTo(obj);
         
         DEBUG_LOG("Square GameObject created: " + name);
         return obj;
@@ -806,11 +1548,15 @@ namespace AronEngine
 
     GameObject* ImGuiEditorSystem::CreateCircleObject(const std::string& name)
     {
+        // Rendered as a circle by the renderer
+        if (!circlePrefab)
+        {
+            circlePrefab = std::make_shared<Prefab>("Circle");
+            circlePrefab->AddComponent<SpriteRenderer>()->SetColor(Color::Red);
+        }
+
         GameObject* obj = CreateGameObject(name);
-        
-        // Add SpriteRenderer for circle shape (we'll render as circle in renderer)
-        auto spriteRenderer = obj->AddComponent<SpriteRenderer>();
-        spriteRenderer->SetColor(Color::Red);
+        circlePrefab->AddComponentsTo(obj);
         
         DEBUG_LOG("Circle GameObject created: " + name);
         return obj;
@@ -825,66 +1571,32 @@ namespace AronEngine
 
     void ImGuiEditorSystem::SaveScene()
     {
-        std::ofstream file("scene.json");
+        std::ofstream file("scene.json", std::ios::binary | std::ios::trunc);
         if (!file.is_open())
         {
             DEBUG_LOG("Failed to open scene.json for writing");
             return;
         }
 
-        file << "{\n";
-        file << "  \"gameObjects\": [\n";
-
-        for (size_t i = 0; i < gameObjects.size(); ++i)
+        std::vector<GameObject*> objects;
+        objects.reserve(gameObjects.size());
+        for (const auto& obj : gameObjects)
         {
-            auto& obj = gameObjects[i];
-            file << "    {\n";
-            file << "      \"name\": \"" << obj->GetName() << "\",\n";
-            file << "      \"active\": " << (obj->IsActive() ? "true" : "false") << ",\n";
-
-            // Transform component
-            Transform* transform = obj->GetComponent<Transform>();
-            if (transform)
-            {
-                Vector2 pos = transform->GetLocalPosition();
-                Vector2 scale = transform->GetLocalScale();
-                float rotation = transform->GetLocalRotation();
-                
-                file << "      \"transform\": {\n";
-                file << "        \"position\": [" << pos.x << ", " << pos.y << "],\n";
-                file << "        \"rotation\": " << rotation << ",\n";
-                file << "        \"scale\": [" << scale.x << ", " << scale.y << "]\n";
-                file << "      }";
-            }
-
-            // SpriteRenderer component
-            SpriteRenderer* spriteRenderer = obj->GetComponent<SpriteRenderer>();
-            if (spriteRenderer)
-            {
-                Color color = spriteRenderer->GetColor();
-                Vector2 size = spriteRenderer->GetSize();
-                
-                file << ",\n      \"spriteRenderer\": {\n";
-                file << "        \"color\": [" << color.r << ", " << color.g << ", " << color.b << ", " << color.a << "],\n";
-                file << "        \"size\": [" << size.x << ", " << size.y << "]\n";
-                file << "      }";
-            }
-
-            file << "\n    }";
-            if (i < gameObjects.size() - 1) file << ",";
-            file << "\n";
+            objects.push_back(obj.get());
         }
 
-        file << "  ]\n";
-        file << "}\n";
-        file.close();
+        if (!Scene::Serialize(file, "EditorScene", objects))
+        {
+            DEBUG_LOG("Failed to write scene.json");
+            return;
+        }
 
         DEBUG_LOG("Scene saved to scene.json");
     }
 
     void ImGuiEditorSystem::LoadScene()
     {
-        std::ifstream file("scene.json");
+        std::ifstream file("scene.json", std::ios::binary);
         if (!file.is_open())
         {
             DEBUG_LOG("Scene file not found - creating empty scene");
@@ -895,62 +1607,12 @@ namespace AronEngine
         gameObjects.clear();
         selectedObject = nullptr;
 
-        // Simple JSON parsing (in a real engine you'd use a proper JSON library)
-        std::string line;
-        std::string content;
-        while (std::getline(file, line))
-        {
-            content += line + "\n";
-        }
-        file.close();
-
-        // This is a very basic JSON parser - in a real engine use nlohmann/json or similar
-        size_t pos = 0;
-        while ((pos = content.find("\"name\": \"", pos)) != std::string::npos)
+        std::string error;
+        const bool loaded = Scene::Deserialize(file,
+            [this](const std::string& name) { return CreateGameObject(name); }, &error);
+        if (!loaded)
         {
-            pos += 9; // Skip '"name": "'
-            size_t endPos = content.find('"', pos);
-            if (endPos == std::string::npos) break;
-            
-            std::string name = content.substr(pos, endPos - pos);
-            
-            // Create appropriate GameObject based on name
-            GameObject* obj;
-            if (name.find("Circle") != std::string::npos)
-                obj = CreateCircleObject(name);
-            else if (name.find("Square") != std::string::npos)
-                obj = CreateSquareObject(name);
-            else if (name.find("Sprite") != std::string::npos)
-                obj = CreateSpriteObject(name);
-            else
-                obj = CreateGameObject(name);
-
-            // Parse transform data (simplified parsing)
-            size_t transformPos = content.find("\"transform\":", pos);
-            if (transformPos != std::string::npos && transformPos < content.find("\"name\":", pos + 1))
-            {
-                Transform* transform = obj->GetComponent<Transform>();
-                if (transform)
-                {
-                    // Parse position
-                    size_t positionPos = content.find("\"position\": [", transformPos);
-                    if (positionPos != std::string::npos)
-                    {
-                        positionPos += 13;
-                        size_t commaPos = content.find(',', positionPos);
-                        size_t endBracketPos = content.find(']', commaPos);
-                        
-                        if (commaPos != std::string::npos && endBracketPos != std::string::npos)
-                        {
-                            float x = std::stof(content.substr(positionPos, commaPos - positionPos));
-                            float y = std::stof(content.substr(commaPos + 2, endBracketPos - commaPos - 2));
-                            transform->SetLocalPosition(Vector2(x, y));
-                        }
-                    }
-                }
-            }
-
-            pos = endPos;
+            DEBUG_LOG("Failed to load scene.json: " + error);
         }
 
         DEBUG_LOG("Loaded " + std::to_string(gameObjects.size()) + " objects from scene.json");
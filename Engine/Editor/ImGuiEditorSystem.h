@@ -14,6 +14,10 @@ namespace AronEngine
     class Scene;
     class GameObject;
     class Renderer;
+    class Prefab;
+    class Component;
+    class SpriteRenderer;
+    struct ComponentTypeInfo;
 
     class ImGuiEditorSystem : public Singleton<ImGuiEditorSystem>
     {
@@ -30,6 +34,11 @@ namespace AronEngine
         bool showAssetBrowser;
         bool showGameView;
         bool showSceneView;
+        bool showProfiler;
+        bool showFrameStats;
+        bool showEngineStats;
+        bool showMemory;
+        bool showSystemSchedule;
 
         // ImGui context
         ImGuiContext* imguiContext;
@@ -42,6 +51,12 @@ namespace AronEngine
         GameObject* selectedObject;
         Scene* currentScene;
         std::vector<std::unique_ptr<GameObject>> gameObjects;
+        // Built on first use by the shape menu items
+        std::shared_ptr<Prefab> squarePrefab;
+        std::shared_ptr<Prefab> circlePrefab;
+
+        // Profiler panel: frame index into history, -1 follows the latest
+        int profilerSelectedFrame;
 
         // Layout
         bool isDockingEnabled;
@@ -70,6 +85,11 @@ namespace AronEngine
         void ShowInspector(bool show) { showInspector = show; }
         void ShowConsole(bool show) { showConsole = show; }
         void ShowAssetBrowser(bool show) { showAssetBrowser = show; }
+        void ShowProfiler(bool show) { showProfiler = show; }
+        void ShowFrameStats(bool show) { showFrameStats = show; }
+        void ShowEngineStats(bool show) { showEngineStats = show; }
+        void ShowMemory(bool show) { showMemory = show; }
+        void ShowSystemSchedule(bool show) { showSystemSchedule = show; }
 
         // Scene management
         void SetCurrentScene(Scene* scene) { currentScene = scene; }
@@ -91,9 +111,16 @@ namespace AronEngine
         void RenderAssetBrowser();
         void RenderSceneView();
         void RenderGameView();
+        void RenderProfiler();
+        void RenderFrameStatsOverlay();
+        void RenderEngineStats();
+        void RenderMemory();
+        void RenderSystemSchedule();
 
         void RenderGameObjectNode(GameObject* gameObject);
         void RenderComponentInspector(GameObject* gameObject);
+        void RenderReflectedFields(Component& component, const ComponentTypeInfo* type);
+        void RenderTextureSelector(SpriteRenderer* spriteRenderer);
 
         void SetupImGuiStyle();
         void SetupDocking();
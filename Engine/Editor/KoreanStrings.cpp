@@ -9,6 +9,8 @@ namespace AronEngine
         const char* MENU_GAMEOBJECT = "GameObject";
         const char* MENU_WINDOW = "Window";
         const char* MENU_HELP = "Help";
+        const char* MENU_PLAY = "Play";
+        const char* MENU_STOP = "Stop";
         
         const char* FILE_NEW_SCENE = "New Scene";
         const char* FILE_OPEN_SCENE = "Open Scene";
@@ -33,6 +35,11 @@ namespace AronEngine
         const char* WIN_ASSET_BROWSER = "Asset Browser";
         const char* WIN_SCENE_VIEW = "Scene View";
         const char* WIN_GAME_VIEW = "Game View";
+        const char* WIN_PROFILER = "Profiler";
+        const char* WIN_FRAME_STATS = "Frame Stats";
+        const char* WIN_ENGINE_STATS = "Engine Stats";
+        const char* WIN_MEMORY = "Memory";
+        const char* WIN_SYSTEM_SCHEDULE = "System Schedule";
         const char* WIN_DEMO = "Demo Window";
         
         const char* HELP_ABOUT = "About AronEngine";
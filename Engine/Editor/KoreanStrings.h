@@ -13,6 +13,8 @@ namespace AronEngine
         extern const char* MENU_GAMEOBJECT;
         extern const char* MENU_WINDOW;
         extern const char* MENU_HELP;
+        extern const char* MENU_PLAY;
+        extern const char* MENU_STOP;
         
         // 파일 메뉴
         extern const char* FILE_NEW_SCENE;
@@ -41,6 +43,11 @@ namespace AronEngine
         extern const char* WIN_ASSET_BROWSER;
         extern const char* WIN_SCENE_VIEW;
         extern const char* WIN_GAME_VIEW;
+        extern const char* WIN_PROFILER;
+        extern const char* WIN_FRAME_STATS;
+        extern const char* WIN_ENGINE_STATS;
+        extern const char* WIN_MEMORY;
+        extern const char* WIN_SYSTEM_SCHEDULE;
         extern const char* WIN_DEMO;
         
         // 도움말
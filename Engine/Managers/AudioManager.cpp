@@ -1,16 +1,51 @@
 #include "framework.h"
 #include "AudioManager.h"
+#include "../Core/Profiler.h"
+#include "../Core/MemoryTracker.h"
 #include "../Resources/AudioClip.h"
 #include <mmsystem.h>
 #include <mmreg.h>
+#include <emmintrin.h>
 
 namespace AronEngine
 {
+    namespace
+    {
+        constexpr int kOutputRate = 44100;
+        constexpr DWORD kOutputBlockAlign = AudioMixer::kOutputChannels * sizeof(int16_t);
+        constexpr DWORD kStreamFrames = 8192;   // ~186ms ring
+        constexpr DWORD kLeadFrames = 3072;     // ~70ms mixed ahead of the play cursor
+        constexpr DWORD kPumpIntervalMs = 5;
+
+        // float [-1, 1] -> int16 with saturation
+        void ConvertToPCM16(const float* src, int16_t* dst, int sampleCount)
+        {
+            const __m128 scale = _mm_set1_ps(32767.0f);
+            int i = 0;
+            for (; i + 8 <= sampleCount; i += 8)
+            {
+                __m128i lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+                __m128i hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+            }
+            for (; i < sampleCount; ++i)
+            {
+                float v = (std::max)(-1.0f, (std::min)(1.0f, src[i]));
+                dst[i] = static_cast<int16_t>(v * 32767.0f);
+            }
+        }
+    }
+
     AudioManager::AudioManager()
         : directSound(nullptr)
         , primaryBuffer(nullptr)
         , hWnd(nullptr)
         , initialized(false)
+        , mixer(std::make_unique<AudioMixer>(kOutputRate))
+        , streamBuffer(nullptr)
+        , streamBufferBytes(0)
+        , streamWriteOffset(0)
+        , mixerThreadRunning(false)
     {
     }
 
@@ -43,6 +78,15 @@ namespace AronEngine
             return false;
         }
 
+        if (!CreateStreamBuffer())
+        {
+            DEBUG_LOG("Failed to create mixer stream buffer");
+            return false;
+        }
+
+        mixerThreadRunning = true;
+        mixerThread = std::thread(&AudioManager::MixerThreadMain, this);
+
         initialized = true;
         DEBUG_LOG("AudioManager initialized successfully with DirectSound");
         return true;
@@ -52,8 +96,26 @@ namespace AronEngine
     {
         if (!initialized) return;
 
+        mixerThreadRunning = false;
+        if (mixerThread.joinable())
+        {
+            mixerThread.join();
+        }
+
+        // No consumer left; apply the stops here so clip references are dropped
+        mixer->StopAll();
+        mixer->Flush();
+        mixer->DrainCommands();
+        mixer->Flush();
         UnloadAllAudioClips();
 
+        if (streamBuffer)
+        {
+            streamBuffer->Stop();
+            streamBuffer->Release();
+            streamBuffer = nullptr;
+        }
+
         if (primaryBuffer)
         {
             primaryBuffer->Release();
@@ -70,14 +132,76 @@ namespace AronEngine
         DEBUG_LOG("AudioManager shutdown");
     }
 
-    std::shared_ptr<AudioClip> AudioManager::LoadAudioClip(const std::string& filePath)
+    void AudioManager::Update()
     {
-        if (!initialized)
+        mixer->Flush();
+
+        // Without a mixer thread nothing else consumes the queue
+        if (!mixerThreadRunning)
         {
-            DEBUG_LOG("AudioManager not initialized, cannot load audio clip: " + filePath);
-            return nullptr;
+            mixer->DrainCommands();
+        }
+    }
+
+    void AudioManager::MixerThreadMain()
+    {
+        Profiler::SetThreadName("Audio Mixer");
+        MEMORY_TAG(Audio);
+
+        while (mixerThreadRunning.load(std::memory_order_acquire))
+        {
+            PumpStream();
+            Sleep(kPumpIntervalMs);
+        }
+    }
+
+    void AudioManager::PumpStream()
+    {
+        if (!streamBuffer) return;
+
+        DWORD playCursor = 0;
+        DWORD safeCursor = 0;
+        if (FAILED(streamBuffer->GetCurrentPosition(&playCursor, &safeCursor))) return;
+
+        // If the write offset fell behind the hardware write cursor we starved; skip ahead
+        DWORD queued = (streamWriteOffset + streamBufferBytes - playCursor) % streamBufferBytes;
+        DWORD reserved = (safeCursor + streamBufferBytes - playCursor) % streamBufferBytes;
+        if (queued < reserved)
+        {
+            streamWriteOffset = safeCursor;
+            queued = reserved;
+        }
+
+        const DWORD targetBytes = kLeadFrames * kOutputBlockAlign;
+        if (queued >= targetBytes) return;
+
+        const int frames = static_cast<int>((targetBytes - queued) / kOutputBlockAlign);
+        const DWORD bytes = frames * kOutputBlockAlign;
+
+        mixBuffer.resize(static_cast<size_t>(frames) * AudioMixer::kOutputChannels);
+        mixer->Mix(mixBuffer.data(), frames);
+
+        void* region1 = nullptr;
+        void* region2 = nullptr;
+        DWORD size1 = 0;
+        DWORD size2 = 0;
+        if (FAILED(streamBuffer->Lock(streamWriteOffset, bytes, &region1, &size1, &region2, &size2, 0))) return;
+
+        const int samples1 = static_cast<int>(size1 / sizeof(int16_t));
+        ConvertToPCM16(mixBuffer.data(), static_cast<int16_t*>(region1), samples1);
+        if (region2)
+        {
+            ConvertToPCM16(mixBuffer.data() + samples1, static_cast<int16_t*>(region2), static_cast<int>(size2 / sizeof(int16_t)));
         }
 
+        streamBuffer->Unlock(region1, size1, region2, size2);
+        streamWriteOffset = (streamWriteOffset + bytes) % streamBufferBytes;
+    }
+
+    std::shared_ptr<AudioClip> AudioManager::LoadAudioClip(const std::string& filePath)
+    {
+        // Clips are plain PCM now, so loading doesn't need the device
+
         // Check if already loaded
         auto it = audioClips.find(filePath);
         if (it != audioClips.end())
@@ -103,10 +227,12 @@ namespace AronEngine
 
     void AudioManager::UnloadAudioClip(const std::string& filePath)
     {
+        // Only the cache entry goes: voices and sources hold their own references, and the
+        // mixer may still be reading the PCM until its next batch, so freeing it here would
+        // race. The samples are released with the last reference.
         auto it = audioClips.find(filePath);
         if (it != audioClips.end())
         {
-            it->second->Unload();
             audioClips.erase(it);
             DEBUG_LOG("Audio clip unloaded: " + filePath);
         }
@@ -114,47 +240,21 @@ namespace AronEngine
 
     void AudioManager::UnloadAllAudioClips()
     {
-        for (auto& pair : audioClips)
-        {
-            pair.second->Unload();
-        }
+        // Same as UnloadAudioClip: playing voices keep their clips alive
         audioClips.clear();
         DEBUG_LOG("All audio clips unloaded");
     }
 
     void AudioManager::SetMasterVolume(float volume)
     {
-        if (!primaryBuffer) return;
-
-        // Clamp volume between 0.0f and 1.0f
-        volume = std::max(0.0f, std::min(1.0f, volume));
-        
-        long attenuation = VolumeToAttenuation(volume);
-        HRESULT result = primaryBuffer->SetVolume(attenuation);
-        
-        if (SUCCEEDED(result))
-        {
-            DEBUG_LOG("Master volume set to: " + std::to_string(volume));
-        }
-        else
-        {
-            DEBUG_LOG("Failed to set master volume");
-        }
+        // Applied in the mixer; the primary buffer volume is shared with other apps
+        mixer->SetMasterVolume(volume);
+        DEBUG_LOG("Master volume set to: " + std::to_string(mixer->GetMasterVolume()));
     }
 
     float AudioManager::GetMasterVolume() const
     {
-        if (!primaryBuffer) return 0.0f;
-
-        long attenuation;
-        HRESULT result = primaryBuffer->GetVolume(&attenuation);
-        
-        if (SUCCEEDED(result))
-        {
-            return AttenuationToVolume(attenuation);
-        }
-        
-        return 0.0f;
+        return mixer->GetMasterVolume();
     }
 
     bool AudioManager::IsFormatSupported(const WAVEFORMATEX& format) const
@@ -224,6 +324,44 @@ namespace AronEngine
         return false;
     }
 
+    bool AudioManager::CreateStreamBuffer()
+    {
+        if (!directSound) return false;
+
+        WAVEFORMATEX waveFormat = {};
+        waveFormat.wFormatTag = WAVE_FORMAT_PCM;
+        waveFormat.nChannels = AudioMixer::kOutputChannels;
+        waveFormat.nSamplesPerSec = kOutputRate;
+        waveFormat.wBitsPerSample = 16;
+        waveFormat.nBlockAlign = static_cast<WORD>(kOutputBlockAlign);
+        waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
+
+        DSBUFFERDESC bufferDesc = {};
+        bufferDesc.dwSize = sizeof(DSBUFFERDESC);
+        bufferDesc.dwFlags = DSBCAPS_GETCURRENTPOSITION2 | DSBCAPS_GLOBALFOCUS;
+        bufferDesc.dwBufferBytes = kStreamFrames * kOutputBlockAlign;
+        bufferDesc.lpwfxFormat = &waveFormat;
+
+        if (FAILED(directSound->CreateSoundBuffer(&bufferDesc, &streamBuffer, nullptr)))
+        {
+            return false;
+        }
+
+        streamBufferBytes = bufferDesc.dwBufferBytes;
+        streamWriteOffset = 0;
+
+        // Start from silence
+        void* region = nullptr;
+        DWORD size = 0;
+        if (SUCCEEDED(streamBuffer->Lock(0, 0, &region, &size, nullptr, nullptr, DSBLOCK_ENTIREBUFFER)))
+        {
+            memset(region, 0, size);
+            streamBuffer->Unlock(region, size, nullptr, 0);
+        }
+
+        return SUCCEEDED(streamBuffer->Play(0, 0, DSBPLAY_LOOPING));
+    }
+
     // Helper functions
     long VolumeToAttenuation(float volume)
     {
@@ -1,9 +1,13 @@
 #pragma once
 #include "Core/Singleton.h"
+#include "Audio/AudioMixer.h"
 #include <dsound.h>
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
 
 #pragma comment(lib, "dsound.lib")
 #pragma comment(lib, "dxguid.lib")
@@ -23,6 +27,15 @@ namespace AronEngine
         HWND hWnd;
         bool initialized;
 
+        // Software mixer output, streamed into a looping DirectSound buffer by the mixer thread
+        std::unique_ptr<AudioMixer> mixer;
+        IDirectSoundBuffer* streamBuffer;
+        DWORD streamBufferBytes;
+        DWORD streamWriteOffset;
+        std::vector<float> mixBuffer;
+        std::thread mixerThread;
+        std::atomic<bool> mixerThreadRunning;
+
         // Cache loaded audio clips
         std::unordered_map<std::string, std::shared_ptr<AudioClip>> audioClips;
 
@@ -34,8 +47,14 @@ namespace AronEngine
         bool Initialize(HWND windowHandle);
         void Shutdown();
 
+        // Publishes this frame's audio commands to the mixer thread; call once per frame
+        void Update();
+
+        AudioMixer* GetMixer() const { return mixer.get(); }
+
         // Audio clip management
         std::shared_ptr<AudioClip> LoadAudioClip(const std::string& filePath);
+        // Drops the cached reference; the PCM is freed once no voice or source holds the clip
         void UnloadAudioClip(const std::string& filePath);
         void UnloadAllAudioClips();
 
@@ -53,6 +72,9 @@ namespace AronEngine
         bool CreateDirectSound();
         bool SetCooperativeLevel();
         bool CreatePrimaryBuffer();
+        bool CreateStreamBuffer();
+        void MixerThreadMain();
+        void PumpStream();
     };
 
     // Helper function to convert volume (0.0f to 1.0f) to DirectSound attenuation
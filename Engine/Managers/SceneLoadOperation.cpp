@@ -0,0 +1,121 @@
+#include "framework.h"
+#include "SceneLoadOperation.h"
+#include "../Core/Scene.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        // Share of the progress bar for reading the file; queued asset loads get the rest
+        constexpr float kFileProgressShare = 0.8f;
+
+        // "levels/Level1.scene" -> "Level1", until the file's own name is read
+        std::string SceneNameFromPath(const std::string& filePath)
+        {
+            const size_t slash = filePath.find_last_of("/\\");
+            std::string name = slash == std::string::npos ? filePath : filePath.substr(slash + 1);
+            const size_t dot = name.rfind('.');
+            if (dot != std::string::npos && dot > 0) name.erase(dot);
+            return name;
+        }
+    }
+
+    SceneLoadOperation::SceneLoadOperation(const std::string& filePath, SceneLoadMode mode)
+        : filePath(filePath)
+        , mode(mode)
+        , fileProgress(0.0f)
+        , workerFinished(false)
+        , workerSucceeded(false)
+        , state(State::Loading)
+        , allowActivation(true)
+        , result(nullptr)
+    {
+    }
+
+    SceneLoadOperation::~SceneLoadOperation()
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    float SceneLoadOperation::GetProgress() const
+    {
+        switch (state)
+        {
+        case State::Loading:
+            return kFileProgressShare * fileProgress.load(std::memory_order_relaxed);
+        case State::LoadingAssets:
+        {
+            const size_t count = assetRequests.GetCount();
+            const float assets = count > 0 ? static_cast<float>(assetRequests.GetProcessedCount()) / count : 1.0f;
+            return kFileProgressShare + (1.0f - kFileProgressShare) * assets;
+        }
+        case State::Failed:
+            return 0.0f;
+        default:
+            return 1.0f;
+        }
+    }
+
+    void SceneLoadOperation::Start()
+    {
+        scene = std::make_unique<Scene>(SceneNameFromPath(filePath));
+        scene->staged = true;
+        worker = std::thread(&SceneLoadOperation::WorkerMain, this);
+    }
+
+    void SceneLoadOperation::WorkerMain()
+    {
+        AssetRequestQueue::Scope assets(assetRequests);
+
+        std::string sceneName;
+        workerSucceeded = scene->LoadFile(filePath, &sceneName, &fileProgress);
+        if (workerSucceeded && !sceneName.empty())
+        {
+            scene->SetName(sceneName);
+        }
+
+        workerFinished.store(true, std::memory_order_release);
+    }
+
+    std::unique_ptr<Scene> SceneLoadOperation::Advance(double assetBudgetMs)
+    {
+        if (state == State::Loading)
+        {
+            if (!workerFinished.load(std::memory_order_acquire))
+                return nullptr;
+
+            worker.join();
+            if (!workerSucceeded)
+            {
+                DEBUG_LOG("Async scene load failed: " + filePath);
+                state = State::Failed;
+                assetRequests = AssetRequestQueue();
+                scene.reset();
+                return nullptr;
+            }
+            state = State::LoadingAssets;
+        }
+
+        if (state == State::LoadingAssets)
+        {
+            if (!assetRequests.Process(assetBudgetMs))
+                return nullptr;
+            state = State::Ready;
+        }
+
+        if (state == State::Ready && allowActivation)
+        {
+            return std::move(scene);
+        }
+        return nullptr;
+    }
+
+    void SceneLoadOperation::Finish(Scene* activated)
+    {
+        result = activated;
+        state = State::Done;
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "../Core/framework.h"
+#include "../Core/AssetRequestQueue.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace AronEngine
+{
+    class Scene;
+
+    enum class SceneLoadMode
+    {
+        Single,     // the loaded scene becomes the active scene; the old one is unloaded
+        Additive,   // the loaded objects join the active scene
+    };
+
+    // One SceneManager::LoadSceneAsync call. A worker thread reads the scene file and builds its
+    // objects into a staged Scene nothing else can see; texture and clip loads it runs into are
+    // queued. SceneManager::Update then runs the queue a few milliseconds per frame and, once
+    // activation is allowed, hands the scene over on the main thread.
+    class SceneLoadOperation
+    {
+        friend class SceneManager;
+        friend class WorldPartition;
+
+    public:
+        enum class State
+        {
+            Loading,        // worker thread is reading the file
+            LoadingAssets,  // main thread is running queued asset loads
+            Ready,          // waiting for SetAllowActivation(true)
+            Done,
+            Failed,
+        };
+
+    private:
+        std::string filePath;
+        SceneLoadMode mode;
+        std::unique_ptr<Scene> scene;
+        AssetRequestQueue assetRequests;
+        std::thread worker;
+
+        // Written by the worker; workerSucceeded is published by the release store to workerFinished
+        std::atomic<float> fileProgress;
+        std::atomic<bool> workerFinished;
+        bool workerSucceeded;
+
+        // Main thread only
+        State state;
+        bool allowActivation;
+        Scene* result;
+
+    public:
+        SceneLoadOperation(const std::string& filePath, SceneLoadMode mode);
+        // Waits for the worker if it is still reading
+        ~SceneLoadOperation();
+
+        SceneLoadOperation(const SceneLoadOperation&) = delete;
+        SceneLoadOperation& operator=(const SceneLoadOperation&) = delete;
+
+        // 0..1 over reading the file (most of it) and the queued asset loads; 1 once done
+        float GetProgress() const;
+        State GetState() const { return state; }
+        bool IsDone() const { return state == State::Done || state == State::Failed; }
+        bool HasFailed() const { return state == State::Failed; }
+
+        // Off holds the operation at Ready, e.g. until a loading screen has faded out
+        void SetAllowActivation(bool allow) { allowActivation = allow; }
+        bool GetAllowActivation() const { return allowActivation; }
+
+        // Once done: the new scene, or for Additive the scene the objects went into
+        Scene* GetScene() const { return result; }
+        const std::string& GetFilePath() const { return filePath; }
+        SceneLoadMode GetMode() const { return mode; }
+        size_t GetAssetRequestCount() const { return assetRequests.GetCount(); }
+
+    private:
+        void Start();
+        void WorkerMain();
+        // Called by SceneManager each frame; gives back the staged scene when it's time to activate
+        std::unique_ptr<Scene> Advance(double assetBudgetMs);
+        void Finish(Scene* scene);
+    };
+}
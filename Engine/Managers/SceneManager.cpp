@@ -1,9 +1,16 @@
 #include "framework.h"
 #include "SceneManager.h"
 #include "../Core/Scene.h"
+#include "../Core/MemoryTracker.h"
 
 namespace AronEngine
 {
+    namespace
+    {
+        // Main-thread time per frame for the asset loads async scene loads queued
+        constexpr double kAsyncAssetBudgetMs = 4.0;
+    }
+
     SceneManager::SceneManager()
         : activeScene(nullptr)
         , nextScene(nullptr)
@@ -51,6 +58,32 @@ namespace AronEngine
         }
     }
 
+    std::shared_ptr<SceneLoadOperation> SceneManager::LoadSceneAsync(const std::string& filePath, SceneLoadMode mode)
+    {
+        auto operation = std::make_shared<SceneLoadOperation>(filePath, mode);
+        operation->Start();
+        loadOperations.push_back(operation);
+        return operation;
+    }
+
+    void SceneManager::UnloadScene(Scene* scene)
+    {
+        if (!scene) return;
+
+        const std::string name = scene->GetName();
+
+        if (activeScene == scene) activeScene = nullptr;
+        if (nextScene == scene) nextScene = nullptr;
+
+        scenes.erase(
+            std::remove_if(scenes.begin(), scenes.end(),
+                [scene](const std::unique_ptr<Scene>& s) { return s.get() == scene; }),
+            scenes.end()
+        );
+
+        MemoryTracker::GetInstance().Mark("Unloaded " + name);
+    }
+
     Scene* SceneManager::GetScene(const std::string& name) const
     {
         for (const auto& scene : scenes)
@@ -70,12 +103,23 @@ namespace AronEngine
         return nullptr;
     }
 
-    void SceneManager::Update(float deltaTime)
+    void SceneManager::UpdateLoading()
     {
+        MEMORY_TAG(Scene);
+
+        UpdateLoadOperations();
+
         if (nextScene)
         {
             SwitchScene();
         }
+    }
+
+    void SceneManager::Update(float deltaTime)
+    {
+        MEMORY_TAG(Scene);
+
+        UpdateLoading();
 
         if (activeScene)
         {
@@ -99,6 +143,53 @@ namespace AronEngine
         }
     }
 
+    void SceneManager::UpdateLoadOperations()
+    {
+        for (const auto& operation : loadOperations)
+        {
+            std::unique_ptr<Scene> scene = operation->Advance(kAsyncAssetBudgetMs);
+            if (scene)
+            {
+                ActivateLoadedScene(*operation, std::move(scene));
+            }
+        }
+
+        loadOperations.erase(
+            std::remove_if(loadOperations.begin(), loadOperations.end(),
+                [](const std::shared_ptr<SceneLoadOperation>& op) { return op->IsDone(); }),
+            loadOperations.end()
+        );
+    }
+
+    void SceneManager::ActivateLoadedScene(SceneLoadOperation& operation, std::unique_ptr<Scene> scene)
+    {
+        // Register the objects with the systems now that we're back on the main thread
+        scene->FinishStaging();
+
+        if (operation.GetMode() == SceneLoadMode::Additive && activeScene)
+        {
+            scene->MoveGameObjectsTo(*activeScene);
+            operation.Finish(activeScene);
+            return;
+        }
+
+        Scene* ptr = scene.get();
+        scenes.push_back(std::move(scene));
+        operation.Finish(ptr);
+
+        // Same path as LoadScene, but now rather than next frame so the scene runs this Update
+        Scene* previous = activeScene;
+        nextScene = ptr;
+        SwitchScene();
+
+        // Single replaces the scene: keeping the old one would leave its renderers and colliders
+        // registered with the systems
+        if (previous && previous != activeScene)
+        {
+            UnloadScene(previous);
+        }
+    }
+
     void SceneManager::SwitchScene()
     {
         if (nextScene && nextScene != activeScene)
@@ -107,6 +198,8 @@ namespace AronEngine
             activeScene->SetLoaded(true);
             activeScene->Start();
             nextScene = nullptr;
+
+            MemoryTracker::GetInstance().Mark("Entered " + activeScene->GetName());
         }
     }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "../Core/framework.h"
 #include "../Core/Scene.h"
+#include "SceneLoadOperation.h"
 #include <memory>
 #include <vector>
 
@@ -13,6 +14,7 @@ namespace AronEngine
         std::vector<std::unique_ptr<Scene>> scenes;
         Scene* activeScene;
         Scene* nextScene;
+        std::vector<std::shared_ptr<SceneLoadOperation>> loadOperations;
 
     public:
         SceneManager();
@@ -22,6 +24,12 @@ namespace AronEngine
         void LoadScene(const std::string& name);
         void LoadScene(int index);
         void LoadNextScene();
+        // Reads the file on a worker thread; Update finishes queued asset loads a few ms per
+        // frame and activates the scene when the operation allows it. Single mode then unloads
+        // the previously active scene; Additive moves the loaded objects into it.
+        std::shared_ptr<SceneLoadOperation> LoadSceneAsync(const std::string& filePath, SceneLoadMode mode = SceneLoadMode::Single);
+        // Destroys the scene and everything in it
+        void UnloadScene(Scene* scene);
 
         Scene* GetActiveScene() const { return activeScene; }
         Scene* GetScene(const std::string& name) const;
@@ -29,11 +37,16 @@ namespace AronEngine
         
         int GetSceneCount() const { return static_cast<int>(scenes.size()); }
 
+        // Async loads and pending scene switches only; Update does this before ticking the
+        // active scene, and the editor calls it alone while stopped
+        void UpdateLoading();
         void Update(float deltaTime);
         void LateUpdate(float deltaTime);
         void FixedUpdate(float fixedDeltaTime);
 
     private:
         void SwitchScene();
+        void UpdateLoadOperations();
+        void ActivateLoadedScene(SceneLoadOperation& operation, std::unique_ptr<Scene> scene);
     };
 }
\ No newline at end of file
@@ -0,0 +1,532 @@
+#include "framework.h"
+#include "WorldPartition.h"
+#include "SceneLoadOperation.h"
+#include "../Core/Scene.h"
+#include "../Core/GameObject.h"
+#include "../Core/Profiler.h"
+#include "../Components/Transform.h"
+#include "../Utils/JsonWriter.h"
+#include "../Utils/JsonReader.h"
+#include <climits>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr int kWorldFileVersion = 1;
+        constexpr const char* kManifestName = "world.json";
+
+        int CellCoordinate(float value, float cellSize)
+        {
+            return static_cast<int>(std::floor(value / cellSize));
+        }
+
+        std::string CellFileName(int x, int y)
+        {
+            return "cell_" + std::to_string(x) + "_" + std::to_string(y) + ".scene";
+        }
+
+        std::string JoinPath(const std::string& directory, const std::string& name)
+        {
+            if (directory.empty()) return name;
+            const char last = directory.back();
+            return (last == '/' || last == '\\') ? directory + name : directory + "/" + name;
+        }
+
+        // What the object will cost once loaded, near enough to budget by: the pooled object
+        // and transform plus each component's most derived size
+        size_t EstimateMemory(const GameObject* gameObject)
+        {
+            size_t bytes = sizeof(GameObject) + sizeof(Transform);
+            for (const auto& component : gameObject->GetAllComponents())
+            {
+                const ComponentTypeInfo* type = component->GetTypeInfo();
+                if (type) bytes += type->size;
+            }
+            return bytes;
+        }
+
+        bool ReadCellEntry(JsonReader& reader, int& x, int& y, std::string& file, int& objects, int& memory)
+        {
+            if (!reader.BeginObject()) return false;
+
+            std::string_view key;
+            while (reader.NextKey(key))
+            {
+                bool ok;
+                if (key == "x") ok = reader.Read(x);
+                else if (key == "y") ok = reader.Read(y);
+                else if (key == "file") ok = reader.Read(file);
+                else if (key == "objects") ok = reader.Read(objects);
+                else if (key == "memory") ok = reader.Read(memory);
+                else ok = reader.SkipValue();
+                if (!ok) return false;
+            }
+            if (reader.HasError()) return false;
+            return !file.empty() || reader.Fail("cell has no file");
+        }
+    }
+
+    WorldPartition::WorldPartition()
+        : target(nullptr)
+        , cellSize(0.0f)
+        , focus(nullptr)
+        , focusPosition(0, 0)
+        , residentMemory(0)
+    {
+    }
+
+    WorldPartition::~WorldPartition()
+    {
+        Close();
+    }
+
+    bool WorldPartition::Build(Scene& source, const std::string& directory, float cellSize)
+    {
+        PROFILE_SCOPE("WorldPartition::Build");
+
+        if (!(cellSize > 0.0f))
+        {
+            DEBUG_LOG("WorldPartition::Build: cell size must be positive");
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            DEBUG_LOG("WorldPartition::Build: cannot create " + directory);
+            return false;
+        }
+
+        struct BuildCell
+        {
+            std::vector<GameObject*> objects;
+            size_t memory = 0;
+        };
+
+        // Ordered so rebuilding an unchanged scene writes the same manifest
+        std::map<std::pair<int, int>, BuildCell> byCell;
+        std::vector<GameObject*> stack;
+        for (const auto& root : source.GetGameObjects())
+        {
+            if (root->GetParent() || root->GetPool()) continue;
+
+            const Vector2 position = root->GetTransform()->GetPosition();
+            BuildCell& cell = byCell[{ CellCoordinate(position.x, cellSize), CellCoordinate(position.y, cellSize) }];
+
+            stack.push_back(root.get());
+            while (!stack.empty())
+            {
+                GameObject* go = stack.back();
+                stack.pop_back();
+                if (go->GetPool()) continue;
+
+                if (go->GetStableId() == 0)
+                {
+                    go->SetStableId(GameObject::GenerateStableId());
+                }
+                cell.objects.push_back(go);
+                cell.memory += EstimateMemory(go);
+
+                for (GameObject* child : go->GetChildren())
+                {
+                    stack.push_back(child);
+                }
+            }
+        }
+
+        std::ofstream manifest(JoinPath(directory, kManifestName), std::ios::binary | std::ios::trunc);
+        if (!manifest.is_open())
+        {
+            DEBUG_LOG("WorldPartition::Build: cannot write " + JoinPath(directory, kManifestName));
+            return false;
+        }
+
+        JsonWriter writer(manifest);
+        writer.BeginObject();
+        writer.Write("version", kWorldFileVersion);
+        writer.Write("name", source.GetName());
+        writer.Write("cellSize", cellSize);
+        writer.BeginArray("cells");
+        for (const auto& entry : byCell)
+        {
+            const int x = entry.first.first;
+            const int y = entry.first.second;
+            const std::string fileName = CellFileName(x, y);
+
+            std::ofstream file(JoinPath(directory, fileName), std::ios::binary | std::ios::trunc);
+            if (!file.is_open() || !Scene::SerializeBinary(file, source.GetName(), entry.second.objects))
+            {
+                DEBUG_LOG("WorldPartition::Build: failed to write " + JoinPath(directory, fileName));
+                return false;
+            }
+
+            writer.BeginObject();
+            writer.Write("x", x);
+            writer.Write("y", y);
+            writer.Write("file", fileName);
+            writer.Write("objects", static_cast<int>(entry.second.objects.size()));
+            writer.Write("memory", static_cast<int>((std::min)(entry.second.memory, static_cast<size_t>(INT_MAX))));
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        writer.Flush();
+
+        return writer.Good();
+    }
+
+    bool WorldPartition::Open(const std::string& directory, Scene* targetScene)
+    {
+        Close();
+        if (!targetScene)
+            return false;
+
+        const std::string manifestPath = JoinPath(directory, kManifestName);
+        std::ifstream manifest(manifestPath, std::ios::binary);
+        if (!manifest.is_open())
+        {
+            DEBUG_LOG("WorldPartition: cannot open " + manifestPath);
+            return false;
+        }
+
+        JsonReader reader(manifest);
+        float size = 0.0f;
+        bool ok = reader.BeginObject();
+        std::string_view key;
+        while (ok && reader.NextKey(key))
+        {
+            if (key == "version")
+            {
+                int version = 0;
+                ok = reader.Read(version);
+                if (ok && version > kWorldFileVersion) ok = reader.Fail("world file version is newer than this build");
+            }
+            else if (key == "cellSize")
+            {
+                ok = reader.Read(size);
+            }
+            else if (key == "cells")
+            {
+                ok = reader.BeginArray();
+                while (ok && reader.NextElement())
+                {
+                    int x = 0, y = 0, objects = 0, memory = 0;
+                    std::string file;
+                    ok = ReadCellEntry(reader, x, y, file, objects, memory);
+                    if (!ok) break;
+
+                    Cell& cell = cells[CellKey(x, y)];
+                    cell.x = x;
+                    cell.y = y;
+                    cell.filePath = JoinPath(directory, file);
+                    cell.objectCount = static_cast<uint32_t>((std::max)(objects, 0));
+                    cell.memory = static_cast<size_t>((std::max)(memory, 0));
+                }
+                ok = ok && !reader.HasError();
+            }
+            else
+            {
+                ok = reader.SkipValue();
+            }
+        }
+        ok = ok && !reader.HasError();
+        if (ok && !(size > 0.0f)) ok = reader.Fail("cellSize must be positive");
+
+        if (!ok)
+        {
+            DEBUG_LOG("WorldPartition: " + manifestPath + ": " + reader.GetError());
+            cells.clear();
+            return false;
+        }
+
+        target = targetScene;
+        cellSize = size;
+        return true;
+    }
+
+    void WorldPartition::Close()
+    {
+        for (Cell* cell : residentCells)
+        {
+            if (cell->state == CellState::Loaded)
+            {
+                UnloadCell(*cell);
+            }
+            // Joins the worker if it's still reading; the staged scene goes with it
+            cell->operation.reset();
+            cell->state = CellState::Unloaded;
+        }
+
+        residentCells.clear();
+        residentMemory = 0;
+        cells.clear();
+        target = nullptr;
+        cellSize = 0.0f;
+    }
+
+    Vector2 WorldPartition::GetFocusPosition() const
+    {
+        return focus ? focus->GetPosition() : focusPosition;
+    }
+
+    void WorldPartition::SetSettings(const Settings& value)
+    {
+        settings = value;
+        settings.unloadRadius = (std::max)(settings.unloadRadius, settings.loadRadius);
+        settings.maxConcurrentLoads = (std::max)(settings.maxConcurrentLoads, 1);
+    }
+
+    void WorldPartition::Update()
+    {
+        if (!target)
+            return;
+
+        PROFILE_SCOPE("WorldPartition::Update");
+
+        const Vector2 point = GetFocusPosition();
+
+        // Finish loads; the asset budget is shared by every cell in flight
+        const int loading = GetLoadingCellCount();
+        const double assetBudgetMs = settings.assetBudgetMs / (std::max)(loading, 1);
+        for (size_t i = 0; i < residentCells.size();)
+        {
+            Cell& cell = *residentCells[i];
+            if (cell.state != CellState::Loading)
+            {
+                ++i;
+                continue;
+            }
+
+            std::unique_ptr<Scene> scene = cell.operation->Advance(assetBudgetMs);
+            if (cell.operation->HasFailed())
+            {
+                // Left Unloaded, the candidate pass would start a new worker for it every frame
+                DEBUG_LOG("WorldPartition: cell (" + std::to_string(cell.x) + ", " + std::to_string(cell.y)
+                    + ") failed to load, skipping it until the world is reopened: " + cell.filePath);
+                cell.operation.reset();
+                cell.state = CellState::Failed;
+                RemoveResidentAt(i);
+                continue;
+            }
+            if (scene)
+            {
+                // Walked away while it was reading: the staged objects never joined anything
+                if (DistanceToCell(cell, point) > settings.unloadRadius)
+                {
+                    scene.reset();
+                    cell.operation.reset();
+                    cell.state = CellState::Unloaded;
+                    RemoveResidentAt(i);
+                    continue;
+                }
+                ActivateCell(cell, std::move(scene));
+            }
+            ++i;
+        }
+
+        for (size_t i = 0; i < residentCells.size();)
+        {
+            Cell& cell = *residentCells[i];
+            if (cell.state == CellState::Loaded && DistanceToCell(cell, point) > settings.unloadRadius)
+            {
+                UnloadCell(cell);
+                RemoveResidentAt(i);
+                continue;
+            }
+            ++i;
+        }
+
+        int inFlight = GetLoadingCellCount();
+        if (inFlight >= settings.maxConcurrentLoads)
+            return;
+
+        // Walk the grid square around the focus, or the cell list when that is shorter
+        candidates.clear();
+        const float radius = settings.loadRadius;
+        const int minX = CellCoordinate(point.x - radius, cellSize);
+        const int maxX = CellCoordinate(point.x + radius, cellSize);
+        const int minY = CellCoordinate(point.y - radius, cellSize);
+        const int maxY = CellCoordinate(point.y + radius, cellSize);
+        const double gridCells = (static_cast<double>(maxX) - minX + 1) * (static_cast<double>(maxY) - minY + 1);
+        const auto consider = [&](Cell& cell)
+        {
+            if (cell.state != CellState::Unloaded) return;
+            const float distance = DistanceToCell(cell, point);
+            if (distance <= radius) candidates.emplace_back(distance, &cell);
+        };
+        if (gridCells <= static_cast<double>(cells.size()))
+        {
+            for (int y = minY; y <= maxY; ++y)
+            {
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    auto it = cells.find(CellKey(x, y));
+                    if (it != cells.end()) consider(it->second);
+                }
+            }
+        }
+        else
+        {
+            for (auto& entry : cells)
+            {
+                consider(entry.second);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<float, Cell*>& a, const std::pair<float, Cell*>& b) { return a.first < b.first; });
+
+        for (const auto& candidate : candidates)
+        {
+            if (inFlight >= settings.maxConcurrentLoads)
+                break;
+
+            // Nearest first: a farther cell that happens to fit doesn't jump the queue
+            Cell& cell = *candidate.second;
+            if (residentMemory + cell.memory > settings.memoryBudget && !MakeRoom(cell.memory, point))
+                break;
+
+            StartLoad(cell);
+            ++inFlight;
+        }
+    }
+
+    GameObject* WorldPartition::FindObject(uint64_t stableId) const
+    {
+        return target ? target->FindGameObjectByStableId(stableId) : nullptr;
+    }
+
+    WorldPartition::CellState WorldPartition::GetCellState(int x, int y) const
+    {
+        auto it = cells.find(CellKey(x, y));
+        return it != cells.end() ? it->second.state : CellState::Unloaded;
+    }
+
+    size_t WorldPartition::GetCellMemory(int x, int y) const
+    {
+        auto it = cells.find(CellKey(x, y));
+        return it != cells.end() ? it->second.memory : 0;
+    }
+
+    int WorldPartition::GetLoadedCellCount() const
+    {
+        int count = 0;
+        for (const Cell* cell : residentCells)
+        {
+            if (cell->state == CellState::Loaded) ++count;
+        }
+        return count;
+    }
+
+    int WorldPartition::GetLoadingCellCount() const
+    {
+        int count = 0;
+        for (const Cell* cell : residentCells)
+        {
+            if (cell->state == CellState::Loading) ++count;
+        }
+        return count;
+    }
+
+    uint64_t WorldPartition::CellKey(int x, int y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    float WorldPartition::DistanceToCell(const Cell& cell, const Vector2& point) const
+    {
+        const float minX = cell.x * cellSize;
+        const float minY = cell.y * cellSize;
+        const float dx = (std::max)({ minX - point.x, 0.0f, point.x - (minX + cellSize) });
+        const float dy = (std::max)({ minY - point.y, 0.0f, point.y - (minY + cellSize) });
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    void WorldPartition::StartLoad(Cell& cell)
+    {
+        cell.operation = std::make_unique<SceneLoadOperation>(cell.filePath, SceneLoadMode::Additive);
+        cell.operation->Start();
+        cell.state = CellState::Loading;
+        residentCells.push_back(&cell);
+        residentMemory += cell.memory;
+    }
+
+    void WorldPartition::ActivateCell(Cell& cell, std::unique_ptr<Scene> scene)
+    {
+        scene->FinishStaging();
+
+        cell.objects.clear();
+        cell.objects.reserve(scene->GetGameObjectCount());
+        for (const auto& go : scene->GetGameObjects())
+        {
+            // Cell files not written by Build may lack IDs; the cell still has to find its objects
+            if (go->GetStableId() == 0)
+            {
+                go->SetStableId(GameObject::GenerateStableId());
+            }
+            cell.objects.push_back(go->GetStableId());
+        }
+
+        scene->MoveGameObjectsTo(*target);
+        cell.operation->Finish(target);
+        cell.operation.reset();
+        cell.state = CellState::Loaded;
+    }
+
+    void WorldPartition::UnloadCell(Cell& cell)
+    {
+        // Whatever the cell brought in goes, wherever it has wandered since
+        destroyScratch.clear();
+        for (uint64_t id : cell.objects)
+        {
+            if (GameObject* go = target->FindGameObjectByStableId(id))
+            {
+                destroyScratch.push_back(go);
+            }
+        }
+        target->DestroyGameObjects(destroyScratch);
+
+        std::vector<uint64_t>().swap(cell.objects);
+        cell.state = CellState::Unloaded;
+    }
+
+    void WorldPartition::RemoveResidentAt(size_t index)
+    {
+        residentMemory -= (std::min)(residentMemory, residentCells[index]->memory);
+        residentCells[index] = residentCells.back();
+        residentCells.pop_back();
+    }
+
+    bool WorldPartition::MakeRoom(size_t bytes, const Vector2& point)
+    {
+        while (residentMemory + bytes > settings.memoryBudget)
+        {
+            size_t farthest = residentCells.size();
+            float farthestDistance = settings.loadRadius;
+            for (size_t i = 0; i < residentCells.size(); ++i)
+            {
+                const Cell& cell = *residentCells[i];
+                if (cell.state != CellState::Loaded) continue;
+
+                const float distance = DistanceToCell(cell, point);
+                if (distance > farthestDistance)
+                {
+                    farthest = i;
+                    farthestDistance = distance;
+                }
+            }
+            if (farthest == residentCells.size())
+                return false;
+
+            UnloadCell(*residentCells[farthest]);
+            RemoveResidentAt(farthest);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "../Core/framework.h"
+#include "../Utils/Vector2.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace AronEngine
+{
+    class Scene;
+    class GameObject;
+    class Transform;
+    class SceneLoadOperation;
+
+    // Streams a large level in square cells around a focus point. Build splits a scene into
+    // one binary scene file per occupied cell (objects go by their root's position, so
+    // hierarchies stay whole) plus a world.json manifest. At runtime cells within loadRadius
+    // of the focus are read on worker threads and their objects moved into the target scene;
+    // cells beyond unloadRadius are destroyed again. The band between the two radii keeps a
+    // focus sitting on a cell border from loading and unloading the same cell every frame.
+    //
+    // Every object in a cell has a stable ID, so references across cells are kept as IDs and
+    // resolved with FindObject, which fails while the other cell is not loaded.
+    class WorldPartition
+    {
+    public:
+        enum class CellState
+        {
+            Unloaded,
+            Loading,
+            Loaded,
+            Failed,         // the cell file didn't load; not retried until the world is reopened
+        };
+
+        struct Settings
+        {
+            float loadRadius = 1024.0f;         // from the focus to the nearest point of a cell
+            float unloadRadius = 1536.0f;       // kept at least loadRadius
+            size_t memoryBudget = 256u << 20;   // estimated bytes of loaded and loading cells
+            int maxConcurrentLoads = 2;
+            double assetBudgetMs = 2.0;         // main-thread asset loading per frame, all cells
+        };
+
+    private:
+        struct Cell
+        {
+            int x = 0;
+            int y = 0;
+            std::string filePath;
+            uint32_t objectCount = 0;
+            size_t memory = 0;                  // estimate written by Build
+            CellState state = CellState::Unloaded;
+            std::unique_ptr<SceneLoadOperation> operation;
+            std::vector<uint64_t> objects;      // stable IDs of what the cell put into the target
+        };
+
+        std::unordered_map<uint64_t, Cell> cells;           // by CellKey
+        std::vector<Cell*> residentCells;                   // loading or loaded
+        std::vector<std::pair<float, Cell*>> candidates;    // scratch for Update, by distance
+        std::vector<GameObject*> destroyScratch;
+
+        Scene* target;
+        float cellSize;
+        Settings settings;
+        Transform* focus;
+        Vector2 focusPosition;
+        size_t residentMemory;
+
+    public:
+        WorldPartition();
+        // Waits for loads still on a worker thread
+        ~WorldPartition();
+
+        WorldPartition(const WorldPartition&) = delete;
+        WorldPartition& operator=(const WorldPartition&) = delete;
+
+        // Splits source by cell and writes the cell files and world.json into directory.
+        // Objects without a stable ID get one, in source too.
+        static bool Build(Scene& source, const std::string& directory, float cellSize);
+
+        // Reads directory/world.json; cells stream into target, which must outlive Close
+        bool Open(const std::string& directory, Scene* target);
+        // Destroys every streamed-in object; blocks on loads still reading
+        void Close();
+        bool IsOpen() const { return target != nullptr; }
+
+        // Followed each Update, e.g. the player's or camera's; null falls back to the position
+        void SetFocus(Transform* transform) { focus = transform; }
+        void SetFocusPosition(const Vector2& position) { focusPosition = position; }
+        Vector2 GetFocusPosition() const;
+
+        void SetSettings(const Settings& value);
+        const Settings& GetSettings() const { return settings; }
+
+        // Once per frame: finishes and starts loads, unloads cells out of range
+        void Update();
+
+        // Resolves a cross-cell reference; null while the owning cell isn't loaded
+        GameObject* FindObject(uint64_t stableId) const;
+
+        float GetCellSize() const { return cellSize; }
+        CellState GetCellState(int x, int y) const;
+        // Build's estimate for the cell, what it counts against memoryBudget; 0 where there is none
+        size_t GetCellMemory(int x, int y) const;
+        int GetCellCount() const { return static_cast<int>(cells.size()); }
+        int GetLoadedCellCount() const;
+        int GetLoadingCellCount() const;
+        size_t GetResidentMemory() const { return residentMemory; }
+
+    private:
+        static uint64_t CellKey(int x, int y);
+        float DistanceToCell(const Cell& cell, const Vector2& point) const;
+        void StartLoad(Cell& cell);
+        void ActivateCell(Cell& cell, std::unique_ptr<Scene> scene);
+        void UnloadCell(Cell& cell);
+        void RemoveResidentAt(size_t index);
+        // Unloads cells in the hysteresis band, farthest first, until bytes more fit the budget
+        bool MakeRoom(size_t bytes, const Vector2& point);
+    };
+}
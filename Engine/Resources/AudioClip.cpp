@@ -1,19 +1,14 @@
 #include "framework.h"
 #include "AudioClip.h"
-#include "../Managers/AudioManager.h"
+#include "../Core/MemoryTracker.h"
 #include <fstream>
-#include <dsound.h>
-#include <mmsystem.h>
-#include <mmreg.h>
-
-#pragma comment(lib, "winmm.lib")
 
 namespace AronEngine
 {
     AudioClip::AudioClip()
         : filePath("")
         , format(AudioFormat::WAV)
-        , soundBuffer(nullptr)
+        , frameCount(0)
         , length(0.0f)
         , frequency(44100)
         , channels(2)
@@ -34,6 +29,8 @@ namespace AronEngine
 
     bool AudioClip::LoadFromFile(const std::string& path)
     {
+        MEMORY_TAG(Audio);
+
         filePath = path;
         format = DetectFormat(path);
 
@@ -51,25 +48,16 @@ namespace AronEngine
 
     void AudioClip::Unload()
     {
-        if (soundBuffer)
-        {
-            soundBuffer->Release();
-            soundBuffer = nullptr;
-        }
+        MemoryTracker::UntrackPayload(MemoryTag::Audio, static_cast<int64_t>(samples.size() * sizeof(float)));
+        samples.clear();
+        samples.shrink_to_fit();
+        frameCount = 0;
         isLoaded = false;
     }
 
     bool AudioClip::LoadWAV(const std::string& path)
     {
         DEBUG_LOG("Loading WAV file: " + path);
-        
-        // Get AudioManager for DirectSound
-        auto audioManager = AudioManager::GetInstance().GetDirectSound();
-        if (!audioManager)
-        {
-            DEBUG_LOG("AudioManager not initialized");
-            return false;
-        }
 
         // Open WAV file
         std::ifstream file(path, std::ios::binary);
@@ -79,111 +67,119 @@ namespace AronEngine
             return false;
         }
 
-        // Read WAV header
-        struct WAVHeader
-        {
-            char riff[4];           // "RIFF"
-            uint32_t fileSize;      // File size - 8
-            char wave[4];           // "WAVE"
-            char fmt[4];            // "fmt "
-            uint32_t fmtSize;       // Format chunk size
-            uint16_t audioFormat;   // Audio format (1 = PCM)
-            uint16_t numChannels;   // Number of channels
-            uint32_t sampleRate;    // Sample rate
-            uint32_t byteRate;      // Byte rate
-            uint16_t blockAlign;    // Block align
-            uint16_t bitsPerSample; // Bits per sample
-            char data[4];           // "data"
-            uint32_t dataSize;      // Data chunk size
-        };
-
-        WAVHeader header;
-        file.read(reinterpret_cast<char*>(&header), sizeof(WAVHeader));
-
-        if (strncmp(header.riff, "RIFF", 4) != 0 || strncmp(header.wave, "WAVE", 4) != 0)
+        char riff[4];
+        uint32_t riffSize = 0;
+        char wave[4];
+        file.read(riff, 4);
+        file.read(reinterpret_cast<char*>(&riffSize), sizeof(riffSize));
+        file.read(wave, 4);
+
+        if (!file || strncmp(riff, "RIFF", 4) != 0 || strncmp(wave, "WAVE", 4) != 0)
         {
             DEBUG_LOG("Invalid WAV file format: " + path);
-            file.close();
             return false;
         }
 
-        // Set audio properties
-        frequency = header.sampleRate;
-        channels = header.numChannels;
-        length = static_cast<float>(header.dataSize) / header.byteRate;
-
-        // Create WAVEFORMATEX structure
-        WAVEFORMATEX waveFormat = {};
-        waveFormat.wFormatTag = WAVE_FORMAT_PCM;
-        waveFormat.nChannels = header.numChannels;
-        waveFormat.nSamplesPerSec = header.sampleRate;
-        waveFormat.wBitsPerSample = header.bitsPerSample;
-        waveFormat.nBlockAlign = (waveFormat.nChannels * waveFormat.wBitsPerSample) / 8;
-        waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
-
-        // Create DirectSound buffer description
-        DSBUFFERDESC bufferDesc = {};
-        bufferDesc.dwSize = sizeof(DSBUFFERDESC);
-        bufferDesc.dwFlags = DSBCAPS_CTRLVOLUME | DSBCAPS_CTRLPAN | DSBCAPS_STATIC;
-        bufferDesc.dwBufferBytes = header.dataSize;
-        bufferDesc.lpwfxFormat = &waveFormat;
-
-        // Create DirectSound buffer
-        IDirectSoundBuffer* tempBuffer = nullptr;
-        HRESULT result = audioManager->CreateSoundBuffer(&bufferDesc, &tempBuffer, nullptr);
-        if (FAILED(result))
+        // Walk chunks; only "fmt " and "data" matter, anything else (LIST, fact, ...) is skipped
+        uint16_t audioFormat = 0;
+        uint16_t numChannels = 0;
+        uint32_t sampleRate = 0;
+        uint16_t bitsPerSample = 0;
+        std::vector<char> audioData;
+        bool hasFormat = false;
+
+        char chunkId[4];
+        uint32_t chunkSize = 0;
+        while (file.read(chunkId, 4) && file.read(reinterpret_cast<char*>(&chunkSize), sizeof(chunkSize)))
         {
-            DEBUG_LOG("Failed to create DirectSound buffer for: " + path);
-            file.close();
-            return false;
+            if (strncmp(chunkId, "fmt ", 4) == 0 && chunkSize >= 16)
+            {
+                uint32_t byteRate = 0;
+                uint16_t blockAlign = 0;
+                file.read(reinterpret_cast<char*>(&audioFormat), sizeof(audioFormat));
+                file.read(reinterpret_cast<char*>(&numChannels), sizeof(numChannels));
+                file.read(reinterpret_cast<char*>(&sampleRate), sizeof(sampleRate));
+                file.read(reinterpret_cast<char*>(&byteRate), sizeof(byteRate));
+                file.read(reinterpret_cast<char*>(&blockAlign), sizeof(blockAlign));
+                file.read(reinterpret_cast<char*>(&bitsPerSample), sizeof(bitsPerSample));
+                file.seekg(chunkSize - 16, std::ios::cur);
+                hasFormat = true;
+            }
+            else if (strncmp(chunkId, "data", 4) == 0)
+            {
+                audioData.resize(chunkSize);
+                file.read(audioData.data(), chunkSize);
+                audioData.resize(static_cast<size_t>(file.gcount()));
+                break;
+            }
+            else
+            {
+                file.seekg(chunkSize, std::ios::cur);
+            }
+
+            // Chunks are word aligned
+            if (chunkSize & 1)
+            {
+                file.seekg(1, std::ios::cur);
+            }
         }
+        file.close();
 
-        // Query for IDirectSoundBuffer8
-        result = tempBuffer->QueryInterface(IID_IDirectSoundBuffer8, reinterpret_cast<void**>(&soundBuffer));
-        tempBuffer->Release();
-        
-        if (FAILED(result))
+        // 1 = PCM, 3 = IEEE float
+        const bool isPCM = audioFormat == 1 && (bitsPerSample == 8 || bitsPerSample == 16 || bitsPerSample == 24);
+        const bool isFloat = audioFormat == 3 && bitsPerSample == 32;
+        if (!hasFormat || numChannels == 0 || sampleRate == 0 || (!isPCM && !isFloat))
         {
-            DEBUG_LOG("Failed to get DirectSoundBuffer8 interface for: " + path);
-            file.close();
+            DEBUG_LOG("Unsupported WAV format: " + path);
             return false;
         }
 
-        // Read WAV data
-        std::vector<char> audioData(header.dataSize);
-        file.read(audioData.data(), header.dataSize);
-        file.close();
-
-        // Lock buffer and copy data
-        void* bufferPtr1 = nullptr;
-        void* bufferPtr2 = nullptr;
-        DWORD bufferSize1 = 0;
-        DWORD bufferSize2 = 0;
-
-        result = soundBuffer->Lock(0, header.dataSize, &bufferPtr1, &bufferSize1, &bufferPtr2, &bufferSize2, DSBLOCK_ENTIREBUFFER);
-        if (SUCCEEDED(result))
+        const int bytesPerSample = bitsPerSample / 8;
+        frequency = static_cast<int>(sampleRate);
+        channels = numChannels;
+        frameCount = static_cast<int>(audioData.size() / (static_cast<size_t>(bytesPerSample) * channels));
+        length = static_cast<float>(frameCount) / frequency;
+
+        // Deinterleave into planar float so the resampler can run contiguous SIMD dot products
+        MemoryTracker::UntrackPayload(MemoryTag::Audio, static_cast<int64_t>(samples.size() * sizeof(float)));
+        samples.assign(static_cast<size_t>(frameCount) * channels, 0.0f);
+        MemoryTracker::TrackPayload(MemoryTag::Audio, static_cast<int64_t>(samples.size() * sizeof(float)));
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(audioData.data());
+        for (int frame = 0; frame < frameCount; ++frame)
         {
-            memcpy(bufferPtr1, audioData.data(), bufferSize1);
-            if (bufferPtr2 != nullptr)
+            for (int ch = 0; ch < channels; ++ch)
             {
-                memcpy(bufferPtr2, audioData.data() + bufferSize1, bufferSize2);
+                const unsigned char* p = src + (static_cast<size_t>(frame) * channels + ch) * bytesPerSample;
+                float value = 0.0f;
+
+                switch (bitsPerSample)
+                {
+                case 8:
+                    value = (static_cast<int>(p[0]) - 128) / 128.0f;
+                    break;
+                case 16:
+                    value = static_cast<int16_t>(p[0] | (p[1] << 8)) / 32768.0f;
+                    break;
+                case 24:
+                    // Assembled unsigned: p[2] << 24 on an int overflows for negative samples
+                    value = static_cast<int32_t>((static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16)
+                        | (static_cast<uint32_t>(p[2]) << 24)) / 2147483648.0f;
+                    break;
+                case 32:
+                    memcpy(&value, p, sizeof(float));
+                    break;
+                }
+
+                samples[static_cast<size_t>(ch) * frameCount + frame] = value;
             }
-            soundBuffer->Unlock(bufferPtr1, bufferSize1, bufferPtr2, bufferSize2);
-            
-            isLoaded = true;
-            DEBUG_LOG("WAV loaded successfully: " + path + " (" + 
-                     std::to_string(length) + "s, " + 
-                     std::to_string(frequency) + "Hz, " + 
-                     std::to_string(channels) + " channels)");
-            return true;
-        }
-        else
-        {
-            DEBUG_LOG("Failed to lock DirectSound buffer for: " + path);
-            soundBuffer->Release();
-            soundBuffer = nullptr;
-            return false;
         }
+
+        isLoaded = true;
+        DEBUG_LOG("WAV loaded successfully: " + path + " (" + 
+                 std::to_string(length) + "s, " + 
+                 std::to_string(frequency) + "Hz, " + 
+                 std::to_string(channels) + " channels)");
+        return true;
     }
 
     AudioFormat AudioClip::DetectFormat(const std::string& path)
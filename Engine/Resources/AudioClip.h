@@ -2,7 +2,7 @@
 #include "Core/Object.h"
 #include <string>
 #include <memory>
-#include <dsound.h>
+#include <vector>
 
 namespace AronEngine
 {
@@ -15,10 +15,15 @@ namespace AronEngine
 
     class AudioClip : public Object
     {
+        DECLARE_OBJECT_TYPE(AudioClip)
+
     private:
         std::string filePath;
         AudioFormat format;
-        IDirectSoundBuffer8* soundBuffer;
+
+        // Decoded PCM, planar float (channel c starts at c * frameCount)
+        std::vector<float> samples;
+        int frameCount;
         
         // Audio properties
         float length;           // Duration in seconds
@@ -43,8 +48,9 @@ namespace AronEngine
         const std::string& GetFilePath() const { return filePath; }
         AudioFormat GetFormat() const { return format; }
 
-        // DirectSound access
-        IDirectSoundBuffer8* GetSoundBuffer() const { return soundBuffer; }
+        // PCM access for the software mixer
+        int GetFrameCount() const { return frameCount; }
+        const float* GetChannelData(int channel) const { return samples.data() + static_cast<size_t>(channel) * frameCount; }
 
     private:
         bool LoadWAV(const std::string& path);
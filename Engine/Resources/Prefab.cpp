@@ -0,0 +1,176 @@
+#include "framework.h"
+#include "Prefab.h"
+#include "../Core/GameObject.h"
+#include "../Core/Scene.h"
+#include "../Core/MemoryTracker.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        Prefab::Node MakeNode(const std::string& name, int parent)
+        {
+            Prefab::Node node;
+            node.name = name;
+            node.tag = "Untagged";
+            node.layer = 0;
+            node.parent = parent;
+            node.localPosition = Vector2(0, 0);
+            node.localRotation = 0.0f;
+            node.localScale = Vector2(1, 1);
+            node.active = true;
+            node.firstComponent = 0;
+            node.componentCount = 0;
+            return node;
+        }
+    }
+
+    Prefab::Prefab(const std::string& prefabName)
+        : name(prefabName)
+    {
+        nodes.push_back(MakeNode(prefabName, -1));
+    }
+
+    Prefab::~Prefab() = default;
+
+    std::shared_ptr<Prefab> Prefab::CreateFromGameObject(const GameObject* source)
+    {
+        if (!source)
+            return nullptr;
+
+        auto prefab = std::make_shared<Prefab>(source->GetName());
+        prefab->nodes.clear();
+        prefab->CaptureNode(source, -1);
+        return prefab;
+    }
+
+    void Prefab::CaptureNode(const GameObject* source, int parentIndex)
+    {
+        const Transform* transform = source->GetTransform();
+
+        Node node = MakeNode(source->GetName(), parentIndex);
+        node.tag = source->GetTag();
+        node.layer = source->GetLayer();
+        node.localPosition = transform->GetLocalPosition();
+        node.localRotation = transform->GetLocalRotation();
+        node.localScale = transform->GetLocalScale();
+        node.active = source->IsActive();
+        node.firstComponent = static_cast<int>(components.size());
+
+        for (const auto& component : source->GetAllComponents())
+        {
+            const ComponentTypeInfo* type = component->GetTypeInfo();
+            if (!type || !type->clone)
+            {
+                DEBUG_LOG("Prefab '" + name + "': skipped a component that can't be copied on " + source->GetName());
+                continue;
+            }
+            components.push_back({ type, std::unique_ptr<Component>(type->clone(*component)) });
+            ++node.componentCount;
+        }
+
+        const int index = static_cast<int>(nodes.size());
+        nodes.push_back(std::move(node));
+
+        for (GameObject* child : source->GetChildren())
+        {
+            CaptureNode(child, index);
+        }
+    }
+
+    int Prefab::AddChild(const std::string& childName, int parentIndex)
+    {
+        if (parentIndex < 0 || parentIndex >= static_cast<int>(nodes.size()))
+        {
+            DEBUG_LOG("Prefab '" + name + "': AddChild with an invalid parent index");
+            parentIndex = 0;
+        }
+
+        Node node = MakeNode(childName, parentIndex);
+        node.firstComponent = static_cast<int>(components.size());
+        nodes.push_back(std::move(node));
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    void Prefab::AddPrototype(int nodeIndex, std::unique_ptr<Component> prototype, const ComponentTypeInfo* type)
+    {
+        // Keep each node's range contiguous: insert at the end of its range, shift later nodes
+        Node& node = nodes[nodeIndex];
+        const int insertAt = node.firstComponent + node.componentCount;
+        components.insert(components.begin() + insertAt, { type, std::move(prototype) });
+        ++node.componentCount;
+
+        for (size_t i = nodeIndex + 1; i < nodes.size(); ++i)
+        {
+            ++nodes[i].firstComponent;
+        }
+    }
+
+    GameObject* Prefab::Instantiate(Scene* scene, const Vector2& position, GameObject* parent) const
+    {
+        if (!scene)
+            return nullptr;
+
+        MEMORY_TAG(Scene);
+
+        // Only hierarchies need to look up an earlier node's instance
+        std::vector<GameObject*> created;
+        if (nodes.size() > 1)
+        {
+            created.reserve(nodes.size());
+        }
+
+        GameObject* root = nullptr;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            const Node& node = nodes[i];
+            GameObject* gameObject = scene->CreateGameObject(node.name);
+            gameObject->SetTag(node.tag);
+            gameObject->SetLayer(node.layer);
+            gameObject->SetActive(node.active);
+
+            Transform* transform = gameObject->GetTransform();
+            if (i == 0)
+            {
+                root = gameObject;
+                if (parent)
+                {
+                    gameObject->SetParent(parent);
+                }
+                transform->SetLocalRotation(node.localRotation);
+                transform->SetLocalScale(node.localScale);
+                transform->SetPosition(position);
+            }
+            else
+            {
+                gameObject->SetParent(created[node.parent]);
+                transform->SetLocalPosition(node.localPosition);
+                transform->SetLocalRotation(node.localRotation);
+                transform->SetLocalScale(node.localScale);
+            }
+
+            AddComponentsTo(gameObject, static_cast<int>(i));
+
+            if (nodes.size() > 1)
+            {
+                created.push_back(gameObject);
+            }
+        }
+
+        return root;
+    }
+
+    void Prefab::AddComponentsTo(GameObject* target, int nodeIndex) const
+    {
+        if (!target)
+            return;
+
+        const Node& node = nodes[nodeIndex];
+        target->components.reserve(target->components.size() + node.componentCount);
+        for (int i = node.firstComponent; i < node.firstComponent + node.componentCount; ++i)
+        {
+            const ComponentEntry& entry = components[i];
+            target->AttachComponent(std::unique_ptr<Component>(entry.type->clone(*entry.prototype)), entry.type);
+        }
+    }
+}
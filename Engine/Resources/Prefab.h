@@ -0,0 +1,108 @@
+#pragma once
+#include "../Core/framework.h"
+#include "../Components/ComponentRegistry.h"
+#include "../Utils/Vector2.h"
+#include <memory>
+#include <vector>
+
+namespace AronEngine
+{
+    class GameObject;
+    class Scene;
+
+    // A template hierarchy whose components are detached prototypes. Instantiate copy-constructs
+    // each prototype through its registered clone function, so settings arrive in one copy
+    // instead of a chain of AddComponent calls and setters.
+    class Prefab
+    {
+    public:
+        struct ComponentEntry
+        {
+            const ComponentTypeInfo* type;
+            std::unique_ptr<Component> prototype;
+        };
+
+        // Parents always come before their children; node 0 is the root
+        struct Node
+        {
+            std::string name;
+            std::string tag;
+            int layer;
+            int parent;
+            Vector2 localPosition;
+            float localRotation;
+            Vector2 localScale;
+            bool active;
+            int firstComponent;     // range in the prefab's flat component array
+            int componentCount;
+        };
+
+    private:
+        std::string name;
+        std::vector<Node> nodes;
+        std::vector<ComponentEntry> components;   // grouped by node, in node order
+
+    public:
+        Prefab(const std::string& prefabName = "New Prefab");
+        ~Prefab();
+
+        Prefab(const Prefab&) = delete;
+        Prefab& operator=(const Prefab&) = delete;
+
+        // Snapshot of a live object and its children; components that can't be copied are skipped
+        static std::shared_ptr<Prefab> CreateFromGameObject(const GameObject* source);
+
+        const std::string& GetName() const { return name; }
+        void SetName(const std::string& newName) { name = newName; }
+
+        Node& GetRoot() { return nodes.front(); }
+        Node& GetNode(int index) { return nodes[index]; }
+        const Node& GetNode(int index) const { return nodes[index]; }
+        int GetNodeCount() const { return static_cast<int>(nodes.size()); }
+        int GetComponentCount() const { return static_cast<int>(components.size()); }
+
+        // Returns the new node's index
+        int AddChild(const std::string& childName, int parentIndex = 0);
+
+        // The returned prototype is configured like a live component; its lifecycle hooks never run
+        template<typename T, typename... Args>
+        T* AddComponent(Args&&... args)
+        {
+            return AddComponentToNode<T>(0, std::forward<Args>(args)...);
+        }
+
+        template<typename T, typename... Args>
+        T* AddComponentToNode(int nodeIndex, Args&&... args)
+        {
+            static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
+            static_assert(std::is_copy_constructible<T>::value, "Prefab components are cloned by copy construction");
+
+            auto prototype = std::make_unique<T>(std::forward<Args>(args)...);
+            T* ptr = prototype.get();
+            AddPrototype(nodeIndex, std::move(prototype), ComponentRegistry::Get<T>());
+            return ptr;
+        }
+
+        template<typename T>
+        T* GetComponent(int nodeIndex = 0) const
+        {
+            const Node& node = nodes[nodeIndex];
+            for (int i = node.firstComponent; i < node.firstComponent + node.componentCount; ++i)
+            {
+                if (*components[i].type->cppType == typeid(T))
+                    return static_cast<T*>(components[i].prototype.get());
+            }
+            return nullptr;
+        }
+
+        // The root is placed at the world position, under parent when given
+        GameObject* Instantiate(Scene* scene, const Vector2& position, GameObject* parent = nullptr) const;
+
+        // Clones one node's components onto an existing object, for objects that live outside a scene
+        void AddComponentsTo(GameObject* target, int nodeIndex = 0) const;
+
+    private:
+        void AddPrototype(int nodeIndex, std::unique_ptr<Component> prototype, const ComponentTypeInfo* type);
+        void CaptureNode(const GameObject* source, int parentIndex);
+    };
+}
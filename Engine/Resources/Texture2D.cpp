@@ -1,11 +1,28 @@
 #include "framework.h"
 #include "Texture2D.h"
+#include "../Core/MemoryTracker.h"
 
 namespace AronEngine
 {
+    std::atomic<uint32_t> Texture2D::s_nextId{ 1 };
+
     Texture2D::Texture2D()
-        : size(0, 0)
+        : id(0x80000000u | s_nextId++)
+        , size(0, 0)
+    {
+    }
+
+    Texture2D::~Texture2D()
+    {
+        MemoryTracker::UntrackPayload(MemoryTag::Textures, GetPayloadBytes());
+    }
+
+    int64_t Texture2D::GetPayloadBytes() const
     {
+        if (!bitmap) return 0;
+
+        const D2D1_SIZE_U pixelSize = bitmap->GetPixelSize();
+        return static_cast<int64_t>(pixelSize.width) * pixelSize.height * 4;
     }
 
     bool Texture2D::LoadFromFile(const std::string& filePath, ID2D1DeviceContext6* context, IWICImagingFactory2* wicFactory)
@@ -103,10 +120,15 @@ namespace AronEngine
 
     bool Texture2D::LoadFromWICBitmap(IWICBitmapSource* wicBitmap, ID2D1DeviceContext6* context)
     {
+        MemoryTracker::UntrackPayload(MemoryTag::Textures, GetPayloadBytes());
+        bitmap.Reset();
+
         HRESULT hr = context->CreateBitmapFromWicBitmap(wicBitmap, nullptr, bitmap.GetAddressOf());
         if (FAILED(hr))
             return false;
 
+        MemoryTracker::TrackPayload(MemoryTag::Textures, GetPayloadBytes());
+
         D2D1_SIZE_F d2dSize = bitmap->GetSize();
         size = Vector2(d2dSize.width, d2dSize.height);
 
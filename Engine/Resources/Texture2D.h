@@ -1,28 +1,35 @@
 #pragma once
 #include "../Core/framework.h"
 #include "../Utils/Vector2.h"
+#include <atomic>
 
 namespace AronEngine
 {
     class Texture2D
     {
     private:
+        static std::atomic<uint32_t> s_nextId;
+        uint32_t id;
         ComPtr<ID2D1Bitmap1> bitmap;
         Vector2 size;
         std::string filePath;
 
     public:
         Texture2D();
-        ~Texture2D() = default;
+        ~Texture2D();
 
         bool LoadFromFile(const std::string& filePath, ID2D1DeviceContext6* context, IWICImagingFactory2* wicFactory);
         bool CreateFromMemory(const void* data, size_t dataSize, ID2D1DeviceContext6* context, IWICImagingFactory2* wicFactory);
 
+        // Identifies the texture in captured draw calls; the top bit keeps it apart from Texture::id
+        uint32_t GetId() const { return id; }
         ID2D1Bitmap1* GetBitmap() const { return bitmap.Get(); }
         const Vector2& GetSize() const { return size; }
         float GetWidth() const { return size.x; }
         float GetHeight() const { return size.y; }
         const std::string& GetFilePath() const { return filePath; }
+        // GPU bitmap size at 32bpp
+        int64_t GetPayloadBytes() const;
 
     private:
         bool LoadFromWICBitmap(IWICBitmapSource* wicBitmap, ID2D1DeviceContext6* context);
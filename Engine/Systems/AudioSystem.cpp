@@ -0,0 +1,260 @@
+#include "framework.h"
+#include "AudioSystem.h"
+#include "../Core/Profiler.h"
+#include "../Components/AudioSource.h"
+#include "../Components/AudioListener.h"
+#include "../Components/Transform.h"
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr float kMaxDopplerShift = 2.0f;
+
+        struct SpatialParams
+        {
+            float gain;
+            float pan;
+            float pitch;
+        };
+
+        // One source relative to the listener, blended toward neutral by b. Inlined into the batch
+        // loop so it still vectorizes; also used for a single source when its voice starts
+        inline SpatialParams Spatialize(float dx, float dy, float vx, float vy, float minD, float maxD, float b,
+                                        float rx, float ry, float lvx, float lvy, float c, float doppler)
+        {
+            const float dist = std::sqrt(dx * dx + dy * dy);
+
+            // Inverse-distance rolloff from minDistance, silent past maxDistance
+            const float clamped = (std::min)((std::max)(dist, minD), maxD);
+            const float attenuation = dist > maxD ? 0.0f : minD / clamped;
+
+            // Pan along the listener's right axis; sources inside minDistance fold toward centre
+            const float pan = (dx * rx + dy * ry) / (std::max)(dist, minD);
+
+            // Doppler from radial velocities; u points from listener to source
+            const float invDist = 1.0f / (std::max)(dist, 1e-4f);
+            const float ux = dx * invDist;
+            const float uy = dy * invDist;
+            const float sourceRadial = (vx * ux + vy * uy) * doppler;
+            const float listenerRadial = lvx * ux + lvy * uy;
+            float shift = (c + listenerRadial) / (std::max)(c + sourceRadial, c * 0.1f);
+            shift = (std::min)((std::max)(shift, 1.0f / kMaxDopplerShift), kMaxDopplerShift);
+
+            return { 1.0f + (attenuation - 1.0f) * b,
+                     (std::min)((std::max)(pan, -1.0f), 1.0f) * b,
+                     1.0f + (shift - 1.0f) * b };
+        }
+    }
+
+    AudioSystem::AudioSystem()
+        : listenerPrevious(0.0f, 0.0f)
+        , hasListenerPrevious(false)
+        , speedOfSound(3430.0f)     // 343 m/s at 10 units per metre
+        , dopplerFactor(1.0f)
+    {
+    }
+
+    AudioSystem::~AudioSystem()
+    {
+        for (auto* source : sources)
+        {
+            source->SetRegisteredSystem(nullptr);
+        }
+        for (auto* listener : listeners)
+        {
+            listener->SetRegisteredSystem(nullptr);
+        }
+    }
+
+    void AudioSystem::RegisterSource(AudioSource* source)
+    {
+        if (!source) return;
+
+        sources.push_back(source);
+        previousX.push_back(0.0f);
+        previousY.push_back(0.0f);
+        hasPrevious.push_back(0);
+        source->SetRegisteredSystem(this);
+    }
+
+    void AudioSystem::UnregisterSource(AudioSource* source)
+    {
+        auto it = std::find(sources.begin(), sources.end(), source);
+        if (it == sources.end()) return;
+
+        // Swap-remove, keeping the parallel arrays in step
+        const size_t index = it - sources.begin();
+        const size_t last = sources.size() - 1;
+        sources[index] = sources[last];
+        previousX[index] = previousX[last];
+        previousY[index] = previousY[last];
+        hasPrevious[index] = hasPrevious[last];
+        sources.pop_back();
+        previousX.pop_back();
+        previousY.pop_back();
+        hasPrevious.pop_back();
+
+        source->SetRegisteredSystem(nullptr);
+    }
+
+    void AudioSystem::RegisterListener(AudioListener* listener)
+    {
+        if (!listener) return;
+
+        listeners.push_back(listener);
+        listener->SetRegisteredSystem(this);
+    }
+
+    void AudioSystem::UnregisterListener(AudioListener* listener)
+    {
+        listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+        if (listener)
+        {
+            listener->SetRegisteredSystem(nullptr);
+        }
+    }
+
+    AudioListener* AudioSystem::GetListener() const
+    {
+        for (auto* listener : listeners)
+        {
+            if (listener->IsEnabled() && listener->GetTransform())
+            {
+                return listener;
+            }
+        }
+        return nullptr;
+    }
+
+    void AudioSystem::ComputeSpatial(const AudioSource& source, float& gain, float& pan, float& pitchScale) const
+    {
+        gain = 1.0f;
+        pan = 0.0f;
+        pitchScale = 1.0f;
+
+        Transform* transform = source.GetTransform();
+        if (!transform || source.GetSpatialBlend() <= 0.0f)
+            return;
+
+        Vector2 listenerPos(0.0f, 0.0f);
+        Vector2 listenerRight(1.0f, 0.0f);
+        if (AudioListener* listener = GetListener())
+        {
+            listenerPos = listener->GetTransform()->GetPosition();
+            listenerRight = listener->GetTransform()->GetRight();
+        }
+
+        // No velocity history for a voice that hasn't started; Doppler joins with the next Update
+        const Vector2 relative = transform->GetPosition() - listenerPos;
+        const SpatialParams params = Spatialize(relative.x, relative.y, 0.0f, 0.0f, source.GetMinDistance(),
+            source.GetMaxDistance(), source.GetSpatialBlend(), listenerRight.x, listenerRight.y, 0.0f, 0.0f,
+            speedOfSound, dopplerFactor);
+        gain = params.gain;
+        pan = params.pan;
+        pitchScale = params.pitch;
+    }
+
+    void AudioSystem::ResizeScratch(size_t count)
+    {
+        sourceIndex.resize(count);
+        relX.resize(count);
+        relY.resize(count);
+        velX.resize(count);
+        velY.resize(count);
+        minDistance.resize(count);
+        maxDistance.resize(count);
+        blend.resize(count);
+        outGain.resize(count);
+        outPan.resize(count);
+        outPitch.resize(count);
+    }
+
+    void AudioSystem::Update(float deltaTime)
+    {
+        PROFILE_SCOPE("AudioSystem::Update");
+
+        if (sources.empty()) return;
+
+        const float invDt = deltaTime > 0.0f ? 1.0f / deltaTime : 0.0f;
+
+        // Listener frame; without one, sources are heard from the origin
+        Vector2 listenerPos(0.0f, 0.0f);
+        Vector2 listenerRight(1.0f, 0.0f);
+        Vector2 listenerVel(0.0f, 0.0f);
+        if (AudioListener* listener = GetListener())
+        {
+            Transform* transform = listener->GetTransform();
+            listenerPos = transform->GetPosition();
+            listenerRight = transform->GetRight();
+            if (hasListenerPrevious)
+            {
+                listenerVel = (listenerPos - listenerPrevious) * invDt;
+            }
+        }
+        listenerPrevious = listenerPos;
+        hasListenerPrevious = true;
+
+        // Gather: positions and velocities of audible spatial sources into SoA
+        ResizeScratch(sources.size());
+        size_t count = 0;
+
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            AudioSource* source = sources[i];
+            Transform* transform = source->GetTransform();
+            if (!transform) continue;
+
+            const Vector2 position = transform->GetPosition();
+            const float vx = hasPrevious[i] ? (position.x - previousX[i]) * invDt : 0.0f;
+            const float vy = hasPrevious[i] ? (position.y - previousY[i]) * invDt : 0.0f;
+            previousX[i] = position.x;
+            previousY[i] = position.y;
+            hasPrevious[i] = 1;
+
+            if (source->GetSpatialBlend() <= 0.0f)
+            {
+                // Switched to 2D: drop the last attenuation, pan and Doppler; no-op once neutral
+                source->ApplySpatial(1.0f, 0.0f, 1.0f);
+                continue;
+            }
+            // Silent or disabled sources keep their last values: a voice still sounding doesn't
+            // jump, and Play works out fresh ones (ComputeSpatial) before its first block
+            if (!source->IsEnabled() || !source->HasVoice())
+                continue;
+
+            sourceIndex[count] = static_cast<int>(i);
+            relX[count] = position.x - listenerPos.x;
+            relY[count] = position.y - listenerPos.y;
+            velX[count] = vx;
+            velY[count] = vy;
+            minDistance[count] = source->GetMinDistance();
+            maxDistance[count] = source->GetMaxDistance();
+            blend[count] = source->GetSpatialBlend();
+            ++count;
+        }
+
+        // Spatialize: branch-free so the compiler can vectorize it
+        const float c = speedOfSound;
+        const float doppler = dopplerFactor;
+        const float rx = listenerRight.x;
+        const float ry = listenerRight.y;
+        const float lvx = listenerVel.x * doppler;
+        const float lvy = listenerVel.y * doppler;
+
+        for (size_t k = 0; k < count; ++k)
+        {
+            const SpatialParams params = Spatialize(relX[k], relY[k], velX[k], velY[k], minDistance[k], maxDistance[k],
+                blend[k], rx, ry, lvx, lvy, c, doppler);
+            outGain[k] = params.gain;
+            outPan[k] = params.pan;
+            outPitch[k] = params.pitch;
+        }
+
+        // Feed the mixer; sources only emit a command when something audibly changed
+        for (size_t k = 0; k < count; ++k)
+        {
+            sources[sourceIndex[k]]->ApplySpatial(outGain[k], outPan[k], outPitch[k]);
+        }
+    }
+}
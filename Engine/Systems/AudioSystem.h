@@ -0,0 +1,68 @@
+#pragma once
+#include "../Core/framework.h"
+#include <vector>
+
+namespace AronEngine
+{
+    class AudioSource;
+    class AudioListener;
+
+    // Per-frame spatial pass: distance attenuation, stereo pan and Doppler for every
+    // spatial AudioSource, computed in one structure-of-arrays loop and sent to the mixer.
+    class AudioSystem
+    {
+    private:
+        std::vector<AudioSource*> sources;
+        std::vector<AudioListener*> listeners;
+
+        // Parallel to sources: last world position for velocity estimation
+        std::vector<float> previousX;
+        std::vector<float> previousY;
+        std::vector<uint8_t> hasPrevious;
+
+        // Scratch for the spatial pass, one entry per audible spatial source
+        std::vector<int> sourceIndex;
+        std::vector<float> relX;
+        std::vector<float> relY;
+        std::vector<float> velX;
+        std::vector<float> velY;
+        std::vector<float> minDistance;
+        std::vector<float> maxDistance;
+        std::vector<float> blend;
+        std::vector<float> outGain;
+        std::vector<float> outPan;
+        std::vector<float> outPitch;
+
+        Vector2 listenerPrevious;
+        bool hasListenerPrevious;
+
+        float speedOfSound;     // world units per second
+        float dopplerFactor;
+
+    public:
+        AudioSystem();
+        ~AudioSystem();
+
+        void Update(float deltaTime);
+
+        void RegisterSource(AudioSource* source);
+        void UnregisterSource(AudioSource* source);
+        void RegisterListener(AudioListener* listener);
+        void UnregisterListener(AudioListener* listener);
+
+        AudioListener* GetListener() const;
+        // The gain, pan and pitch scale the spatial pass would give source right now, without
+        // Doppler; lets a voice start at its spatial values instead of ramping in from neutral
+        void ComputeSpatial(const AudioSource& source, float& gain, float& pan, float& pitchScale) const;
+        int GetSourceCount() const { return static_cast<int>(sources.size()); }
+
+        void SetSpeedOfSound(float speed) { speedOfSound = (std::max)(1.0f, speed); }
+        float GetSpeedOfSound() const { return speedOfSound; }
+
+        void SetDopplerFactor(float factor) { dopplerFactor = (std::max)(0.0f, factor); }
+        float GetDopplerFactor() const { return dopplerFactor; }
+
+    private:
+        void ResizeScratch(size_t count);
+    };
+}
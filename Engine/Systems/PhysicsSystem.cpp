@@ -0,0 +1,162 @@
+#include "framework.h"
+#include "PhysicsSystem.h"
+#include "../Core/GameObject.h"
+#include "../Core/Profiler.h"
+#include "../Components/Collider.h"
+#include "../Components/Rigidbody.h"
+#include "../Components/Transform.h"
+
+namespace AronEngine
+{
+    PhysicsSystem::PhysicsSystem()
+        : restitution(0.2f)
+        , broadphasePairCount(0)
+        , contactCount(0)
+    {
+    }
+
+    PhysicsSystem::~PhysicsSystem()
+    {
+        for (auto* collider : colliders)
+        {
+            collider->SetRegisteredSystem(nullptr);
+        }
+    }
+
+    void PhysicsSystem::RegisterCollider(Collider* collider)
+    {
+        if (!collider) return;
+
+        collider->systemSlot = static_cast<int32_t>(colliders.size());
+        colliders.push_back(collider);
+        collider->SetRegisteredSystem(this);
+    }
+
+    void PhysicsSystem::UnregisterCollider(Collider* collider)
+    {
+        if (!collider)
+            return;
+
+        size_t index = static_cast<size_t>(collider->systemSlot);
+        if (index >= colliders.size() || colliders[index] != collider)
+        {
+            index = std::find(colliders.begin(), colliders.end(), collider) - colliders.begin();
+        }
+        if (index < colliders.size())
+        {
+            colliders[index] = colliders.back();
+            colliders[index]->systemSlot = static_cast<int32_t>(index);
+            colliders.pop_back();
+        }
+        collider->systemSlot = -1;
+        collider->SetRegisteredSystem(nullptr);
+    }
+
+    void PhysicsSystem::BuildProxies()
+    {
+        proxies.clear();
+        proxies.reserve(colliders.size());
+
+        for (auto* collider : colliders)
+        {
+            GameObject* gameObject = collider->GetGameObject();
+            if (!collider->IsEnabled() || !gameObject || !gameObject->IsActive()) continue;
+
+            const Vector2 center = collider->GetWorldCenter();
+            Vector2 half;
+            if (collider->GetColliderType() == ColliderType::Circle)
+            {
+                const float radius = static_cast<const CircleCollider*>(collider)->GetWorldRadius();
+                half = Vector2(radius, radius);
+            }
+            else
+            {
+                half = static_cast<const BoxCollider*>(collider)->GetWorldSize() * 0.5f;
+            }
+
+            Proxy proxy;
+            proxy.minX = center.x - half.x;
+            proxy.maxX = center.x + half.x;
+            proxy.minY = center.y - half.y;
+            proxy.maxY = center.y + half.y;
+            proxy.collider = collider;
+            proxy.body = gameObject->GetComponent<Rigidbody>();
+            proxy.inverseMass = 0.0f;
+            if (proxy.body && proxy.body->GetBodyType() == RigidbodyType::Dynamic && !proxy.body->IsKinematic())
+            {
+                proxy.inverseMass = 1.0f / proxy.body->GetMass();
+            }
+            proxies.push_back(proxy);
+        }
+    }
+
+    void PhysicsSystem::Update(float deltaTime)
+    {
+        PROFILE_SCOPE("PhysicsSystem::Update");
+
+        broadphasePairCount = 0;
+        contactCount = 0;
+
+        BuildProxies();
+
+        // Sort-and-sweep along x; only pairs whose x intervals overlap reach the y test
+        std::sort(proxies.begin(), proxies.end(),
+            [](const Proxy& a, const Proxy& b) { return a.minX < b.minX; });
+
+        const size_t count = proxies.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            Proxy& a = proxies[i];
+            for (size_t j = i + 1; j < count && proxies[j].minX <= a.maxX; ++j)
+            {
+                Proxy& b = proxies[j];
+                if (a.maxY < b.minY || b.maxY < a.minY) continue;
+                if (a.inverseMass == 0.0f && b.inverseMass == 0.0f) continue;
+
+                ++broadphasePairCount;
+
+                const CollisionInfo info = a.collider->CheckCollision(b.collider);
+                if (!info.isColliding) continue;
+
+                ++contactCount;
+                if (a.collider->IsTrigger() || b.collider->IsTrigger()) continue;
+
+                ResolveContact(a, b, info.normal, info.penetrationDepth);
+            }
+        }
+    }
+
+    void PhysicsSystem::ResolveContact(Proxy& a, Proxy& b, const Vector2& normal, float depth)
+    {
+        const float totalInverseMass = a.inverseMass + b.inverseMass;
+
+        // Push apart along the normal (a -> b), split by inverse mass
+        const Vector2 correction = normal * (depth / totalInverseMass);
+        if (a.inverseMass > 0.0f)
+        {
+            Transform* transform = a.collider->GetTransform();
+            transform->SetPosition(transform->GetPosition() - correction * a.inverseMass);
+        }
+        if (b.inverseMass > 0.0f)
+        {
+            Transform* transform = b.collider->GetTransform();
+            transform->SetPosition(transform->GetPosition() + correction * b.inverseMass);
+        }
+
+        // Restitution impulse only when the bodies are approaching
+        const Vector2 velocityA = a.inverseMass > 0.0f ? a.body->GetVelocity() : Vector2::Zero;
+        const Vector2 velocityB = b.inverseMass > 0.0f ? b.body->GetVelocity() : Vector2::Zero;
+        const float approach = (velocityB - velocityA).Dot(normal);
+        if (approach >= 0.0f) return;
+
+        const float impulse = -(1.0f + restitution) * approach / totalInverseMass;
+        if (a.inverseMass > 0.0f)
+        {
+            a.body->SetVelocity(velocityA - normal * (impulse * a.inverseMass));
+        }
+        if (b.inverseMass > 0.0f)
+        {
+            b.body->SetVelocity(velocityB + normal * (impulse * b.inverseMass));
+        }
+    }
+}
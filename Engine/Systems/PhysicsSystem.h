@@ -0,0 +1,56 @@
+#pragma once
+#include "../Core/framework.h"
+#include <vector>
+
+namespace AronEngine
+{
+    class Collider;
+    class Rigidbody;
+
+    // Collision pass over every enabled Collider: sort-and-sweep broadphase on world AABBs,
+    // the colliders' own narrowphase tests, then positional correction and a restitution
+    // impulse for pairs involving a dynamic Rigidbody. Integration stays in Rigidbody::OnUpdate.
+    class PhysicsSystem
+    {
+    private:
+        struct Proxy
+        {
+            float minX;
+            float maxX;
+            float minY;
+            float maxY;
+            Collider* collider;
+            Rigidbody* body;        // nullptr or non-dynamic: treated as static
+            float inverseMass;
+        };
+
+        std::vector<Collider*> colliders;
+        std::vector<Proxy> proxies;
+
+        float restitution;
+
+        int broadphasePairCount;
+        int contactCount;
+
+    public:
+        PhysicsSystem();
+        ~PhysicsSystem();
+
+        void Update(float deltaTime);
+
+        void RegisterCollider(Collider* collider);
+        void UnregisterCollider(Collider* collider);
+
+        void SetRestitution(float value) { restitution = (std::min)((std::max)(value, 0.0f), 1.0f); }
+        float GetRestitution() const { return restitution; }
+
+        int GetColliderCount() const { return static_cast<int>(colliders.size()); }
+        // Counters from the last Update()
+        int GetBroadphasePairCount() const { return broadphasePairCount; }
+        int GetContactCount() const { return contactCount; }
+
+    private:
+        void BuildProxies();
+        void ResolveContact(Proxy& a, Proxy& b, const Vector2& normal, float depth);
+    };
+}
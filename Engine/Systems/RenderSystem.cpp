@@ -1,81 +1,396 @@
 #include "framework.h"
 #include "RenderSystem.h"
 #include "../Core/Renderer.h"
+#include "../Core/Profiler.h"
+#include "../Core/EngineStats.h"
+#include "../Core/MemoryTracker.h"
 #include "../Components/SpriteRenderer.h"
+#include "../Components/Camera.h"
 #include "../Core/GameObject.h"
 #include "../Components/Transform.h"
+#include "../Components/ComponentRegistry.h"
 #include <algorithm>
 
 namespace AronEngine
 {
+    namespace
+    {
+        // New sprites at least this many, and more than already indexed, are bulk-loaded
+        constexpr int32_t kBulkLoadMinimum = 1024;
+        // Rebuild once this many sprites, and an eighth of the index, sit outside the root
+        constexpr int32_t kRebuildOutsideMinimum = 256;
+
+        bool IsDrawable(const SpriteRenderer* spriteRenderer)
+        {
+            if (!spriteRenderer->IsActive())
+                return false;
+
+            GameObject* gameObject = spriteRenderer->GetGameObject();
+            if (!gameObject || !gameObject->IsActive())
+                return false;
+
+            const std::shared_ptr<Sprite>& sprite = spriteRenderer->GetSprite();
+            return sprite && sprite->texture;
+        }
+    }
+
+    RenderSystem::RenderSystem()
+        : drawnSpriteCount(0)
+        , culledSpriteCount(0)
+        , drawableSpriteCount(0)
+        , nextDrawSequence(0)
+    {
+    }
+
+    RenderSystem::~RenderSystem()
+    {
+        for (auto* spriteRenderer : spriteRenderers)
+        {
+            if (Transform* transform = spriteRenderer->GetTransform())
+            {
+                transform->spatialIndex = nullptr;
+                transform->indexedSprites = 0;
+                transform->movedSlot = -1;
+            }
+            spriteRenderer->SetRegisteredSystem(nullptr);
+        }
+        for (auto* camera : cameras)
+        {
+            camera->SetRegisteredSystem(nullptr);
+        }
+    }
+
     void RenderSystem::Update(float deltaTime)
     {
-        SortRenderables();
+        PROFILE_SCOPE("RenderSystem::Update");
+
+        // Sprites are sorted per view in Render, after culling
+        SortCameras();
     }
 
     void RenderSystem::Render(Renderer* renderer)
     {
+        PROFILE_SCOPE("RenderSystem::Render");
+        MEMORY_TAG(Rendering);
+
         if (!renderer)
             return;
-            
-        RenderSprites(renderer);
+
+        drawnSpriteCount = 0;
+        culledSpriteCount = 0;
+        UpdateSpatialIndex();
+
+        const float width = static_cast<float>(renderer->GetWidth());
+        const float height = static_cast<float>(renderer->GetHeight());
+
+        bool anyCamera = false;
+        for (Camera* camera : cameras)
+        {
+            if (!camera->IsActive() || !camera->GetGameObject() || !camera->GetGameObject()->IsActive())
+                continue;
+
+            anyCamera = true;
+            renderer->PushClip(camera->GetPixelRect(width, height));
+            RenderView(renderer, camera->GetViewMatrix(width, height), camera->GetWorldBounds(width, height));
+            renderer->PopClip();
+        }
+
+        // Without a camera world units are target pixels, as before cameras existed
+        if (!anyCamera)
+        {
+            RenderView(renderer, Matrix3x2::Identity(), D2D1::RectF(0.0f, 0.0f, width, height));
+        }
+
+        renderer->SetTransform(D2D1::Matrix3x2F::Identity());
+
+        EngineStats::Add(StatCounter::SpritesSubmitted, drawnSpriteCount);
+        EngineStats::Add(StatCounter::SpritesCulled, culledSpriteCount);
     }
     
     void RenderSystem::RegisterSpriteRenderer(SpriteRenderer* spriteRenderer)
     {
         if (spriteRenderer)
         {
+            spriteRenderer->systemSlot = static_cast<int32_t>(spriteRenderers.size());
             spriteRenderers.push_back(spriteRenderer);
+            spriteRenderer->SetRegisteredSystem(this);
+
+            // Goes into the index with the next update, together with the rest of its batch
+            spriteRenderer->spatialHandle = -1;
+            spriteRenderer->staleSlot = -1;
+            spriteRenderer->countedDrawable = false;
+            spriteRenderer->drawSequence = nextDrawSequence++;
+            QueueBoundsUpdate(spriteRenderer);
+
+            if (Transform* transform = spriteRenderer->GetTransform())
+            {
+                transform->spatialIndex = this;
+                ++transform->indexedSprites;
+            }
         }
     }
     
     void RenderSystem::UnregisterSpriteRenderer(SpriteRenderer* spriteRenderer)
     {
-        auto it = std::find(spriteRenderers.begin(), spriteRenderers.end(), spriteRenderer);
-        if (it != spriteRenderers.end())
+        if (!spriteRenderer)
+            return;
+
+        // Swap-remove through the stored slot; draw order comes from the per-view sort, so
+        // the list order doesn't matter and tearing down a large scene stays linear
+        size_t index = static_cast<size_t>(spriteRenderer->systemSlot);
+        if (index >= spriteRenderers.size() || spriteRenderers[index] != spriteRenderer)
+        {
+            index = std::find(spriteRenderers.begin(), spriteRenderers.end(), spriteRenderer) - spriteRenderers.begin();
+        }
+        if (index < spriteRenderers.size())
+        {
+            spriteRenderers[index] = spriteRenderers.back();
+            spriteRenderers[index]->systemSlot = static_cast<int32_t>(index);
+            spriteRenderers.pop_back();
+        }
+        spriteRenderer->systemSlot = -1;
+        spriteRenderer->SetRegisteredSystem(nullptr);
+        if (spriteRenderer->countedDrawable)
+        {
+            spriteRenderer->countedDrawable = false;
+            --drawableSpriteCount;
+        }
+
+        spatialIndex.Remove(spriteRenderer->spatialHandle);
+        spriteRenderer->spatialHandle = -1;
+        if (spriteRenderer->staleSlot >= 0)
         {
-            spriteRenderers.erase(it);
+            staleSprites[spriteRenderer->staleSlot] = nullptr;
+            spriteRenderer->staleSlot = -1;
+        }
+
+        Transform* transform = spriteRenderer->GetTransform();
+        if (transform && transform->indexedSprites > 0 && --transform->indexedSprites == 0)
+        {
+            if (transform->movedSlot >= 0)
+            {
+                movedTransforms[transform->movedSlot] = nullptr;
+                transform->movedSlot = -1;
+            }
+            transform->spatialIndex = nullptr;
         }
     }
-    
-    void RenderSystem::RenderSprites(Renderer* renderer)
+
+    void RenderSystem::RegisterCamera(Camera* camera)
     {
-        for (SpriteRenderer* spriteRenderer : spriteRenderers)
+        if (camera && std::find(cameras.begin(), cameras.end(), camera) == cameras.end())
         {
-            if (!spriteRenderer || !spriteRenderer->IsActive())
-                continue;
-                
-            GameObject* gameObject = spriteRenderer->GetGameObject();
-            if (!gameObject || !gameObject->IsActive())
+            cameras.push_back(camera);
+            camera->SetRegisteredSystem(this);
+            SortCameras();
+        }
+    }
+
+    void RenderSystem::UnregisterCamera(Camera* camera)
+    {
+        auto it = std::find(cameras.begin(), cameras.end(), camera);
+        if (it != cameras.end())
+        {
+            cameras.erase(it);
+        }
+        if (camera)
+        {
+            camera->SetRegisteredSystem(nullptr);
+        }
+    }
+
+    Camera* RenderSystem::GetMainCamera() const
+    {
+        for (Camera* camera : cameras)
+        {
+            if (camera->IsActive() && camera->GetGameObject() && camera->GetGameObject()->IsActive())
+            {
+                return camera;
+            }
+        }
+        return nullptr;
+    }
+
+    int RenderSystem::CollectVisibleSprites(const D2D1_RECT_F& worldBounds, std::vector<SpriteRenderer*>& out)
+    {
+        QuerySprites(worldBounds, out);
+
+        out.erase(std::remove_if(out.begin(), out.end(),
+            [](const SpriteRenderer* spriteRenderer) { return !IsDrawable(spriteRenderer); }), out.end());
+        std::sort(out.begin(), out.end(), DrawsBefore);
+
+        // Only drawable sprites the view test rejected; the query brought the count up to date
+        return drawableSpriteCount - static_cast<int>(out.size());
+    }
+
+    void RenderSystem::QuerySprites(const D2D1_RECT_F& worldRect, std::vector<SpriteRenderer*>& out)
+    {
+        UpdateSpatialIndex();
+
+        out.clear();
+        spatialIndex.Query(worldRect, [&out](SpriteRenderer* spriteRenderer) { out.push_back(spriteRenderer); });
+    }
+
+    SpriteRenderer* RenderSystem::PickSprite(const Vector2& worldPoint)
+    {
+        UpdateSpatialIndex();
+
+        SpriteRenderer* topmost = nullptr;
+        spatialIndex.QueryPoint(worldPoint, [&](SpriteRenderer* spriteRenderer)
+        {
+            if (!IsDrawable(spriteRenderer) || (topmost && DrawsBefore(spriteRenderer, topmost)))
+                return;
+
+            // The box is axis-aligned; test the rotated quad itself
+            const Vector2 local = spriteRenderer->GetWorldMatrix().Inverse().TransformPoint(worldPoint);
+            const D2D1_RECT_F rect = spriteRenderer->GetLocalRect();
+            if (local.x >= rect.left && local.x <= rect.right && local.y >= rect.top && local.y <= rect.bottom)
+            {
+                topmost = spriteRenderer;
+            }
+        });
+        return topmost;
+    }
+
+    SpriteRenderer* RenderSystem::PickSpriteOnScreen(const Vector2& targetPoint, float targetWidth, float targetHeight)
+    {
+        // Later cameras draw over earlier ones
+        bool anyCamera = false;
+        for (auto it = cameras.rbegin(); it != cameras.rend(); ++it)
+        {
+            Camera* camera = *it;
+            if (!camera->IsActive() || !camera->GetGameObject() || !camera->GetGameObject()->IsActive())
                 continue;
-                
-            std::shared_ptr<Sprite> sprite = spriteRenderer->GetSprite();
-            if (!sprite || !sprite->texture)
+
+            anyCamera = true;
+            const D2D1_RECT_F pixels = camera->GetPixelRect(targetWidth, targetHeight);
+            if (targetPoint.x < pixels.left || targetPoint.x >= pixels.right || targetPoint.y < pixels.top || targetPoint.y >= pixels.bottom)
                 continue;
-            
-            D2D1_RECT_F renderRect = spriteRenderer->GetRenderRect();
-            D2D1_MATRIX_3X2_F transformMatrix = spriteRenderer->GetTransformMatrix();
-            
-            renderer->SetTransform(transformMatrix);
-            // 새로운 텍스처 시스템 사용
-            if (sprite->texture) {
-                Vector2 pos(renderRect.left, renderRect.top);
-                Vector2 size(renderRect.right - renderRect.left, renderRect.bottom - renderRect.top);
-                renderer->DrawTexture(sprite->texture, pos, size, spriteRenderer->GetColor());
+
+            if (SpriteRenderer* picked = PickSprite(camera->ScreenToWorld(targetPoint, targetWidth, targetHeight)))
+            {
+                return picked;
             }
-            renderer->SetTransform(D2D1::Matrix3x2F::Identity());
         }
+        return anyCamera ? nullptr : PickSprite(targetPoint);
     }
-    
-    void RenderSystem::SortRenderables()
+
+    void RenderSystem::UpdateSpatialIndex()
     {
-        std::sort(spriteRenderers.begin(), spriteRenderers.end(),
-            [](const SpriteRenderer* a, const SpriteRenderer* b) {
-                if (a->GetSortingLayer() != b->GetSortingLayer())
+        if (movedTransforms.empty() && staleSprites.empty())
+            return;
+
+        PROFILE_SCOPE("RenderSystem::UpdateSpatialIndex");
+
+        const ComponentTypeInfo* spriteType = ComponentRegistry::Get<SpriteRenderer>();
+        for (Transform* transform : movedTransforms)
+        {
+            if (!transform)
+                continue;
+
+            transform->movedSlot = -1;
+            for (const auto& component : transform->GetGameObject()->GetAllComponents())
+            {
+                if (component->GetTypeInfo() != spriteType)
+                    continue;
+
+                auto* spriteRenderer = static_cast<SpriteRenderer*>(component.get());
+                if (spriteRenderer->registeredSystem == this && spriteRenderer->staleSlot < 0)
                 {
-                    return a->GetSortingLayer() < b->GetSortingLayer();
+                    QueueBoundsUpdate(spriteRenderer);
                 }
-                return a->GetSortingOrder() < b->GetSortingOrder();
-            });
+            }
+        }
+        movedTransforms.clear();
+
+        int32_t inserts = 0;
+        for (SpriteRenderer* spriteRenderer : staleSprites)
+        {
+            if (spriteRenderer && spriteRenderer->spatialHandle < 0) ++inserts;
+        }
+        // A scene load: drop everything in as-is and place it all with one rebuild
+        const bool bulkLoad = inserts >= kBulkLoadMinimum && inserts > spatialIndex.GetCount();
+
+        for (SpriteRenderer* spriteRenderer : staleSprites)
+        {
+            if (!spriteRenderer)
+                continue;
+
+            spriteRenderer->staleSlot = -1;
+
+            // Everything that can change drawability requeues the sprite, so the count stays exact
+            const bool drawable = IsDrawable(spriteRenderer);
+            if (drawable != spriteRenderer->countedDrawable)
+            {
+                spriteRenderer->countedDrawable = drawable;
+                drawableSpriteCount += drawable ? 1 : -1;
+            }
+
+            const D2D1_RECT_F bounds = spriteRenderer->GetWorldBounds();
+            if (spriteRenderer->spatialHandle < 0)
+            {
+                spriteRenderer->spatialHandle = spatialIndex.Insert(bounds, spriteRenderer);
+            }
+            else
+            {
+                spatialIndex.Update(spriteRenderer->spatialHandle, bounds);
+            }
+        }
+        staleSprites.clear();
+
+        const int32_t outside = spatialIndex.GetOutsideCount();
+        if (bulkLoad || (outside >= kRebuildOutsideMinimum && outside * 8 > spatialIndex.GetCount()))
+        {
+            spatialIndex.Rebuild();
+        }
+    }
+
+    void RenderSystem::OnTransformMoved(Transform* transform)
+    {
+        transform->movedSlot = static_cast<int32_t>(movedTransforms.size());
+        movedTransforms.push_back(transform);
+    }
+
+    void RenderSystem::QueueBoundsUpdate(SpriteRenderer* spriteRenderer)
+    {
+        spriteRenderer->staleSlot = static_cast<int32_t>(staleSprites.size());
+        staleSprites.push_back(spriteRenderer);
+    }
+    
+    void RenderSystem::RenderView(Renderer* renderer, const Matrix3x2& view, const D2D1_RECT_F& worldBounds)
+    {
+        culledSpriteCount += CollectVisibleSprites(worldBounds, visibleSprites);
+
+        for (SpriteRenderer* spriteRenderer : visibleSprites)
+        {
+            const D2D1_RECT_F localRect = spriteRenderer->GetLocalRect();
+
+            renderer->SetTransform(spriteRenderer->GetWorldMatrix() * view);
+            renderer->DrawTexture(spriteRenderer->GetSprite()->texture,
+                Vector2(localRect.left, localRect.top),
+                Vector2(localRect.right - localRect.left, localRect.bottom - localRect.top),
+                spriteRenderer->GetColor());
+            ++drawnSpriteCount;
+        }
+    }
+
+    bool RenderSystem::DrawsBefore(const SpriteRenderer* a, const SpriteRenderer* b)
+    {
+        const int layer = a->GetSortingLayer().compare(b->GetSortingLayer());
+        if (layer != 0)
+        {
+            return layer < 0;
+        }
+        if (a->GetSortingOrder() != b->GetSortingOrder())
+        {
+            return a->GetSortingOrder() < b->GetSortingOrder();
+        }
+        return a->drawSequence < b->drawSequence;
+    }
+
+    void RenderSystem::SortCameras()
+    {
+        std::stable_sort(cameras.begin(), cameras.end(),
+            [](const Camera* a, const Camera* b) { return a->GetDepth() < b->GetDepth(); });
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include "../Core/framework.h"
+#include "../Utils/Matrix3x2.h"
+#include "../Utils/LooseQuadtree.h"
 #include <vector>
 #include <memory>
 
@@ -7,25 +9,81 @@ namespace AronEngine
 {
     class Renderer;
     class SpriteRenderer;
+    class Camera;
+    class Transform;
     class GameObject;
 
+    // Draws the registered sprites once per enabled camera, in camera depth order. Each view
+    // asks a loose quadtree of sprite world bounds for what overlaps it, then sorts only that
+    // by sorting layer and order, so culling, sorting and submission scale with what is on
+    // screen. The same index answers rectangle and point queries, e.g. for editor picking.
+    //
+    // The index is kept up to date incrementally: registering a sprite, changing its size,
+    // offset or sprite, and moving its transform (or any ancestor) queue it, and the queue is
+    // applied before the next query. A large batch of new sprites, such as a scene load, is
+    // bulk-loaded with one rebuild instead of growing the tree one insert at a time.
     class RenderSystem
     {
     private:
         std::vector<SpriteRenderer*> spriteRenderers;
+        std::vector<Camera*> cameras;               // by depth after Update
+        std::vector<SpriteRenderer*> visibleSprites;    // the current view's, reused
+        int drawnSpriteCount;
+        int culledSpriteCount;
+        int drawableSpriteCount;                    // registered and drawable, kept as sprites change
+
+        LooseQuadtree<SpriteRenderer*> spatialIndex;
+        // Waiting for the index; entries of sprites and transforms dropped meanwhile are null.
+        // Transforms are only written by one system at a time, so the moved list needs no lock.
+        std::vector<SpriteRenderer*> staleSprites;
+        std::vector<Transform*> movedTransforms;
+        uint32_t nextDrawSequence;                  // ties in sorting order keep registration order
 
     public:
-        RenderSystem() = default;
-        ~RenderSystem() = default;
+        RenderSystem();
+        ~RenderSystem();
 
         void Update(float deltaTime);
         void Render(Renderer* renderer);
         
         void RegisterSpriteRenderer(SpriteRenderer* spriteRenderer);
         void UnregisterSpriteRenderer(SpriteRenderer* spriteRenderer);
+        void RegisterCamera(Camera* camera);
+        void UnregisterCamera(Camera* camera);
+
+        int GetSpriteRendererCount() const { return static_cast<int>(spriteRenderers.size()); }
+        const std::vector<Camera*>& GetCameras() const { return cameras; }
+        // The lowest-depth enabled camera, or null
+        Camera* GetMainCamera() const;
+
+        // Sprites submitted by the last Render(), over all cameras
+        int GetDrawnSpriteCount() const { return drawnSpriteCount; }
+        // Drawable sprites the last Render() found outside the view, over all cameras
+        int GetCulledSpriteCount() const { return culledSpriteCount; }
+
+        // Fills out with the drawable sprites overlapping worldBounds, in draw order; what
+        // Render does per camera. Returns how many drawable sprites were culled.
+        int CollectVisibleSprites(const D2D1_RECT_F& worldBounds, std::vector<SpriteRenderer*>& out);
+
+        // Every registered sprite whose world bounds overlap worldRect, in no particular order
+        void QuerySprites(const D2D1_RECT_F& worldRect, std::vector<SpriteRenderer*>& out);
+        // The topmost drawable sprite whose drawn quad contains worldPoint, or null
+        SpriteRenderer* PickSprite(const Vector2& worldPoint);
+        // PickSprite through whichever camera draws topmost at a render target pixel
+        SpriteRenderer* PickSpriteOnScreen(const Vector2& targetPoint, float targetWidth, float targetHeight);
+
+        // Applies queued bounds changes; Render and the queries call it first
+        void UpdateSpatialIndex();
+        int GetSpatialNodeCount() const { return spatialIndex.GetNodeCount(); }
         
     private:
-        void RenderSprites(Renderer* renderer);
-        void SortRenderables();
+        friend class Transform;
+        friend class SpriteRenderer;
+        void OnTransformMoved(Transform* transform);
+        void QueueBoundsUpdate(SpriteRenderer* spriteRenderer);
+        void RenderView(Renderer* renderer, const Matrix3x2& view, const D2D1_RECT_F& worldBounds);
+        void SortCameras();
+        // Sorting layer, then sorting order, then registration
+        static bool DrawsBefore(const SpriteRenderer* a, const SpriteRenderer* b);
     };
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "framework.h"
+#include "BinaryReader.h"
+
+namespace AronEngine
+{
+    BinaryReader::BinaryReader(const void* data, size_t size, const std::string_view* strings, size_t stringCount)
+        : data(static_cast<const char*>(data))
+        , size(size)
+        , position(0)
+        , strings(strings)
+        , stringCount(stringCount)
+        , failed(false)
+    {
+    }
+
+    bool BinaryReader::Read(bool& value)
+    {
+        uint8_t byte = 0;
+        if (!ReadBytes(&byte, sizeof(byte))) return false;
+        if (byte > 1) return Fail();
+        value = byte != 0;
+        return true;
+    }
+
+    bool BinaryReader::Read(int& value)
+    {
+        int32_t fixed = 0;
+        if (!ReadBytes(&fixed, sizeof(fixed))) return false;
+        value = static_cast<int>(fixed);
+        return true;
+    }
+
+    bool BinaryReader::Read(Vector2& value)
+    {
+        float values[2];
+        if (!ReadBytes(values, sizeof(values))) return false;
+        value = Vector2(values[0], values[1]);
+        return true;
+    }
+
+    bool BinaryReader::Read(Color& value)
+    {
+        float values[4];
+        if (!ReadBytes(values, sizeof(values))) return false;
+        value = Color(values[0], values[1], values[2], values[3]);
+        return true;
+    }
+
+    bool BinaryReader::ReadString(std::string_view& value)
+    {
+        uint32_t index = 0;
+        if (!Read(index)) return false;
+        if (index >= stringCount) return Fail();
+        value = strings[index];
+        return true;
+    }
+
+    bool BinaryReader::ReadString(std::string& value)
+    {
+        std::string_view view;
+        if (!ReadString(view)) return false;
+        value.assign(view.data(), view.size());
+        return true;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Vector2.h"
+#include "Color.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace AronEngine
+{
+    // Reads BinaryWriter output in place, typically straight out of a MappedFile. Every read
+    // is bounds-checked; the first overrun or bad string index sticks and later reads fail.
+    class BinaryReader
+    {
+    private:
+        const char* data;
+        size_t size;
+        size_t position;
+        const std::string_view* strings;
+        size_t stringCount;
+        bool failed;
+
+    public:
+        BinaryReader(const void* data, size_t size, const std::string_view* strings, size_t stringCount);
+
+        bool Read(bool& value);
+        bool Read(int& value);
+        bool Read(uint32_t& value) { return ReadBytes(&value, sizeof(value)); }
+        bool Read(float& value) { return ReadBytes(&value, sizeof(value)); }
+        bool Read(Vector2& value);
+        bool Read(Color& value);
+        // View into the string table; valid as long as the underlying data
+        bool ReadString(std::string_view& value);
+        bool ReadString(std::string& value);
+
+        bool ReadBytes(void* out, size_t count)
+        {
+            if (failed || count > size - position) return Fail();
+            std::memcpy(out, data + position, count);
+            position += count;
+            return true;
+        }
+
+        size_t GetPosition() const { return position; }
+        size_t GetRemaining() const { return size - position; }
+        bool HasError() const { return failed; }
+        bool Fail() { failed = true; return false; }
+    };
+}
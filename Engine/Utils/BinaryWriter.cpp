@@ -0,0 +1,66 @@
+#include "framework.h"
+#include "BinaryWriter.h"
+#include <cstring>
+
+namespace AronEngine
+{
+    uint32_t BinaryStringTable::Add(std::string_view value)
+    {
+        auto result = indices.emplace(std::string(value), static_cast<uint32_t>(strings.size()));
+        if (result.second)
+        {
+            strings.push_back(&result.first->first);
+        }
+        return result.first->second;
+    }
+
+    BinaryWriter::BinaryWriter(BinaryStringTable& strings)
+        : strings(strings)
+    {
+    }
+
+    void BinaryWriter::Write(bool value)
+    {
+        buffer.push_back(value ? 1 : 0);
+    }
+
+    void BinaryWriter::Write(int value)
+    {
+        const int32_t fixed = static_cast<int32_t>(value);
+        WriteBytes(&fixed, sizeof(fixed));
+    }
+
+    void BinaryWriter::Write(uint32_t value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void BinaryWriter::Write(float value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void BinaryWriter::Write(const Vector2& value)
+    {
+        const float values[] = { value.x, value.y };
+        WriteBytes(values, sizeof(values));
+    }
+
+    void BinaryWriter::Write(const Color& value)
+    {
+        const float values[] = { value.r, value.g, value.b, value.a };
+        WriteBytes(values, sizeof(values));
+    }
+
+    void BinaryWriter::WriteString(std::string_view value)
+    {
+        Write(strings.Add(value));
+    }
+
+    void BinaryWriter::WriteBytes(const void* data, size_t size)
+    {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+}
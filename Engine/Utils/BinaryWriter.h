@@ -0,0 +1,54 @@
+#pragma once
+#include "Vector2.h"
+#include "Color.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace AronEngine
+{
+    // Each distinct string is stored once per file; records refer to it by index
+    class BinaryStringTable
+    {
+    private:
+        std::unordered_map<std::string, uint32_t> indices;
+        std::vector<const std::string*> strings;    // keys of indices, in index order
+
+    public:
+        uint32_t Add(std::string_view value);
+
+        size_t GetCount() const { return strings.size(); }
+        const std::string& Get(uint32_t index) const { return *strings[index]; }
+    };
+
+    // Little-endian fixed-size fields appended to one growable buffer. Strings go through
+    // the shared table and take four bytes.
+    class BinaryWriter
+    {
+    private:
+        std::vector<char> buffer;
+        BinaryStringTable& strings;
+
+    public:
+        explicit BinaryWriter(BinaryStringTable& strings);
+
+        BinaryWriter(const BinaryWriter&) = delete;
+        BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+        void Write(bool value);
+        void Write(int value);
+        void Write(uint32_t value);
+        void Write(float value);
+        void Write(const Vector2& value);
+        void Write(const Color& value);
+        void WriteString(std::string_view value);
+        void WriteBytes(const void* data, size_t size);
+
+        const std::vector<char>& GetBuffer() const { return buffer; }
+        size_t GetSize() const { return buffer.size(); }
+        void Reserve(size_t size) { buffer.reserve(size); }
+        void Clear() { buffer.clear(); }
+    };
+}
@@ -0,0 +1,413 @@
+#include "framework.h"
+#include "JsonReader.h"
+#include <charconv>
+#include <cmath>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr int kMaxDepth = 256;
+
+        bool IsNumberChar(int c)
+        {
+            return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+        }
+
+        void AppendUtf8(std::string& out, unsigned codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                out += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                out += static_cast<char>(0xC0 | (codePoint >> 6));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                out += static_cast<char>(0xE0 | (codePoint >> 12));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                out += static_cast<char>(0xF0 | (codePoint >> 18));
+                out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+    }
+
+    JsonReader::JsonReader(std::istream& input)
+        : input(input)
+        , chunk(kChunkSize)
+        , position(0)
+        , length(0)
+        , endOfInput(false)
+        , containerStart(false)
+        , line(1)
+    {
+        scratch.reserve(256);
+    }
+
+    bool JsonReader::BeginObject()
+    {
+        if (!Expect('{', "expected '{'")) return false;
+        containerStart = true;
+        return true;
+    }
+
+    bool JsonReader::NextKey(std::string_view& key)
+    {
+        if (HasError()) return false;
+
+        SkipWhitespace();
+        int c = Peek();
+        if (c == '}')
+        {
+            ++position;
+            containerStart = false;
+            return false;
+        }
+
+        if (!containerStart)
+        {
+            if (c != ',') return Fail("expected ',' or '}'");
+            ++position;
+            SkipWhitespace();
+            c = Peek();
+        }
+        containerStart = false;
+
+        if (c != '"') return Fail("expected a key");
+        ++position;
+        if (!ParseString(scratch)) return false;
+        if (!Expect(':', "expected ':' after key")) return false;
+
+        key = scratch;
+        return true;
+    }
+
+    bool JsonReader::BeginArray()
+    {
+        if (!Expect('[', "expected '['")) return false;
+        containerStart = true;
+        return true;
+    }
+
+    bool JsonReader::NextElement()
+    {
+        if (HasError()) return false;
+
+        SkipWhitespace();
+        const int c = Peek();
+        if (c == ']')
+        {
+            ++position;
+            containerStart = false;
+            return false;
+        }
+
+        if (!containerStart)
+        {
+            if (c != ',') return Fail("expected ',' or ']'");
+            ++position;
+        }
+        containerStart = false;
+        return true;
+    }
+
+    bool JsonReader::Read(bool& value)
+    {
+        if (HasError()) return false;
+
+        SkipWhitespace();
+        const int c = Peek();
+        if (c == 't' && ReadLiteral("true")) { value = true; return true; }
+        if (c == 'f' && ReadLiteral("false")) { value = false; return true; }
+        return Fail("expected true or false");
+    }
+
+    bool JsonReader::Read(int& value)
+    {
+        char text[64];
+        size_t count = 0;
+        if (!ReadNumberText(text, sizeof(text), count)) return false;
+
+        // Accept 3.0 as well as 3, but nothing fractional or out of range
+        double number = 0.0;
+        const auto result = std::from_chars(text, text + count, number);
+        if (result.ec != std::errc() || result.ptr != text + count) return Fail("malformed number");
+        if (number != std::floor(number) || number < -2147483648.0 || number > 2147483647.0) return Fail("expected an integer");
+
+        value = static_cast<int>(number);
+        return true;
+    }
+
+    bool JsonReader::Read(float& value)
+    {
+        char text[64];
+        size_t count = 0;
+        if (!ReadNumberText(text, sizeof(text), count)) return false;
+
+        const auto result = std::from_chars(text, text + count, value);
+        if (result.ec != std::errc() || result.ptr != text + count) return Fail("malformed number");
+        return true;
+    }
+
+    bool JsonReader::Read(std::string& value)
+    {
+        if (!Expect('"', "expected a string")) return false;
+        return ParseString(value);
+    }
+
+    bool JsonReader::Read(Vector2& value)
+    {
+        if (!BeginArray()) return false;
+        if (!NextElement() || !Read(value.x)) return HasError() ? false : Fail("expected [x, y]");
+        if (!NextElement() || !Read(value.y)) return HasError() ? false : Fail("expected [x, y]");
+        if (NextElement()) return Fail("expected [x, y]");
+        return !HasError();
+    }
+
+    bool JsonReader::Read(Color& value)
+    {
+        if (!BeginArray()) return false;
+
+        float* channels[] = { &value.r, &value.g, &value.b, &value.a };
+        int count = 0;
+        while (NextElement())
+        {
+            if (count == 4) return Fail("expected [r, g, b] or [r, g, b, a]");
+            if (!Read(*channels[count++])) return false;
+        }
+        if (HasError()) return false;
+        if (count < 3) return Fail("expected [r, g, b] or [r, g, b, a]");
+        if (count == 3) value.a = 1.0f;
+        return true;
+    }
+
+    bool JsonReader::ReadString(std::string_view& value)
+    {
+        if (!Read(scratch)) return false;
+        value = scratch;
+        return true;
+    }
+
+    bool JsonReader::SkipValue()
+    {
+        return SkipValue(0);
+    }
+
+    bool JsonReader::SkipValue(int depth)
+    {
+        if (HasError()) return false;
+        if (depth > kMaxDepth) return Fail("nesting too deep");
+
+        SkipWhitespace();
+        const int c = Peek();
+        switch (c)
+        {
+        case '{':
+        {
+            BeginObject();
+            std::string_view key;
+            while (NextKey(key))
+            {
+                if (!SkipValue(depth + 1)) return false;
+            }
+            return !HasError();
+        }
+        case '[':
+            BeginArray();
+            while (NextElement())
+            {
+                if (!SkipValue(depth + 1)) return false;
+            }
+            return !HasError();
+        case '"':
+            ++position;
+            return ParseString(scratch);
+        case 't':
+            return ReadLiteral("true") || Fail("unexpected token");
+        case 'f':
+            return ReadLiteral("false") || Fail("unexpected token");
+        case 'n':
+            return ReadLiteral("null") || Fail("unexpected token");
+        default:
+        {
+            char text[64];
+            size_t count = 0;
+            return ReadNumberText(text, sizeof(text), count);
+        }
+        }
+    }
+
+    bool JsonReader::AtEnd()
+    {
+        SkipWhitespace();
+        return Peek() < 0;
+    }
+
+    bool JsonReader::Refill()
+    {
+        if (endOfInput) return false;
+
+        input.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        length = static_cast<size_t>(input.gcount());
+        position = 0;
+        if (length == 0)
+        {
+            endOfInput = true;
+            return false;
+        }
+        return true;
+    }
+
+    void JsonReader::SkipWhitespace()
+    {
+        // Pretty-printed files are mostly indentation, so scan the window rather than Get per byte
+        for (;;)
+        {
+            if (position == length && !Refill()) return;
+
+            const char* data = chunk.data();
+            while (position < length)
+            {
+                const char c = data[position];
+                if (c == '\n') ++line;
+                else if (c != ' ' && c != '\r' && c != '\t') return;
+                ++position;
+            }
+        }
+    }
+
+    bool JsonReader::Expect(char expected, const char* message)
+    {
+        if (HasError()) return false;
+
+        SkipWhitespace();
+        if (Peek() != static_cast<unsigned char>(expected)) return Fail(message);
+        ++position;
+        return true;
+    }
+
+    bool JsonReader::Fail(const char* message)
+    {
+        if (error.empty())
+        {
+            error = "line " + std::to_string(line) + ": " + message;
+        }
+        return false;
+    }
+
+    bool JsonReader::ParseString(std::string& out)
+    {
+        // The opening quote is already consumed; copy unescaped runs straight from the window
+        out.clear();
+        for (;;)
+        {
+            if (position == length && !Refill()) return Fail("unterminated string");
+
+            const char* start = chunk.data() + position;
+            const char* end = chunk.data() + length;
+            const char* run = start;
+            while (run < end && *run != '"' && *run != '\\' && static_cast<unsigned char>(*run) >= 0x20)
+            {
+                ++run;
+            }
+            out.append(start, run);
+            position += run - start;
+            if (run == end) continue;
+
+            const char c = *run;
+            ++position;
+            if (c == '"') return true;
+            if (c != '\\') return Fail("control character in string");
+            if (!ParseEscape(out)) return false;
+        }
+    }
+
+    bool JsonReader::ParseEscape(std::string& out)
+    {
+        switch (Get())
+        {
+        case '"': out += '"'; return true;
+        case '\\': out += '\\'; return true;
+        case '/': out += '/'; return true;
+        case 'b': out += '\b'; return true;
+        case 'f': out += '\f'; return true;
+        case 'n': out += '\n'; return true;
+        case 'r': out += '\r'; return true;
+        case 't': out += '\t'; return true;
+        case 'u':
+        {
+            unsigned codePoint = 0;
+            if (!ParseHex4(codePoint)) return false;
+
+            // Surrogate pair: a high half must be followed by an escaped low half
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                unsigned low = 0;
+                if (Get() != '\\' || Get() != 'u' || !ParseHex4(low) || low < 0xDC00 || low > 0xDFFF)
+                {
+                    return Fail("invalid surrogate pair");
+                }
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+            {
+                return Fail("invalid surrogate pair");
+            }
+
+            AppendUtf8(out, codePoint);
+            return true;
+        }
+        default:
+            return Fail("invalid escape");
+        }
+    }
+
+    bool JsonReader::ParseHex4(unsigned& value)
+    {
+        value = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const int c = Get();
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= c - '0';
+            else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+            else return Fail("invalid \\u escape");
+        }
+        return true;
+    }
+
+    bool JsonReader::ReadNumberText(char* text, size_t capacity, size_t& count)
+    {
+        if (HasError()) return false;
+
+        SkipWhitespace();
+        count = 0;
+        for (int c = Peek(); IsNumberChar(c); c = Peek())
+        {
+            if (count == capacity) return Fail("number too long");
+            text[count++] = static_cast<char>(c);
+            ++position;
+        }
+        return count > 0 || Fail("expected a number");
+    }
+
+    bool JsonReader::ReadLiteral(const char* literal)
+    {
+        for (const char* c = literal; *c; ++c)
+        {
+            if (Peek() != static_cast<unsigned char>(*c)) return false;
+            ++position;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Vector2.h"
+#include "Color.h"
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AronEngine
+{
+    // Pull parser over an istream, read through one fixed-size window so memory stays flat
+    // however large the file is. Walk objects with BeginObject/NextKey and arrays with
+    // BeginArray/NextElement; every key or element must be read or skipped before the next.
+    // The first error sticks: later calls return false and GetError reports where it happened.
+    class JsonReader
+    {
+    public:
+        static constexpr size_t kChunkSize = 64 * 1024;
+
+    private:
+        std::istream& input;
+        std::vector<char> chunk;
+        size_t position;
+        size_t length;
+        bool endOfInput;
+        bool containerStart;    // just entered an object/array, so no comma before the next entry
+        int line;
+        std::string scratch;    // key and string-view storage, reused for every read
+        std::string error;
+
+    public:
+        explicit JsonReader(std::istream& input);
+
+        JsonReader(const JsonReader&) = delete;
+        JsonReader& operator=(const JsonReader&) = delete;
+
+        bool BeginObject();
+        // False once the closing brace is consumed. key stays valid until the next read.
+        bool NextKey(std::string_view& key);
+
+        bool BeginArray();
+        // False once the closing bracket is consumed
+        bool NextElement();
+
+        bool Read(bool& value);
+        bool Read(int& value);
+        bool Read(float& value);
+        bool Read(std::string& value);
+        bool Read(Vector2& value);
+        bool Read(Color& value);            // [r, g, b] or [r, g, b, a]
+        // Valid until the next read; saves a copy when the caller only compares or converts
+        bool ReadString(std::string_view& value);
+
+        // Any value, nested containers included
+        bool SkipValue();
+        // Only whitespace remains after the top-level value
+        bool AtEnd();
+
+        bool HasError() const { return !error.empty(); }
+        const std::string& GetError() const { return error; }
+        // Records an error at the current line, for callers that reject well-formed input
+        bool Fail(const char* message);
+
+    private:
+        int Peek()
+        {
+            if (position == length && !Refill()) return -1;
+            return static_cast<unsigned char>(chunk[position]);
+        }
+
+        int Get()
+        {
+            const int c = Peek();
+            if (c >= 0)
+            {
+                ++position;
+                if (c == '\n') ++line;
+            }
+            return c;
+        }
+
+        bool Refill();
+        void SkipWhitespace();
+        bool Expect(char expected, const char* message);
+        bool ParseString(std::string& out);
+        bool ParseEscape(std::string& out);
+        bool ParseHex4(unsigned& value);
+        bool ReadNumberText(char* text, size_t capacity, size_t& count);
+        bool ReadLiteral(const char* literal);
+        bool SkipValue(int depth);
+    };
+}
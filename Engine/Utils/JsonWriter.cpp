@@ -0,0 +1,245 @@
+#include "framework.h"
+#include "JsonWriter.h"
+#include <charconv>
+#include <cmath>
+
+namespace AronEngine
+{
+    namespace
+    {
+        constexpr size_t kFlushThreshold = 64 * 1024;
+    }
+
+    JsonWriter::JsonWriter(std::ostream& output, bool pretty)
+        : output(output)
+        , pretty(pretty)
+    {
+        buffer.reserve(kFlushThreshold + 1024);
+        firstInScope.reserve(16);
+    }
+
+    JsonWriter::~JsonWriter()
+    {
+        Flush();
+    }
+
+    void JsonWriter::BeginObject()
+    {
+        BeginValue();
+        buffer += '{';
+        firstInScope.push_back(true);
+    }
+
+    void JsonWriter::BeginObject(std::string_view key)
+    {
+        BeginMember(key);
+        buffer += '{';
+        firstInScope.push_back(true);
+    }
+
+    void JsonWriter::EndObject()
+    {
+        const bool empty = firstInScope.back();
+        firstInScope.pop_back();
+        if (!empty) NewLine();
+        buffer += '}';
+        if (firstInScope.empty())
+        {
+            buffer += '\n';
+        }
+        FlushIfFull();
+    }
+
+    void JsonWriter::BeginArray()
+    {
+        BeginValue();
+        buffer += '[';
+        firstInScope.push_back(true);
+    }
+
+    void JsonWriter::BeginArray(std::string_view key)
+    {
+        BeginMember(key);
+        buffer += '[';
+        firstInScope.push_back(true);
+    }
+
+    void JsonWriter::EndArray()
+    {
+        const bool empty = firstInScope.back();
+        firstInScope.pop_back();
+        if (!empty) NewLine();
+        buffer += ']';
+        FlushIfFull();
+    }
+
+    void JsonWriter::Value(bool value)
+    {
+        BeginValue();
+        buffer += value ? "true" : "false";
+    }
+
+    void JsonWriter::Value(int value)
+    {
+        BeginValue();
+        AppendNumber(value);
+    }
+
+    void JsonWriter::Value(float value)
+    {
+        BeginValue();
+        AppendNumber(value);
+    }
+
+    void JsonWriter::Value(std::string_view value)
+    {
+        BeginValue();
+        AppendString(value);
+    }
+
+    void JsonWriter::Write(std::string_view key, bool value)
+    {
+        BeginMember(key);
+        buffer += value ? "true" : "false";
+    }
+
+    void JsonWriter::Write(std::string_view key, int value)
+    {
+        BeginMember(key);
+        AppendNumber(value);
+    }
+
+    void JsonWriter::Write(std::string_view key, float value)
+    {
+        BeginMember(key);
+        AppendNumber(value);
+    }
+
+    void JsonWriter::Write(std::string_view key, std::string_view value)
+    {
+        BeginMember(key);
+        AppendString(value);
+    }
+
+    void JsonWriter::Write(std::string_view key, const Vector2& value)
+    {
+        BeginMember(key);
+        const float values[] = { value.x, value.y };
+        AppendFloatArray(values, 2);
+    }
+
+    void JsonWriter::Write(std::string_view key, const Color& value)
+    {
+        BeginMember(key);
+        const float values[] = { value.r, value.g, value.b, value.a };
+        AppendFloatArray(values, 4);
+    }
+
+    void JsonWriter::Flush()
+    {
+        if (!buffer.empty())
+        {
+            output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+        output.flush();
+    }
+
+    void JsonWriter::BeginValue()
+    {
+        if (firstInScope.empty())
+            return;
+
+        if (!firstInScope.back())
+        {
+            buffer += ',';
+        }
+        firstInScope.back() = false;
+        NewLine();
+    }
+
+    void JsonWriter::BeginMember(std::string_view key)
+    {
+        BeginValue();
+        AppendString(key);
+        buffer += pretty ? ": " : ":";
+    }
+
+    void JsonWriter::NewLine()
+    {
+        if (!pretty)
+            return;
+
+        buffer += '\n';
+        buffer.append(firstInScope.size() * 2, ' ');
+    }
+
+    void JsonWriter::AppendString(std::string_view value)
+    {
+        static const char kHex[] = "0123456789abcdef";
+
+        buffer += '"';
+        for (char c : value)
+        {
+            switch (c)
+            {
+            case '"': buffer += "\\\""; break;
+            case '\\': buffer += "\\\\"; break;
+            case '\n': buffer += "\\n"; break;
+            case '\r': buffer += "\\r"; break;
+            case '\t': buffer += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    buffer += "\\u00";
+                    buffer += kHex[(c >> 4) & 0xF];
+                    buffer += kHex[c & 0xF];
+                }
+                else
+                {
+                    buffer += c;
+                }
+                break;
+            }
+        }
+        buffer += '"';
+    }
+
+    void JsonWriter::AppendNumber(float value)
+    {
+        // JSON has no NaN or infinity
+        if (!std::isfinite(value)) value = 0.0f;
+
+        // Shortest text that reads back to the same float
+        char text[32];
+        const auto result = std::to_chars(text, text + sizeof(text), value);
+        buffer.append(text, result.ptr);
+    }
+
+    void JsonWriter::AppendNumber(int value)
+    {
+        char text[16];
+        const auto result = std::to_chars(text, text + sizeof(text), value);
+        buffer.append(text, result.ptr);
+    }
+
+    void JsonWriter::AppendFloatArray(const float* values, int count)
+    {
+        buffer += '[';
+        for (int i = 0; i < count; ++i)
+        {
+            if (i > 0) buffer += pretty ? ", " : ",";
+            AppendNumber(values[i]);
+        }
+        buffer += ']';
+    }
+
+    void JsonWriter::FlushIfFull()
+    {
+        if (buffer.size() >= kFlushThreshold)
+        {
+            output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Vector2.h"
+#include "Color.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AronEngine
+{
+    // Streams JSON to an ostream through one reusable buffer. Objects and arrays are opened
+    // with Begin*/End*; inside an object every value takes a key. Vector2 and Color are
+    // written as inline number arrays.
+    class JsonWriter
+    {
+    private:
+        std::ostream& output;
+        std::string buffer;
+        std::vector<bool> firstInScope;     // one entry per open object/array
+        bool pretty;
+
+    public:
+        explicit JsonWriter(std::ostream& output, bool pretty = true);
+        ~JsonWriter();
+
+        JsonWriter(const JsonWriter&) = delete;
+        JsonWriter& operator=(const JsonWriter&) = delete;
+
+        void BeginObject();
+        void BeginObject(std::string_view key);
+        void EndObject();
+        void BeginArray();
+        void BeginArray(std::string_view key);
+        void EndArray();
+
+        // Array elements
+        void Value(bool value);
+        void Value(int value);
+        void Value(float value);
+        void Value(std::string_view value);
+        void Value(const char* value) { Value(std::string_view(value)); }
+
+        // Object members
+        void Write(std::string_view key, bool value);
+        void Write(std::string_view key, int value);
+        void Write(std::string_view key, float value);
+        void Write(std::string_view key, std::string_view value);
+        void Write(std::string_view key, const char* value) { Write(key, std::string_view(value)); }
+        void Write(std::string_view key, const Vector2& value);
+        void Write(std::string_view key, const Color& value);
+
+        // Hands buffered output to the stream; also done when the buffer fills and on destruction
+        void Flush();
+        bool Good() const { return output.good(); }
+
+    private:
+        void BeginValue();
+        void BeginMember(std::string_view key);
+        void NewLine();
+        void AppendString(std::string_view value);
+        void AppendNumber(float value);
+        void AppendNumber(int value);
+        void AppendFloatArray(const float* values, int count);
+        void FlushIfFull();
+    };
+}
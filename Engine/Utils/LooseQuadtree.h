@@ -0,0 +1,331 @@
+#pragma once
+#include "../Core/framework.h"
+#include "Vector2.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace AronEngine
+{
+    // Loose quadtree of axis-aligned boxes. A node's loose bounds are twice its cell, so an item
+    // lives in the deepest node whose cell holds its centre and whose half-size covers its
+    // half-extent; it never has to straddle children, and a small move usually leaves it in
+    // the same node, where Update just rewrites the box.
+    //
+    // The root covers a fixed square set by Rebuild. Items outside it, or larger than it, stay
+    // in the root and are tested by every query; Rebuild refits the square around the items.
+    // Handles stay valid across Rebuild until the item is removed.
+    template<typename T>
+    class LooseQuadtree
+    {
+    public:
+        using Handle = int32_t;
+        static constexpr Handle kInvalidHandle = -1;
+        static constexpr int32_t kMaxDepthLimit = 32;     // bounds the query stack
+        static constexpr int32_t kItemsPerLeaf = 8;       // what Rebuild sizes the depth for
+
+    private:
+        struct Node
+        {
+            float centerX;
+            float centerY;
+            float halfSize;                 // of the cell; loose bounds are twice this
+            int32_t children[4];            // -1 when absent; bit 0 = right, bit 1 = bottom
+            int32_t depth;
+            std::vector<Handle> items;
+        };
+
+        struct Item
+        {
+            D2D1_RECT_F bounds;
+            T value;
+            int32_t node;                   // -1 while on the free list
+            int32_t slot;                   // index in the node's items
+            bool outside;                   // in the root only because it doesn't fit the square
+        };
+
+        std::vector<Node> nodes;            // [0] is the root
+        std::vector<Item> items;
+        std::vector<Handle> freeItems;
+        int32_t count;
+        int32_t outsideCount;
+        int32_t depthLimit;
+        int32_t maxDepth;                   // set by Rebuild from the item count, up to depthLimit
+
+    public:
+        // maxDepthValue caps the depth Rebuild picks
+        explicit LooseQuadtree(int32_t maxDepthValue = 10)
+            : count(0)
+            , outsideCount(0)
+            , depthLimit((std::min)((std::max)(maxDepthValue, 0), kMaxDepthLimit))
+            , maxDepth(depthLimit)
+        {
+            ResetNodes(0.0f, 0.0f, 1.0f);
+        }
+
+        Handle Insert(const D2D1_RECT_F& bounds, const T& value)
+        {
+            Handle handle;
+            if (!freeItems.empty())
+            {
+                handle = freeItems.back();
+                freeItems.pop_back();
+            }
+            else
+            {
+                handle = static_cast<Handle>(items.size());
+                items.push_back(Item());
+            }
+
+            Item& item = items[handle];
+            item.bounds = bounds;
+            item.value = value;
+            Attach(handle, ChooseNode(bounds));
+            ++count;
+            return handle;
+        }
+
+        void Remove(Handle handle)
+        {
+            if (!IsValid(handle))
+                return;
+
+            Detach(handle);
+            items[handle].node = -1;
+            freeItems.push_back(handle);
+            --count;
+        }
+
+        // Moves the item only when its new box belongs to another node
+        void Update(Handle handle, const D2D1_RECT_F& bounds)
+        {
+            if (!IsValid(handle))
+                return;
+
+            Item& item = items[handle];
+            item.bounds = bounds;
+            if (!StaysIn(item.node, bounds))
+            {
+                const int32_t node = ChooseNode(bounds);
+                if ((node < 0 ? 0 : node) != item.node || (node < 0) != item.outside)
+                {
+                    Detach(handle);
+                    Attach(handle, node);
+                }
+            }
+        }
+
+        // Refits the root square around every item's centre and re-places them all. Use after
+        // a large batch of inserts (bulk load), or when many items have wandered outside.
+        void Rebuild()
+        {
+            float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+            bool any = false;
+            for (const Item& item : items)
+            {
+                if (item.node < 0)
+                    continue;
+
+                const float x = (item.bounds.left + item.bounds.right) * 0.5f;
+                const float y = (item.bounds.top + item.bounds.bottom) * 0.5f;
+                minX = any ? (std::min)(minX, x) : x;
+                minY = any ? (std::min)(minY, y) : y;
+                maxX = any ? (std::max)(maxX, x) : x;
+                maxY = any ? (std::max)(maxY, y) : y;
+                any = true;
+            }
+
+            // Deep enough for about kItemsPerLeaf per leaf if spread evenly; tiny items would
+            // otherwise each get a private chain of nodes down to depthLimit
+            int32_t depth = 1;
+            for (int64_t leaves = 4; leaves * kItemsPerLeaf < count && depth < depthLimit; leaves *= 4)
+            {
+                ++depth;
+            }
+            maxDepth = (std::min)(depth, depthLimit);
+
+            // A little slack so items on the far edge stay inside
+            const float halfSize = (std::max)((std::max)(maxX - minX, maxY - minY) * 0.5f * 1.01f, 1.0f);
+            ResetNodes((minX + maxX) * 0.5f, (minY + maxY) * 0.5f, halfSize);
+
+            for (Handle handle = 0; handle < static_cast<Handle>(items.size()); ++handle)
+            {
+                if (items[handle].node >= 0)
+                {
+                    Attach(handle, ChooseNode(items[handle].bounds));
+                }
+            }
+        }
+
+        void Clear()
+        {
+            items.clear();
+            freeItems.clear();
+            count = 0;
+            ResetNodes(0.0f, 0.0f, 1.0f);
+        }
+
+        // Calls visit(value) for every item whose box overlaps rect, edges included
+        template<typename F>
+        void Query(const D2D1_RECT_F& rect, const F& visit) const
+        {
+            int32_t stack[kMaxDepthLimit * 3 + 1];
+            int32_t top = 0;
+            stack[top++] = 0;
+
+            while (top > 0)
+            {
+                const int32_t nodeIndex = stack[--top];
+                const Node& node = nodes[nodeIndex];
+
+                // Every item of a node inside rect overlaps it; the root's items can be anywhere
+                const float loose = node.halfSize * 2.0f;
+                const bool contained = nodeIndex != 0
+                    && rect.left <= node.centerX - loose && node.centerX + loose <= rect.right
+                    && rect.top <= node.centerY - loose && node.centerY + loose <= rect.bottom;
+
+                for (Handle handle : node.items)
+                {
+                    const Item& item = items[handle];
+                    if (contained || Overlaps(item.bounds, rect))
+                    {
+                        visit(item.value);
+                    }
+                }
+
+                const float childLoose = node.halfSize;     // twice the child's half-size
+                for (int32_t childIndex : node.children)
+                {
+                    if (childIndex < 0)
+                        continue;
+
+                    const Node& child = nodes[childIndex];
+                    if (child.centerX - childLoose <= rect.right && rect.left <= child.centerX + childLoose
+                        && child.centerY - childLoose <= rect.bottom && rect.top <= child.centerY + childLoose)
+                    {
+                        stack[top++] = childIndex;
+                    }
+                }
+            }
+        }
+
+        template<typename F>
+        void QueryPoint(const Vector2& point, const F& visit) const
+        {
+            Query(D2D1::RectF(point.x, point.y, point.x, point.y), visit);
+        }
+
+        bool IsValid(Handle handle) const
+        {
+            return handle >= 0 && handle < static_cast<Handle>(items.size()) && items[handle].node >= 0;
+        }
+
+        const D2D1_RECT_F& GetBounds(Handle handle) const { return items[handle].bounds; }
+        int32_t GetCount() const { return count; }
+        int32_t GetOutsideCount() const { return outsideCount; }
+        int32_t GetNodeCount() const { return static_cast<int32_t>(nodes.size()); }
+
+    private:
+        static bool Overlaps(const D2D1_RECT_F& a, const D2D1_RECT_F& b)
+        {
+            return a.left <= b.right && b.left <= a.right && a.top <= b.bottom && b.top <= a.bottom;
+        }
+
+        void ResetNodes(float centerX, float centerY, float halfSize)
+        {
+            nodes.clear();
+            nodes.push_back(Node{ centerX, centerY, halfSize, { -1, -1, -1, -1 }, 0, {} });
+            outsideCount = 0;
+        }
+
+        bool FitsRoot(float x, float y, float extent) const
+        {
+            const Node& root = nodes[0];
+            return extent <= root.halfSize
+                && x >= root.centerX - root.halfSize && x <= root.centerX + root.halfSize
+                && y >= root.centerY - root.halfSize && y <= root.centerY + root.halfSize;
+        }
+
+        // Whether ChooseNode would still pick node, without walking down from the root
+        bool StaysIn(int32_t nodeIndex, const D2D1_RECT_F& bounds) const
+        {
+            if (nodeIndex == 0)
+                return false;
+
+            const Node& node = nodes[nodeIndex];
+            const float x = (bounds.left + bounds.right) * 0.5f;
+            const float y = (bounds.top + bounds.bottom) * 0.5f;
+            const float extent = (std::max)(bounds.right - bounds.left, bounds.bottom - bounds.top) * 0.5f;
+            return extent <= node.halfSize
+                && (node.depth == maxDepth || extent > node.halfSize * 0.5f)
+                && x >= node.centerX - node.halfSize && x < node.centerX + node.halfSize
+                && y >= node.centerY - node.halfSize && y < node.centerY + node.halfSize;
+        }
+
+        int32_t ChooseNode(const D2D1_RECT_F& bounds)
+        {
+            const float x = (bounds.left + bounds.right) * 0.5f;
+            const float y = (bounds.top + bounds.bottom) * 0.5f;
+            const float extent = (std::max)(bounds.right - bounds.left, bounds.bottom - bounds.top) * 0.5f;
+            if (!FitsRoot(x, y, extent))
+                return -1;
+
+            int32_t nodeIndex = 0;
+            while (nodes[nodeIndex].depth < maxDepth)
+            {
+                const Node& node = nodes[nodeIndex];
+                const float childHalf = node.halfSize * 0.5f;
+                if (extent > childHalf)
+                    break;
+
+                const int quadrant = (x >= node.centerX ? 1 : 0) | (y >= node.centerY ? 2 : 0);
+                int32_t childIndex = node.children[quadrant];
+                if (childIndex < 0)
+                {
+                    Node child{
+                        node.centerX + ((quadrant & 1) ? childHalf : -childHalf),
+                        node.centerY + ((quadrant & 2) ? childHalf : -childHalf),
+                        childHalf, { -1, -1, -1, -1 }, node.depth + 1, {} };
+                    childIndex = static_cast<int32_t>(nodes.size());
+                    nodes[nodeIndex].children[quadrant] = childIndex;
+                    nodes.push_back(std::move(child));      // node is dangling from here
+                }
+                nodeIndex = childIndex;
+            }
+            return nodeIndex;
+        }
+
+        // nodeIndex -1 means the root, as an outsider
+        void Attach(Handle handle, int32_t nodeIndex)
+        {
+            const bool outside = nodeIndex < 0;
+            if (outside)
+            {
+                nodeIndex = 0;
+                ++outsideCount;
+            }
+
+            Item& item = items[handle];
+            std::vector<Handle>& list = nodes[nodeIndex].items;
+            item.outside = outside;
+            item.node = nodeIndex;
+            item.slot = static_cast<int32_t>(list.size());
+            list.push_back(handle);
+        }
+
+        void Detach(Handle handle)
+        {
+            Item& item = items[handle];
+            std::vector<Handle>& list = nodes[item.node].items;
+            if (item.outside)
+            {
+                --outsideCount;
+            }
+
+            const Handle last = list.back();
+            list[item.slot] = last;
+            items[last].slot = item.slot;
+            list.pop_back();
+        }
+    };
+}
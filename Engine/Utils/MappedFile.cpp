@@ -0,0 +1,73 @@
+#include "framework.h"
+#include "MappedFile.h"
+
+namespace AronEngine
+{
+    MappedFile::MappedFile()
+        : file(INVALID_HANDLE_VALUE)
+        , mapping(nullptr)
+        , view(nullptr)
+        , size(0)
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::string& filePath)
+    {
+        Close();
+
+        file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            Close();
+            return false;
+        }
+
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            Close();
+            return false;
+        }
+
+        view = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!view)
+        {
+            Close();
+            return false;
+        }
+
+        size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (view)
+        {
+            UnmapViewOfFile(view);
+            view = nullptr;
+        }
+        if (mapping)
+        {
+            CloseHandle(mapping);
+            mapping = nullptr;
+        }
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+        }
+        size = 0;
+    }
+}
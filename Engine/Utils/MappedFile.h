@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+
+namespace AronEngine
+{
+    // Read-only view of a whole file. Pages come in on first touch, so opening is cheap
+    // whatever the size; the view stays valid until Close or destruction.
+    class MappedFile
+    {
+    private:
+        void* file;         // HANDLEs, kept opaque so the header needs no windows.h
+        void* mapping;
+        const char* view;
+        size_t size;
+
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Empty files can't be mapped and fail like missing ones
+        bool Open(const std::string& filePath);
+        void Close();
+
+        bool IsOpen() const { return view != nullptr; }
+        const char* GetData() const { return view; }
+        size_t GetSize() const { return size; }
+    };
+}
@@ -0,0 +1,100 @@
+#include "framework.h"
+#include "PoolAllocator.h"
+#include <algorithm>
+#include <functional>
+
+namespace AronEngine
+{
+    PoolAllocator::PoolAllocator(const std::string& poolName, size_t size, size_t chunkBlocks)
+        : name(poolName)
+        , blockSize((std::max)((size + kAlignment - 1) & ~(kAlignment - 1), sizeof(FreeBlock)))
+        , blocksPerChunk((std::max)(chunkBlocks, static_cast<size_t>(1)))
+        , freeList(nullptr)
+        , used(0)
+        , peak(0)
+        , totalAllocations(0)
+    {
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        for (uint8_t* chunk : chunks)
+        {
+            ::operator delete(chunk, std::align_val_t(kAlignment));
+        }
+    }
+
+    void* PoolAllocator::Allocate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (!freeList)
+        {
+            AddChunk();
+        }
+
+        FreeBlock* block = freeList;
+        freeList = block->next;
+
+        ++used;
+        ++totalAllocations;
+        peak = (std::max)(peak, used);
+        return block;
+    }
+
+    void PoolAllocator::Free(void* block)
+    {
+        if (!block) return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = freeList;
+        freeList = freeBlock;
+        --used;
+    }
+
+    bool PoolAllocator::Owns(const void* block) const
+    {
+        const uint8_t* address = static_cast<const uint8_t*>(block);
+        const size_t chunkBytes = blockSize * blocksPerChunk;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Last chunk starting at or below the address
+        auto it = std::upper_bound(chunks.begin(), chunks.end(), address,
+            [](const uint8_t* value, const uint8_t* chunk) { return std::less<const uint8_t*>()(value, chunk); });
+        if (it == chunks.begin()) return false;
+        --it;
+        return address < *it + chunkBytes;
+    }
+
+    PoolStats PoolAllocator::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        PoolStats stats;
+        stats.name = name;
+        stats.blockSize = blockSize;
+        stats.capacity = chunks.size() * blocksPerChunk;
+        stats.used = used;
+        stats.peak = peak;
+        stats.chunkCount = chunks.size();
+        stats.totalAllocations = totalAllocations;
+        return stats;
+    }
+
+    void PoolAllocator::AddChunk()
+    {
+        uint8_t* chunk = static_cast<uint8_t*>(::operator new(blockSize * blocksPerChunk, std::align_val_t(kAlignment)));
+        chunks.insert(std::upper_bound(chunks.begin(), chunks.end(), chunk, std::less<uint8_t*>()), chunk);
+
+        // Thread the new blocks onto the free list in address order
+        for (size_t i = blocksPerChunk; i-- > 0;)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * blockSize);
+            block->next = freeList;
+            freeList = block;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace AronEngine
+{
+    struct PoolStats
+    {
+        std::string name;
+        size_t blockSize = 0;
+        size_t capacity = 0;            // blocks across all chunks
+        size_t used = 0;
+        size_t peak = 0;
+        size_t chunkCount = 0;
+        uint64_t totalAllocations = 0;
+    };
+
+    // Fixed-size blocks carved from chunks, recycled through an intrusive free list. Chunks
+    // are kept until the pool is destroyed. Thread-safe; the lock is uncontended in practice.
+    class PoolAllocator
+    {
+    public:
+        static constexpr size_t kAlignment = 16;
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        std::string name;
+        size_t blockSize;
+        size_t blocksPerChunk;
+
+        mutable std::mutex mutex;
+        FreeBlock* freeList;
+        std::vector<uint8_t*> chunks;   // sorted by address for Owns()
+        size_t used;
+        size_t peak;
+        uint64_t totalAllocations;
+
+    public:
+        PoolAllocator(const std::string& poolName, size_t size, size_t chunkBlocks = 256);
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* Allocate();
+        void Free(void* block);
+        // True if block lies inside one of this pool's chunks
+        bool Owns(const void* block) const;
+
+        size_t GetBlockSize() const { return blockSize; }
+        PoolStats GetStats() const;
+
+    private:
+        void AddChunk();
+    };
+}
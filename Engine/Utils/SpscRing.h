@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace AronEngine
+{
+    // Single-producer/single-consumer lock-free ring of trivially copyable items.
+    // One thread may only push, one other thread may only pop.
+    template<typename T, size_t Capacity>
+    class SpscRing
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+        static_assert(std::is_trivially_copyable<T>::value, "SpscRing items must be trivially copyable");
+
+    private:
+        static constexpr size_t kMask = Capacity - 1;
+
+        // Producer and consumer indices on separate cache lines
+        alignas(64) std::atomic<size_t> tail{ 0 };
+        size_t cachedHead = 0;          // producer's last view of head
+
+        alignas(64) std::atomic<size_t> head{ 0 };
+        size_t cachedTail = 0;          // consumer's last view of tail
+
+        alignas(64) T items[Capacity];
+
+    public:
+        // Producer. Publishes up to count items with a single release store; returns how many fit.
+        size_t PushBatch(const T* src, size_t count)
+        {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            size_t free = Capacity - (t - cachedHead);
+            if (free < count)
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+                free = Capacity - (t - cachedHead);
+            }
+
+            const size_t n = count < free ? count : free;
+            for (size_t i = 0; i < n; ++i)
+            {
+                items[(t + i) & kMask] = src[i];
+            }
+
+            tail.store(t + n, std::memory_order_release);
+            return n;
+        }
+
+        bool Push(const T& item)
+        {
+            return PushBatch(&item, 1) == 1;
+        }
+
+        // Consumer
+        bool Pop(T& out)
+        {
+            const size_t h = head.load(std::memory_order_relaxed);
+            if (h == cachedTail)
+            {
+                cachedTail = tail.load(std::memory_order_acquire);
+                if (h == cachedTail) return false;
+            }
+
+            out = items[h & kMask];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Approximate; exact only when called from the producer or consumer with the other side idle
+        size_t Size() const
+        {
+            return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+        }
+
+        static constexpr size_t GetCapacity() { return Capacity; }
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace AronEngine
+{
+    // Fixed-capacity Chase-Lev deque of pointers. The owning thread pushes and pops at the
+    // bottom (LIFO, cache-warm); any other thread may steal from the top (FIFO).
+    template<typename T, size_t Capacity>
+    class WorkStealingQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "WorkStealingQueue capacity must be a power of two");
+
+    private:
+        static constexpr int64_t kMask = static_cast<int64_t>(Capacity) - 1;
+
+        // Thieves hammer top, the owner hammers bottom; keep them on separate cache lines
+        alignas(64) std::atomic<int64_t> top{ 0 };
+        alignas(64) std::atomic<int64_t> bottom{ 0 };
+        alignas(64) std::atomic<T*> items[Capacity];
+
+    public:
+        WorkStealingQueue()
+        {
+            for (auto& item : items)
+            {
+                item.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        // Owner only; false when full
+        bool Push(T* item)
+        {
+            const int64_t b = bottom.load(std::memory_order_relaxed);
+            const int64_t t = top.load(std::memory_order_acquire);
+            if (b - t >= static_cast<int64_t>(Capacity)) return false;
+
+            items[b & kMask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Owner only
+        T* Pop()
+        {
+            const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // Empty
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = items[b & kMask].load(std::memory_order_relaxed);
+            if (t == b)
+            {
+                // Last item: race any thief for it
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Any thread
+        T* Steal()
+        {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) return nullptr;
+
+            T* item = items[t & kMask].load(std::memory_order_relaxed);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;     // lost to the owner or another thief
+            }
+            return item;
+        }
+
+        // Approximate
+        size_t Size() const
+        {
+            const int64_t b = bottom.load(std::memory_order_relaxed);
+            const int64_t t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        static constexpr size_t GetCapacity() { return Capacity; }
+    };
+}
@@ -1,4 +1,6 @@
 #include <windows.h>
+#include <sstream>
+#include <string>
 #include "Core/EngineApp.h"
 #include "TestApp.h"
 
@@ -12,6 +14,25 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     if (app.Initialize(hInstance, 1600, 900, L"AronEngine - Game Editor", true))
     {
+        // --record <file>: capture input, --replay <file>: rerun a capture and exit when it ends.
+        // Both start in play mode; a stopped editor runs no simulation to capture or reproduce.
+        std::istringstream args(lpCmdLine ? lpCmdLine : "");
+        std::string arg;
+        while (args >> arg)
+        {
+            std::string path;
+            if (arg == "--record" && args >> path)
+            {
+                app.StartInputRecording(path);
+                app.SetPlaying(true);
+            }
+            else if (arg == "--replay" && args >> path)
+            {
+                app.StartInputReplay(path, true);
+                app.SetPlaying(true);
+            }
+        }
+
         app.Run();
     }
 
@@ -19,4 +40,4 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     CoUninitialize();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,34 @@
+@echo off
+REM Runs the benchmark suite and compares it against Benchmark\baseline.json.
+REM   run_benchmark.bat          - run and compare
+REM   run_benchmark.bat update   - run and store the results as the new baseline
+
+set "BENCH_EXE=x64\Release\Benchmark.exe"
+set "RESULTS=benchmark_results.json"
+set "BASELINE=Benchmark\baseline.json"
+
+if not exist "%BENCH_EXE%" (
+    echo %BENCH_EXE% not found. Build the Benchmark project in Release x64 first.
+    exit /b 2
+)
+
+echo Running AronEngine benchmarks...
+"%BENCH_EXE%" --out "%RESULTS%"
+if not %ERRORLEVEL%==0 (
+    echo BENCHMARK RUN FAILED!
+    exit /b %ERRORLEVEL%
+)
+
+if /i "%1"=="update" (
+    copy /y "%RESULTS%" "%BASELINE%" >nul
+    echo Baseline updated: %BASELINE%
+    exit /b 0
+)
+
+if not exist "%BASELINE%" (
+    echo No baseline at %BASELINE%. Run "run_benchmark.bat update" to create one.
+    exit /b 0
+)
+
+powershell -NoProfile -ExecutionPolicy Bypass -File Benchmark\compare_benchmark.ps1 -Baseline "%BASELINE%" -Current "%RESULTS%"
+exit /b %ERRORLEVEL%